@@ -90,6 +90,7 @@
 #include "DocumentObjectGroupPy.h"
 #include "DocumentObserver.h"
 #include "DocumentPy.h"
+#include "DocumentSignalBatchPy.h"
 #include "ExpressionParser.h"
 #include "FeatureTest.h"
 #include "FeaturePython.h"
@@ -368,6 +369,10 @@ void Application::setupPythonTypes()
     Base::Vector2dPy::init_type();
     Base::Interpreter().addType(Base::Vector2dPy::type_object(),
         pBaseModule,"Vector2d");
+
+    App::DocumentSignalBatchPy::init_type();
+    Base::Interpreter().addType(App::DocumentSignalBatchPy::type_object(),
+        pAppModule,"DocumentSignalBatch");
 }
 
 void Application::setupPythonException(PyObject* module)
@@ -505,6 +510,7 @@ Document* Application::newDocument(const char * Name, const char * UserName, boo
     _pActiveDoc->signalStartSave.connect(std::bind(&App::Application::slotStartSaveDocument, this, sp::_1, sp::_2));
     _pActiveDoc->signalFinishSave.connect(std::bind(&App::Application::slotFinishSaveDocument, this, sp::_1, sp::_2));
     _pActiveDoc->signalChangePropertyEditor.connect(std::bind(&App::Application::slotChangePropertyEditor, this, sp::_1, sp::_2));
+    _pActiveDoc->signalChangeSet.connect(std::bind(&App::Application::slotChangeSet, this, sp::_1, sp::_2));
     //NOLINTEND
 
     // make sure that the active document is set in case no GUI is up
@@ -1642,6 +1648,11 @@ void Application::slotChangePropertyEditor(const App::Document &doc, const App::
     this->signalChangePropertyEditor(doc,prop);
 }
 
+void Application::slotChangeSet(const App::Document& doc, const App::DocumentChangeSet& changes)
+{
+    this->signalChangeSet(doc, changes);
+}
+
 //**************************************************************************
 // Init, Destruct and singleton
 
@@ -47,6 +47,7 @@ namespace App
 
 class Document;
 class DocumentObject;
+struct DocumentChangeSet;
 class ApplicationObserver;
 class Property;
 class AutoTransaction;
@@ -286,6 +287,8 @@ public:
     boost::signals2::signal<void (const App::Document&)> signalCommitTransaction;
     // signal an aborted transaction
     boost::signals2::signal<void (const App::Document&)> signalAbortTransaction;
+    /// signal with all changes of a closed DocumentSignalBatch
+    boost::signals2::signal<void (const App::Document&, const App::DocumentChangeSet&)> signalChangeSet;
     //@}
 
     /** @name Signals of property changes
@@ -478,6 +481,7 @@ protected:
     void slotStartSaveDocument(const App::Document&, const std::string&);
     void slotFinishSaveDocument(const App::Document&, const std::string&);
     void slotChangePropertyEditor(const App::Document&, const App::Property &);
+    void slotChangeSet(const App::Document&, const App::DocumentChangeSet&);
     //@}
 
     /// open single document only
@@ -307,6 +307,8 @@ void Document::addOrRemovePropertyOfObject(TransactionalObject* obj, Property *p
 {
     if (!prop || !obj || !obj->isAttachedToDocument())
         return;
+    if (!add && obj->isDerivedFrom(DocumentObject::getClassTypeId()))
+        _purgeSignalBatch(static_cast<DocumentObject*>(obj), prop);
     if(d->iUndoMode && !isPerformingTransaction() && !d->activeUndoTransaction) {
         if(!testStatus(Restoring) || testStatus(Importing)) {
             int tid=0;
@@ -772,9 +774,211 @@ void Document::onBeforeChangeProperty(const TransactionalObject *Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject *Who, const Property *What)
 {
+    if (d->signalBatchDepth > 0) {
+        if (d->pendingChangedKeys.emplace(Who, What).second)
+            d->pendingChanges.changedObjects.emplace_back(Who, What);
+        return;
+    }
+    Base::StateLocker guard(d->replayingSignal, false);
     signalChangedObject(*Who, *What);
 }
 
+void Document::_emitNewObject(const DocumentObject* pcObject)
+{
+    if (d->signalBatchDepth > 0) {
+        d->pendingChanges.newObjects.push_back(pcObject);
+        return;
+    }
+    Base::StateLocker guard(d->replayingSignal, false);
+    signalNewObject(*pcObject);
+}
+
+void Document::_emitRecomputedObject(const DocumentObject* pcObject)
+{
+    if (d->signalBatchDepth > 0) {
+        if (d->pendingRecomputedKeys.insert(pcObject).second)
+            d->pendingChanges.recomputedObjects.push_back(pcObject);
+        return;
+    }
+    Base::StateLocker guard(d->replayingSignal, false);
+    signalRecomputedObject(*pcObject);
+}
+
+void Document::_emitChangePropertyEditor(const Property* prop)
+{
+    if (d->signalBatchDepth > 0) {
+        if (d->pendingPropertyEditorKeys.insert(prop).second)
+            d->pendingChanges.propertyEditorChanges.push_back(prop);
+        return;
+    }
+    Base::StateLocker guard(d->replayingSignal, false);
+    signalChangePropertyEditor(*this, *prop);
+}
+
+static void purgeChangeSet(DocumentChangeSet& changes,
+                           const DocumentObject* pcObject,
+                           const Property* prop)
+{
+    // entries are only cleared, because the change set may be in the middle of delivery
+    if (!prop) {
+        std::replace(changes.newObjects.begin(), changes.newObjects.end(),
+                pcObject, static_cast<const DocumentObject*>(nullptr));
+        std::replace(changes.recomputedObjects.begin(), changes.recomputedObjects.end(),
+                pcObject, static_cast<const DocumentObject*>(nullptr));
+    }
+    for (auto& change : changes.changedObjects) {
+        if (change.first == pcObject && (!prop || change.second == prop))
+            change = {nullptr, nullptr};
+    }
+    for (auto& editorProp : changes.propertyEditorChanges) {
+        if (editorProp && (prop ? editorProp == prop : editorProp->getContainer() == pcObject))
+            editorProp = nullptr;
+    }
+}
+
+void Document::_purgeSignalBatch(const DocumentObject* pcObject, const Property* prop)
+{
+    if (d->signalBatchDepth == 0 && d->deliveringChanges.empty())
+        return;
+
+    if (prop) {
+        d->pendingChangedKeys.erase(std::make_pair(pcObject, prop));
+        d->pendingPropertyEditorKeys.erase(prop);
+    }
+    else {
+        auto& keys = d->pendingChangedKeys;
+        auto it = keys.lower_bound(std::make_pair(pcObject, static_cast<const Property*>(nullptr)));
+        while (it != keys.end() && it->first == pcObject)
+            it = keys.erase(it);
+        d->pendingRecomputedKeys.erase(pcObject);
+        for (auto jt = d->pendingPropertyEditorKeys.begin(); jt != d->pendingPropertyEditorKeys.end();) {
+            if ((*jt)->getContainer() == pcObject)
+                jt = d->pendingPropertyEditorKeys.erase(jt);
+            else
+                ++jt;
+        }
+    }
+
+    purgeChangeSet(d->pendingChanges, pcObject, prop);
+    for (auto changes : d->deliveringChanges)
+        purgeChangeSet(*changes, pcObject, prop);
+}
+
+void Document::openSignalBatch()
+{
+    ++d->signalBatchDepth;
+}
+
+void Document::closeSignalBatch()
+{
+    if (d->signalBatchDepth <= 0) {
+        FC_ERR("Unbalanced signal batch of document " << getName());
+        return;
+    }
+    if (--d->signalBatchDepth > 0)
+        return;
+
+    DocumentChangeSet changes;
+    std::swap(changes, d->pendingChanges);
+    d->pendingChangedKeys.clear();
+    d->pendingRecomputedKeys.clear();
+    d->pendingPropertyEditorKeys.clear();
+    if (changes.empty())
+        return;
+
+    // The observers may remove objects while the changes are delivered, which
+    // clears their entries through _purgeSignalBatch()
+    d->deliveringChanges.push_back(&changes);
+    try {
+        for (auto pcObject : changes.newObjects) {
+            if (pcObject) {
+                Base::StateLocker guard(d->replayingSignal);
+                signalNewObject(*pcObject);
+            }
+        }
+        for (const auto& change : changes.changedObjects) {
+            if (change.first) {
+                Base::StateLocker guard(d->replayingSignal);
+                signalChangedObject(*change.first, *change.second);
+            }
+        }
+        for (auto pcObject : changes.recomputedObjects) {
+            if (pcObject) {
+                Base::StateLocker guard(d->replayingSignal);
+                signalRecomputedObject(*pcObject);
+            }
+        }
+        for (auto prop : changes.propertyEditorChanges) {
+            if (prop) {
+                Base::StateLocker guard(d->replayingSignal);
+                signalChangePropertyEditor(*this, *prop);
+            }
+        }
+    }
+    catch (...) {
+        d->deliveringChanges.pop_back();
+        throw;
+    }
+    d->deliveringChanges.pop_back();
+
+    auto isNull = [](const auto& entry) {
+        return !entry;
+    };
+    changes.newObjects.erase(std::remove_if(changes.newObjects.begin(),
+                changes.newObjects.end(), isNull), changes.newObjects.end());
+    changes.changedObjects.erase(std::remove_if(changes.changedObjects.begin(),
+                changes.changedObjects.end(), [](const auto& change) { return !change.first; }),
+            changes.changedObjects.end());
+    changes.recomputedObjects.erase(std::remove_if(changes.recomputedObjects.begin(),
+                changes.recomputedObjects.end(), isNull), changes.recomputedObjects.end());
+    changes.propertyEditorChanges.erase(std::remove_if(changes.propertyEditorChanges.begin(),
+                changes.propertyEditorChanges.end(), isNull), changes.propertyEditorChanges.end());
+    if (!changes.empty())
+        signalChangeSet(*this, changes);
+}
+
+bool Document::isSignalBatchOpen() const
+{
+    return d->signalBatchDepth > 0;
+}
+
+bool Document::isReplayingSignalBatch() const
+{
+    return d->replayingSignal;
+}
+
+std::weak_ptr<void> Document::getSignalBatchToken() const
+{
+    return d->signalBatchToken;
+}
+
+DocumentSignalBatch::DocumentSignalBatch(Document* doc)
+    : document(doc)
+{
+    if (doc) {
+        token = doc->getSignalBatchToken();
+        doc->openSignalBatch();
+    }
+}
+
+DocumentSignalBatch::~DocumentSignalBatch()
+{
+    if (!document || token.expired())
+        return;
+    try {
+        document->closeSignalBatch();
+    }
+    catch (Base::Exception& e) {
+        e.ReportException();
+    }
+    catch (std::exception& e) {
+        FC_ERR("Exception on delivering document signals: " << e.what());
+    }
+    catch (...) {
+        FC_ERR("Unknown exception on delivering document signals");
+    }
+}
+
 void Document::setTransactionMode(int iMode)
 {
     d->iTransactionMode = iMode;
@@ -2407,6 +2611,30 @@ std::vector<App::DocumentObject*> Document::getInList(const DocumentObject* me)
 // assumption is broken by the introduction of PropertyXLink which can link to
 // external object.
 //
+// Results of getDependencyList(), only valid as long as no object dependency
+// changed since they were computed. They are keyed by the options and the
+// queried objects.
+static std::map<std::pair<int, std::vector<DocumentObject*> >,
+                std::vector<DocumentObject*> > _DependencyCache;
+static std::size_t _DependencyCacheGeneration;
+static std::size_t _DependencyGeneration;
+
+void Document::clearDependencyCache()
+{
+    // Called for every change of a link, so only mark the cache as outdated
+    // here. This also keeps it safe to call from objects destroyed on exit.
+    ++_DependencyGeneration;
+}
+
+static void _cacheDependencyList(std::pair<int, std::vector<DocumentObject*> > &&key,
+        const std::vector<DocumentObject*> &depObjs)
+{
+    // the number of distinct queries is usually small, keep it bounded anyway
+    if(_DependencyCache.size() >= 64)
+        _DependencyCache.clear();
+    _DependencyCache.emplace(std::move(key), depObjs);
+}
+
 static void _buildDependencyList(const std::vector<App::DocumentObject*> &objectArray,
         int options, std::vector<App::DocumentObject*> *depObjs,
         DependencyList *depList, std::map<DocumentObject*,Vertex> *objectMap,
@@ -2461,9 +2689,19 @@ static void _buildDependencyList(const std::vector<App::DocumentObject*> &object
 std::vector<App::DocumentObject*> Document::getDependencyList(
     const std::vector<App::DocumentObject*>& objectArray, int options)
 {
+    if(_DependencyCacheGeneration != _DependencyGeneration) {
+        _DependencyCache.clear();
+        _DependencyCacheGeneration = _DependencyGeneration;
+    }
+    auto key = std::make_pair(options, objectArray);
+    auto it = _DependencyCache.find(key);
+    if(it != _DependencyCache.end())
+        return it->second;
+
     std::vector<App::DocumentObject*> ret;
     if(!(options & DepSort)) {
         _buildDependencyList(objectArray,options,&ret,nullptr,nullptr);
+        _cacheDependencyList(std::move(key), ret);
         return ret;
     }
 
@@ -2532,6 +2770,7 @@ std::vector<App::DocumentObject*> Document::getDependencyList(
 
     for (std::list<Vertex>::reverse_iterator i = make_order.rbegin();i != make_order.rend(); ++i)
         ret.push_back(vertexMap[*i]);
+    _cacheDependencyList(std::move(key), ret);
     return ret;
 }
 
@@ -2748,7 +2987,7 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
                 d->vertexMap.clear();
                 return -1;
             }
-            signalRecomputedObject(*Cur);
+            _emitRecomputedObject(Cur);
             ++objectCount;
         }
     }
@@ -2869,7 +3108,7 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
                     }
                 }
                 if(obj->isTouched() || doRecompute) {
-                    signalRecomputedObject(*obj);
+                    _emitRecomputedObject(obj);
                     obj->purgeTouched();
                     // set all dependent object touched to force recompute
                     for (auto inObjIt : obj->getInList())
@@ -3186,7 +3425,7 @@ bool Document::recomputeFeature(DocumentObject* Feat, bool recursive)
             return !hasError;
         } else {
             _recomputeFeature(Feat);
-            signalRecomputedObject(*Feat);
+            _emitRecomputedObject(Feat);
             return Feat->isValid();
         }
     }else
@@ -3237,6 +3476,7 @@ DocumentObject * Document::addObject(const char* sType, const char* pObjectName,
     d->objectIdMap[pcObject->_Id] = pcObject;
     // cache the pointer to the name string in the Object (for performance of DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
+    clearDependencyCache();
     // insert in the vector
     d->objectArray.push_back(pcObject);
 
@@ -3261,7 +3501,7 @@ DocumentObject * Document::addObject(const char* sType, const char* pObjectName,
     if (viewType && viewType[0] != '\0')
         pcObject->_pcViewProviderName = viewType;
 
-    signalNewObject(*pcObject);
+    _emitNewObject(pcObject);
 
     // do no transactions if we do a rollback!
     if (!d->rollback && d->activeUndoTransaction) {
@@ -3341,6 +3581,7 @@ std::vector<DocumentObject *> Document::addObjects(const char* sType, const std:
         d->objectIdMap[pcObject->_Id] = pcObject;
         // cache the pointer to the name string in the Object (for performance of DocumentObject::getNameInDocument())
         pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
+        clearDependencyCache();
         // insert in the vector
         d->objectArray.push_back(pcObject);
 
@@ -3357,7 +3598,7 @@ std::vector<DocumentObject *> Document::addObjects(const char* sType, const std:
         const char *viewType = pcObject->getViewProviderNameOverride();
         pcObject->_pcViewProviderName = viewType ? viewType : "";
 
-        signalNewObject(*pcObject);
+        _emitNewObject(pcObject);
 
         // do no transactions if we do a rollback!
         if (!d->rollback && d->activeUndoTransaction) {
@@ -3405,6 +3646,7 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
     d->objectIdMap[pcObject->_Id] = pcObject;
     // cache the pointer to the name string in the Object (for performance of DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
+    clearDependencyCache();
     // insert in the vector
     d->objectArray.push_back(pcObject);
 
@@ -3416,7 +3658,7 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
     const char *viewType = pcObject->getViewProviderNameOverride();
     pcObject->_pcViewProviderName = viewType ? viewType : "";
 
-    signalNewObject(*pcObject);
+    _emitNewObject(pcObject);
 
     // do no transactions if we do a rollback!
     if (!d->rollback && d->activeUndoTransaction) {
@@ -3436,6 +3678,7 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName)
     d->objectArray.push_back(pcObject);
     // cache the pointer to the name string in the Object (for performance of DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
+    clearDependencyCache();
 
     // do no transactions if we do a rollback!
     if (!d->rollback) {
@@ -3449,7 +3692,7 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName)
     pcObject->_pcViewProviderName = viewType ? viewType : "";
 
     // send the signal
-    signalNewObject(*pcObject);
+    _emitNewObject(pcObject);
 
     // do no transactions if we do a rollback!
     if (!d->rollback && d->activeUndoTransaction) {
@@ -3490,6 +3733,7 @@ void Document::removeObject(const char* sName)
     }
 
     signalDeletedObject(*(pos->second));
+    _purgeSignalBatch(pos->second);
 
     // do no transactions if we do a rollback!
     if (!d->rollback && d->activeUndoTransaction) {
@@ -3595,6 +3839,7 @@ void Document::_removeObject(DocumentObject* pcObject)
         pcObject->unsetupObject();
     }
     signalDeletedObject(*pcObject);
+    _purgeSignalBatch(pcObject);
     // TODO Check me if it's needed (2015-09-01, Fat-Zer)
 
     //remove the tip if needed
@@ -34,6 +34,7 @@
 #include "PropertyStandard.h"
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <QString>
 
@@ -57,6 +58,24 @@ namespace App
 namespace App
 {
 
+/// The changes queued while a DocumentSignalBatch was open
+struct DocumentChangeSet
+{
+    /// new objects, in the order of creation
+    std::vector<const App::DocumentObject*> newObjects;
+    /// changed properties, each listed once in the order of their first change
+    std::vector<std::pair<const App::DocumentObject*, const App::Property*>> changedObjects;
+    /// recomputed objects, each listed once
+    std::vector<const App::DocumentObject*> recomputedObjects;
+    /// properties with a changed editor status, each listed once
+    std::vector<const App::Property*> propertyEditorChanges;
+
+    bool empty() const {
+        return newObjects.empty() && changedObjects.empty()
+            && recomputedObjects.empty() && propertyEditorChanges.empty();
+    }
+};
+
 /// The document class
 class AppExport Document : public App::PropertyContainer
 {
@@ -180,6 +199,12 @@ public:
     boost::signals2::signal<void (const App::Document&, const std::vector<App::DocumentObject*>&)> signalSkipRecompute;
     boost::signals2::signal<void (const App::DocumentObject&)> signalFinishRestoreObject;
     boost::signals2::signal<void (const App::Document&,const App::Property&)> signalChangePropertyEditor;
+    /** signal with all changes of a closed DocumentSignalBatch
+     * It is emitted after the queued changes were delivered through the per
+     * item signals above, and only for batched changes. Observers handling it
+     * can ignore the per item signals while isReplayingSignalBatch() is true.
+     */
+    boost::signals2::signal<void (const App::Document&, const App::DocumentChangeSet&)> signalChangeSet;
     //@}
     boost::signals2::signal<void (std::string)> signalLinkXsetValue;
 
@@ -460,6 +485,12 @@ public:
      */
     static std::vector<App::DocumentObject*> getDependencyList(
             const std::vector<App::DocumentObject*> &objs, int options=0);
+    /** Invalidate the results of getDependencyList() cached so far
+     *
+     * Must be called whenever the out list of an object changes, or an object
+     * is attached to or detached from a document.
+     */
+    static void clearDependencyCache();
 
     std::vector<App::Document*> getDependentDocuments(bool sort=true);
     static std::vector<App::Document*> getDependentDocuments(std::vector<App::Document*> docs, bool sort);
@@ -533,6 +564,32 @@ public:
     /// Indicate if there is any document restoring/importing
     static bool isAnyRestoring();
 
+    /** @name Signal batching */
+    //@{
+    /** Queue the per item signals of this document, see DocumentSignalBatch
+     *
+     * Batches can be nested, the queued signals are delivered when the
+     * outermost batch is closed.
+     */
+    void openSignalBatch();
+    /// Close a batch opened with openSignalBatch()
+    void closeSignalBatch();
+    /// Check if the signals of this document are queued
+    bool isSignalBatchOpen() const;
+    /** Check if the signal being emitted is the replay of a queued change
+     *
+     * Observers that handle signalChangeSet can use it to skip the per item
+     * signals of the same changes.
+     */
+    bool isReplayingSignalBatch() const;
+    /** Token that expires when the document is destroyed
+     *
+     * Kept by the batch scopes to close the batch of this document only, even
+     * if a new document is created at the same address after this one is closed.
+     */
+    std::weak_ptr<void> getSignalBatchToken() const;
+    //@}
+
     friend class Application;
     /// because of transaction handling
     friend class TransactionalObject;
@@ -562,6 +619,12 @@ protected:
     void onBeforeChangeProperty(const TransactionalObject *Who, const Property *What);
     /// callback from the Document objects after property was changed
     void onChangedProperty(const DocumentObject *Who, const Property *What);
+    /// emit the per item signals, or queue them if a signal batch is open
+    void _emitNewObject(const DocumentObject* pcObject);
+    void _emitRecomputedObject(const DocumentObject* pcObject);
+    void _emitChangePropertyEditor(const Property* prop);
+    /// drop the queued signals of a removed object, or of one of its properties
+    void _purgeSignalBatch(const DocumentObject* pcObject, const Property* prop=nullptr);
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
@@ -602,6 +665,37 @@ private:
     std::string myName;
 };
 
+/** Helper class to batch the signals of a document during bulk operations
+ *
+ * While an instance exists, signalNewObject, signalChangedObject,
+ * signalRecomputedObject and signalChangePropertyEditor of the document are
+ * queued. When the outermost instance is destroyed, each queued change is
+ * delivered once through these signals, in the order it first happened,
+ * followed by a single signalChangeSet with all of them. A property changed
+ * many times is therefore only reported once.
+ *
+ * Observers that rely on being notified immediately, e.g. to access the view
+ * provider of a new object or to react to a recomputed object while the
+ * recompute is still running, must not be used inside a batch.
+ */
+class AppExport DocumentSignalBatch
+{
+public:
+    /// Private new operator to prevent heap allocation
+    void* operator new (std::size_t) = delete;
+
+    explicit DocumentSignalBatch(Document* doc);
+    ~DocumentSignalBatch();
+
+    DocumentSignalBatch(const DocumentSignalBatch&) = delete;
+    DocumentSignalBatch& operator=(const DocumentSignalBatch&) = delete;
+
+private:
+    Document* document = nullptr;
+    // expired if the document is closed while the batch is open
+    std::weak_ptr<void> token;
+};
+
 template<typename T>
 inline std::vector<T*> Document::getObjectsOfType() const
 {
@@ -83,6 +83,8 @@ DocumentObject::DocumentObject()
 
 DocumentObject::~DocumentObject()
 {
+    Document::clearDependencyCache();
+
     if (!PythonObject.is(Py::_None())){
         Base::PyGILStateLocker lock;
         // Remark: The API of Py::Object has been changed to set whether the wrapper owns the passed
@@ -367,6 +369,7 @@ const char* DocumentObject::detachFromDocument()
 {
     const std::string* name = pcNameInDocument;
     pcNameInDocument = nullptr;
+    Document::clearDependencyCache();
     return name ? name->c_str() : nullptr;
 }
 
@@ -827,6 +830,7 @@ void DocumentObject::clearOutListCache() const {
     _outList.clear();
     _outListMap.clear();
     _outListCached = false;
+    Document::clearDependencyCache();
 }
 
 PyObject *DocumentObject::getPyObject()
@@ -1327,5 +1331,5 @@ bool DocumentObject::redirectSubName(std::ostringstream &, DocumentObject *, Doc
 void DocumentObject::onPropertyStatusChanged(const Property &prop, unsigned long oldStatus) {
     (void)oldStatus;
     if(!Document::isAnyRestoring() && isAttachedToDocument() && getDocument())
-        getDocument()->signalChangePropertyEditor(*getDocument(),prop);
+        getDocument()->_emitChangePropertyEditor(&prop);
 }
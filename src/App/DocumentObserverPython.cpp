@@ -116,6 +116,7 @@ DocumentObserverPython::DocumentObserverPython(const Py::Object& obj) : inst(obj
     FC_PY_ELEMENT_ARG2(ChangePropertyEditor, ChangePropertyEditor)
     FC_PY_ELEMENT_ARG2(BeforeAddingDynamicExtension, BeforeAddingDynamicExtension)
     FC_PY_ELEMENT_ARG2(AddedDynamicExtension, AddedDynamicExtension)
+    FC_PY_ELEMENT_ARG2(ChangeSet, ChangeSet)
     //NOLINTEND
 }
 
@@ -516,6 +517,58 @@ void DocumentObserverPython::slotChangePropertyEditor(const App::Document &, con
     }
 }
 
+void DocumentObserverPython::slotChangeSet(const App::Document& doc, const App::DocumentChangeSet& changes)
+{
+    Base::PyGILStateLocker lock;
+    try {
+        auto objectList = [](const std::vector<const App::DocumentObject*>& objs) {
+            Py::List list;
+            for (auto obj : objs)
+                list.append(Py::asObject(const_cast<App::DocumentObject*>(obj)->getPyObject()));
+            return list;
+        };
+        // Properties are passed as (object, property name) tuples. If a property is
+        // not part of its container then its name is null, and it is skipped.
+        auto propertyTuple = [](const App::PropertyContainer* container, const App::Property* prop) {
+            const char* prop_name = container->getPropertyName(prop);
+            if (!prop_name)
+                return Py::Object();
+            Py::Tuple tuple(2);
+            tuple.setItem(0, Py::asObject(const_cast<App::PropertyContainer*>(container)->getPyObject()));
+            tuple.setItem(1, Py::String(prop_name));
+            return Py::Object(tuple);
+        };
+
+        Py::List changedObjects;
+        for (const auto& change : changes.changedObjects) {
+            Py::Object item = propertyTuple(change.first, change.second);
+            if (!item.isNone())
+                changedObjects.append(item);
+        }
+        Py::List propertyEditorChanges;
+        for (auto prop : changes.propertyEditorChanges) {
+            Py::Object item = propertyTuple(prop->getContainer(), prop);
+            if (!item.isNone())
+                propertyEditorChanges.append(item);
+        }
+
+        Py::Dict dict;
+        dict.setItem("NewObjects", objectList(changes.newObjects));
+        dict.setItem("ChangedObjects", changedObjects);
+        dict.setItem("RecomputedObjects", objectList(changes.recomputedObjects));
+        dict.setItem("PropertyEditorChanges", propertyEditorChanges);
+
+        Py::Tuple args(2);
+        args.setItem(0, Py::asObject(const_cast<App::Document&>(doc).getPyObject()));
+        args.setItem(1, dict);
+        Base::pyCall(pyChangeSet.ptr(),args.ptr());
+    }
+    catch (Py::Exception&) {
+        Base::PyException e; // extract the Python error text
+        e.ReportException();
+    }
+}
+
 void DocumentObserverPython::slotStartSaveDocument(const App::Document& doc, const std::string& file)
 {
     Base::PyGILStateLocker lock;
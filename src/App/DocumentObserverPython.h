@@ -115,6 +115,8 @@ private:
     void slotBeforeAddingDynamicExtension(const App::ExtensionContainer&, std::string extension);
     /** Called when an object gets a dynamic extension added*/
     void slotAddedDynamicExtension(const App::ExtensionContainer&, std::string extension);
+    /** Called with all changes of a document collected while its signals were batched*/
+    void slotChangeSet(const App::Document& Doc, const App::DocumentChangeSet& Changes);
 
 
 private:
@@ -158,6 +160,7 @@ private:
     Connection pyChangePropertyEditor;
     Connection pyBeforeAddingDynamicExtension;
     Connection pyAddedDynamicExtension;
+    Connection pyChangeSet;
 };
 
 } //namespace App
@@ -30,6 +30,7 @@
 #include "Document.h"
 #include "DocumentObject.h"
 #include "DocumentObjectPy.h"
+#include "DocumentSignalBatchPy.h"
 #include "MergeDocuments.h"
 
 // inclusion of the generated files (generated By DocumentPy.xml)
@@ -495,6 +496,15 @@ PyObject*  DocumentPy::commitTransaction(PyObject * args)
     Py_Return;
 }
 
+PyObject*  DocumentPy::signalBatch(PyObject * args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return nullptr;
+    PY_TRY {
+        return Py::new_reference_to(DocumentSignalBatchPy::create(getDocumentPtr()));
+    } PY_CATCH;
+}
+
 Py::Boolean DocumentPy::getHasPendingTransaction() const {
     return {getDocumentPtr()->hasPendingTransaction()};
 }
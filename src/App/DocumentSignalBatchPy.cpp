@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <sstream>
+#endif
+
+#include <Base/Console.h>
+
+#include "DocumentSignalBatchPy.h"
+#include "Document.h"
+#include "DocumentPy.h"
+
+
+using namespace App;
+
+Py::PythonType& DocumentSignalBatchPy::behaviors()
+{
+    return Py::PythonClass<DocumentSignalBatchPy>::behaviors();
+}
+
+PyTypeObject* DocumentSignalBatchPy::type_object()
+{
+    return Py::PythonClass<DocumentSignalBatchPy>::type_object();
+}
+
+bool DocumentSignalBatchPy::check(PyObject* py)
+{
+    return Py::PythonClass<DocumentSignalBatchPy>::check(py);
+}
+
+Py::Object DocumentSignalBatchPy::create(Document* doc)
+{
+    Py::Callable class_type(type());
+    Py::Tuple arg(1);
+    arg.setItem(0, Py::asObject(doc->getPyObject()));
+    return class_type.apply(arg, Py::Dict());
+}
+
+DocumentSignalBatchPy::DocumentSignalBatchPy(Py::PythonClassInstance* self,
+                                             Py::Tuple& args,
+                                             Py::Dict& kwds)
+    : Py::PythonClass<DocumentSignalBatchPy>::PythonClass(self, args, kwds)
+{
+    PyObject* pyDoc {};
+    if (!PyArg_ParseTuple(args.ptr(), "O!", &DocumentPy::Type, &pyDoc)) {
+        throw Py::Exception();
+    }
+    doc = static_cast<DocumentPy*>(pyDoc)->getDocumentPtr();
+    docName = doc->getName();
+    token = doc->getSignalBatchToken();
+}
+
+DocumentSignalBatchPy::~DocumentSignalBatchPy()
+{
+    // The context was entered but never left, e.g. the object was created
+    // and entered by hand. Do not keep the document batching forever.
+    if (!isOpen) {
+        return;
+    }
+    try {
+        if (Document* document = getDocument()) {
+            document->closeSignalBatch();
+        }
+    }
+    catch (Base::Exception& e) {
+        e.ReportException();
+    }
+    catch (...) {
+        Base::Console().Error("Unhandled exception while closing signal batch\n");
+    }
+}
+
+Document* DocumentSignalBatchPy::getDocument() const
+{
+    // the document may have been closed, or replaced by one at the same address
+    return token.expired() ? nullptr : doc;
+}
+
+Py::Object DocumentSignalBatchPy::repr()
+{
+    std::stringstream str;
+    str << "<DocumentSignalBatch of " << docName << ">";
+    return Py::String(str.str());
+}
+
+Py::Object DocumentSignalBatchPy::enter()
+{
+    if (isOpen) {
+        throw Py::RuntimeError("Signal batch is already entered");
+    }
+    Document* document = getDocument();
+    if (!document) {
+        throw Py::RuntimeError("Document '" + docName + "' no longer exists");
+    }
+    document->openSignalBatch();
+    isOpen = true;
+    return self();
+}
+
+Py::Object DocumentSignalBatchPy::exit(const Py::Tuple& args)
+{
+    (void)args;
+    if (isOpen) {
+        isOpen = false;
+        // The document may have been closed inside the block
+        if (Document* document = getDocument()) {
+            try {
+                document->closeSignalBatch();
+            }
+            catch (Base::Exception& e) {
+                e.setPyException();
+                throw Py::Exception();
+            }
+        }
+    }
+    // Never swallow the exception raised inside the block
+    return Py::False();
+}
+
+PYCXX_NOARGS_METHOD_DECL(DocumentSignalBatchPy, enter)
+PYCXX_VARARGS_METHOD_DECL(DocumentSignalBatchPy, exit)
+
+void DocumentSignalBatchPy::init_type()
+{
+    behaviors().name("DocumentSignalBatch");
+    behaviors().doc("Context manager queueing the change notifications of a document");
+    behaviors().supportRepr();
+
+    PYCXX_ADD_NOARGS_METHOD(__enter__, enter, "__enter__()");
+    PYCXX_ADD_VARARGS_METHOD(__exit__, exit, "__exit__(type, value, traceback)");
+
+    // Call to make the type ready for use
+    behaviors().readyType();
+}
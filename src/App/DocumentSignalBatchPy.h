@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef APP_DOCUMENTSIGNALBATCHPY_H
+#define APP_DOCUMENTSIGNALBATCHPY_H
+
+#include <memory>
+#include <string>
+#include <CXX/Extensions.hxx>
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class Document;
+
+/** Python context manager around Document::openSignalBatch()
+ *
+ * Returned by Document.signalBatch(). The batch is opened by __enter__ and
+ * closed by __exit__, so a raised exception cannot leave the document
+ * queueing its notifications.
+ * @code
+ * with doc.signalBatch():
+ *     doc.addObject("App::FeaturePython", "Obj")
+ * @endcode
+ */
+class AppExport DocumentSignalBatchPy: public Py::PythonClass<DocumentSignalBatchPy>  // NOLINT
+{
+public:
+    static Py::PythonType& behaviors();
+    static PyTypeObject* type_object();
+    static bool check(PyObject* py);
+    static void init_type();
+
+    static Py::Object create(Document* doc);
+    DocumentSignalBatchPy(Py::PythonClassInstance* self, Py::Tuple& args, Py::Dict& kwds);
+    ~DocumentSignalBatchPy() override;
+
+    Py::Object repr() override;
+    Py::Object enter();
+    Py::Object exit(const Py::Tuple& args);
+
+private:
+    Document* getDocument() const;
+
+private:
+    Document* doc {nullptr};
+    std::weak_ptr<void> token;
+    std::string docName;
+    bool isOpen {false};
+};
+
+}  // namespace App
+
+#endif  // APP_DOCUMENTSIGNALBATCHPY_H
@@ -1,5 +1,6 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -440,7 +441,10 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
                     }
                 }
 
-                this->mappedNames.emplace(ref->name, idx);
+                auto hash = hashName(ref->name);
+                if (findName(ref->name, hash) < 0) {
+                    insertName(hash, idx);
+                }
 
                 if (!hasherRef) {
                     if (offset + 1 < (int)tokens.size()) {
@@ -504,25 +508,28 @@ MappedName ElementMap::addName(MappedName& name, const IndexedName& idx, const E
         if (overwrite) {
             erase(idx);
         }
-        auto ret = mappedNames.insert(std::make_pair(name, idx));
-        if (ret.second) {              // element just inserted did not exist yet in the map
-            ret.first->first.compact();// FIXME see MappedName.cpp
-            mappedRef(idx).append(ret.first->first, sids);
+        auto hash = hashName(name);
+        auto slot = findName(name, hash);
+        if (slot < 0) {     // element did not exist yet in the map
+            name.compact(); // FIXME see MappedName.cpp
+            mappedRef(idx).append(name, sids);
+            insertName(hash, idx);
             FC_TRACE(idx << " -> " << name);// NOLINT
-            return ret.first->first;
+            return name;
         }
-        if (ret.first->second == idx) {
+        IndexedName mappedIdx = nameSlots[slot].idx;
+        if (mappedIdx == idx) {
             FC_TRACE("duplicate " << idx << " -> " << name);// NOLINT
-            return ret.first->first;
+            return name;
         }
         if (!overwrite) {
             if (existing) {
-                *existing = ret.first->second;
+                *existing = mappedIdx;
             }
             return {};
         }
 
-        erase(ret.first->first);
+        erase(mappedIdx);
     };
 }
 
@@ -759,16 +766,16 @@ MappedName ElementMap::renameDuplicateElement(int index, const IndexedName& elem
 
 void ElementMap::erase(const MappedName& name)
 {
-    auto it = this->mappedNames.find(name);
-    if (it == this->mappedNames.end()) {
+    auto slot = findName(name, hashName(name));
+    if (slot < 0) {
         return;
     }
-    MappedNameRef* ref = findMappedRef(it->second);
+    MappedNameRef* ref = findMappedRef(nameSlots[slot].idx);
     if (!ref) {
         return;
     }
     ref->erase(name);
-    this->mappedNames.erase(it);
+    eraseName(slot);
 }
 
 void ElementMap::erase(const IndexedName& idx)
@@ -783,25 +790,31 @@ void ElementMap::erase(const IndexedName& idx)
     }
     auto& ref = indices.names[idx.getIndex()];
     for (auto* nameRef = &ref; nameRef; nameRef = nameRef->next.get()) {
-        this->mappedNames.erase(nameRef->name);
+        if (!nameRef->name) {
+            continue;
+        }
+        auto slot = findName(nameRef->name, hashName(nameRef->name));
+        if (slot >= 0) {
+            eraseName(slot);
+        }
     }
     ref.clear();
 }
 
 unsigned long ElementMap::size() const
 {
-    return mappedNames.size() + childElementSize;
+    return mappedNameCount + childElementSize;
 }
 
 bool ElementMap::empty() const
 {
-    return mappedNames.empty() && childElementSize == 0;
+    return mappedNameCount == 0 && childElementSize == 0;
 }
 
 IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
 {
-    auto nameIter = mappedNames.find(name);
-    if (nameIter == mappedNames.end()) {
+    auto slot = findName(name, hashName(name));
+    if (slot < 0) {
         if (childElements.isEmpty()) {
             return IndexedName();
         }
@@ -838,7 +851,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
     }
 
     if (sids) {
-        const MappedNameRef* ref = findMappedRef(nameIter->second);
+        const MappedNameRef* ref = findMappedRef(nameSlots[slot].idx);
         for (; ref; ref = ref->next.get()) {
             if (ref->name == name) {
                 if (sids->empty()) {
@@ -886,7 +899,7 @@ MappedName ElementMap::find(const IndexedName& idx, ElementIDRefs* sids) const
         && it->second.indexedName.getIndex() + it->second.offset <= idx.getIndex()) {
         auto& child = it->second;
         MappedName name;
-        IndexedName childIdx(idx.getType(), idx.getIndex() - child.offset);
+        auto childIdx = IndexedName::fromConst(idx.getType(), idx.getIndex() - child.offset);
         if (child.elementMap) {
             name = child.elementMap->find(childIdx, sids);
         }
@@ -937,7 +950,7 @@ std::vector<std::pair<MappedName, ElementIDRefs>> ElementMap::findAll(const Inde
     if (it != indices.children.end()
         && it->second.indexedName.getIndex() + it->second.offset <= idx.getIndex()) {
         auto& child = it->second;
-        IndexedName childIdx(idx.getType(), idx.getIndex() - child.offset);
+        auto childIdx = IndexedName::fromConst(idx.getType(), idx.getIndex() - child.offset);
         if (child.elementMap) {
             res = child.elementMap->findAll(childIdx);
             for (auto& v : res) {
@@ -988,6 +1001,90 @@ MappedNameRef& ElementMap::mappedRef(const IndexedName& idx)
     return indices.names[idx.getIndex()];
 }
 
+std::uint32_t ElementMap::hashName(const MappedName& name)
+{
+    // FNV-1a over data and postfix as one string, because MappedName::operator==() treats
+    // names with a different split between the two as equal
+    constexpr std::uint32_t fnvOffset = 2166136261U;
+    constexpr std::uint32_t fnvPrime = 16777619U;
+    std::uint32_t hash = fnvOffset;
+    for (const QByteArray* bytes : {&name.dataBytes(), &name.postfixBytes()}) {
+        for (char c : *bytes) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * fnvPrime;
+        }
+    }
+    return hash;
+}
+
+long ElementMap::findName(const MappedName& name, std::uint32_t hash) const
+{
+    if (nameSlots.empty()) {
+        return -1;
+    }
+    std::size_t mask = nameSlots.size() - 1;
+    for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+        const auto& slot = nameSlots[i];
+        if (!slot.idx) {
+            return -1;
+        }
+        if (slot.hash != hash) {
+            continue;
+        }
+        for (auto ref = findMappedRef(slot.idx); ref; ref = ref->next.get()) {
+            if (ref->name == name) {
+                return static_cast<long>(i);
+            }
+        }
+    }
+}
+
+void ElementMap::insertName(std::uint32_t hash, const IndexedName& idx)
+{
+    constexpr std::size_t minSlots = 16;
+    // keep the load factor below 3/4, linear probing degrades quickly above that
+    if ((mappedNameCount + 1) * 4 > nameSlots.size() * 3) {
+        std::vector<NameSlot> slots(std::max(minSlots, nameSlots.size() * 2));
+        std::size_t mask = slots.size() - 1;
+        for (const auto& slot : nameSlots) {
+            if (!slot.idx) {
+                continue;
+            }
+            std::size_t i = slot.hash & mask;
+            while (slots[i].idx) {
+                i = (i + 1) & mask;
+            }
+            slots[i] = slot;
+        }
+        nameSlots.swap(slots);
+    }
+
+    std::size_t mask = nameSlots.size() - 1;
+    std::size_t i = hash & mask;
+    while (nameSlots[i].idx) {
+        i = (i + 1) & mask;
+    }
+    nameSlots[i].idx = idx;
+    nameSlots[i].hash = hash;
+    ++mappedNameCount;
+}
+
+void ElementMap::eraseName(std::size_t slot)
+{
+    // Backward shift deletion, so that lookups need no tombstones. An entry following the hole
+    // is moved into it unless its home slot lies cyclically between the hole and the entry.
+    std::size_t mask = nameSlots.size() - 1;
+    std::size_t hole = slot;
+    for (std::size_t i = (hole + 1) & mask; nameSlots[i].idx; i = (i + 1) & mask) {
+        std::size_t home = nameSlots[i].hash & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            nameSlots[hole] = nameSlots[i];
+            hole = i;
+        }
+    }
+    nameSlots[hole] = NameSlot();
+    --mappedNameCount;
+}
+
 bool ElementMap::hasChildElementMap() const
 {
     return !childElements.empty();
@@ -1047,8 +1144,12 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    for (auto& indexedName : this->indexedNames) {
+        for (auto& ref : indexedName.second.names) {
+            for (auto* nameRef = &ref; nameRef; nameRef = nameRef->next.get()) {
+                addPostfix(nameRef->name.constPostfix(), postfixMap, postfixes);
+            }
+        }
     }
 
     childMaps.push_back(this);
@@ -1268,9 +1369,26 @@ std::vector<MappedElement> ElementMap::getAll() const
 {
     std::vector<MappedElement> ret;
     ret.reserve(size());
-    for (auto& mappedName : this->mappedNames) {
-        ret.emplace_back(mappedName.first, mappedName.second);
+    for (auto& indexedName : this->indexedNames) {
+        const auto& names = indexedName.second.names;
+        for (int i = 0; i < (int)names.size(); ++i) {
+            auto idx = IndexedName::fromConst(indexedName.first, i);
+            for (auto* nameRef = &names[i]; nameRef; nameRef = nameRef->next.get()) {
+                if (!nameRef->name) {
+                    continue;
+                }
+                // skip names that were restored as duplicates of another element
+                auto slot = findName(nameRef->name, hashName(nameRef->name));
+                if (slot >= 0 && nameSlots[slot].idx == idx) {
+                    ret.emplace_back(nameRef->name, idx);
+                }
+            }
+        }
     }
+    // same order as the mapped names had when they were kept in a sorted map
+    std::sort(ret.begin(), ret.end(), [](const MappedElement& a, const MappedElement& b) {
+        return a.name < b.name;
+    });
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
         IndexedName idx(child.indexedName);
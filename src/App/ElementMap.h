@@ -32,11 +32,13 @@
 #include "MappedElement.h"
 #include "StringHasher.h"
 
+#include <cstdint>
 #include <cstring>
 #include <deque>
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 
 namespace Data
@@ -62,11 +64,12 @@ typedef std::function<bool(const MappedName&, int, long, long)> TraceCallback;
 
 /* This class provides for ComplexGeoData's ability to provide proper naming.
  * Specifically, ComplexGeoData uses this class for it's `_id` property.
- * Most of the operations work with the `indexedNames` and `mappedNames` maps.
+ * Most of the operations work with the `indexedNames` map and the `nameSlots` index.
  * `indexedNames` maps a string to both a name queue and children.
  *   each of those children store an IndexedName, offset details, postfix, ids, and
  *   possibly a recursive elementmap
- * `mappedNames` maps a MappedName to a specific IndexedName.
+ * `nameSlots` is a hash index mapping a MappedName to a specific IndexedName. The names
+ *   themselves are only stored once, in the name queues of `indexedNames`.
  */
 class AppExport ElementMap: public std::enable_shared_from_this<ElementMap> //TODO can remove shared_from_this?
 {
@@ -291,7 +294,26 @@ private:
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    /* Open addressing hash index of all mapped names, using linear probing. A slot only
+     * holds the hash of a name and the IndexedName it is mapped to, the name is found in
+     * the name queue of that IndexedName. This avoids a tree node and a second copy of each
+     * name, which dominated the memory of large element maps.
+     */
+    struct NameSlot
+    {
+        IndexedName idx;
+        std::uint32_t hash = 0;
+    };
+
+    std::vector<NameSlot> nameSlots;
+    std::size_t mappedNameCount = 0;
+
+    static std::uint32_t hashName(const MappedName& name);
+    /// Returns the slot of \c name in \c nameSlots, or -1 if it is not mapped
+    long findName(const MappedName& name, std::uint32_t hash) const;
+    /// Maps a name that is not mapped yet. It must be in the name queue of \c idx already.
+    void insertName(std::uint32_t hash, const IndexedName& idx);
+    void eraseName(std::size_t slot);
 
     struct ChildMapInfo
     {
@@ -24,6 +24,7 @@
 #ifndef APP_PROPERTY_H
 #define APP_PROPERTY_H
 
+#include <Base/BufferExports.h>
 #include <Base/Exception.h>
 #include <Base/Persistence.h>
 #include <boost/any.hpp>
@@ -485,11 +486,18 @@ public:
 
     friend atomic_change;
 
+    ~PropertyListsT() override {
+        // an exported buffer may still point to the values
+        _exports.keepAlive(_lValueList);
+    }
+
     virtual void setSize(int newSize, const_reference def) {
+        _exports.check();
         _lValueList.resize(newSize,def);
     }
 
     void setSize(int newSize) override {
+        _exports.check();
         _lValueList.resize(newSize);
     }
 
@@ -504,6 +512,7 @@ public:
     }
 
     virtual void setValues(const ListT &newValues = ListT()) {
+        _exports.check();
         atomic_change guard(*this);
         this->_touchList.clear();
         this->_lValueList = newValues;
@@ -516,6 +525,9 @@ public:
 
     const ListT &getValues() const{return _lValueList;}
 
+    /// Counts the buffers exported from the values, which cannot be changed while there is one
+    const Base::BufferExports &getBufferExports() const {return _exports;}
+
     // alias to getValues
     const ListT &getValue() const{return getValues();}
 
@@ -541,6 +553,7 @@ public:
         if (index<-1 || index>size)
             throw Base::RuntimeError("index out of bound");
 
+        _exports.check();
         atomic_change guard(*this);
         if (index==-1 || index == size) {
             index = size;
@@ -578,6 +591,9 @@ protected:
 
 protected:
     ListT _lValueList;
+
+private:
+    Base::BufferExports _exports;
 };
 
 } // namespace App
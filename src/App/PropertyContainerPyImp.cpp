@@ -29,7 +29,10 @@
 
 #include "PropertyContainer.h"
 #include "Property.h"
+#include "PropertyGeo.h"
+#include "PropertyStandard.h"
 #include "DocumentObject.h"
+#include <Base/PyBufferView.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 
 #include <boost/iostreams/device/array.hpp>
@@ -564,6 +567,105 @@ PyObject* PropertyContainerPy::restorePropertyContent(PyObject *args)
     Py_Return;
 }
 
+namespace {
+// The values of PropT must be made of doubles only
+template<typename PropT>
+PyObject* createListBuffer(PropertyContainerPy* self, const std::string& name, bool writable)
+{
+    using ValueT = typename PropT::list_type::value_type;
+    static_assert(sizeof(ValueT) % sizeof(double) == 0, "Unexpected padding");
+    constexpr std::size_t columns = sizeof(ValueT) / sizeof(double);
+
+    // looked up each time, the property may have been removed in the meantime
+    auto getProperty = [self, name]() {
+        if (!self->isValid()) {
+            throw Base::RuntimeError("Property container is no longer valid");
+        }
+        auto prop = dynamic_cast<PropT*>(self->getPropertyContainerPtr()->getPropertyByName(name.c_str()));
+        if (!prop) {
+            throw Base::RuntimeError("Property no longer exists");
+        }
+        return prop;
+    };
+
+    // the buffer points to the values, which cannot be changed while it is exported
+    auto provider = [getProperty, writable]() {
+        auto prop = getProperty();
+        const auto& values = prop->getValues();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto first = reinterpret_cast<const double*>(values.data());
+        auto layout = Base::BufferLayout::rowsOf(first, values.size(), columns);
+        layout.readOnly = !writable;
+        layout.storage = prop->getBufferExports().lock();
+        return layout;
+    };
+
+    Base::PyBufferView::WriteBegin onWriteBegin;
+    Base::PyBufferView::WriteEnd onWriteEnd;
+    if (writable) {
+        // Python writes to the values directly. The change records the old
+        // values for undo when the buffer is exported, and signals the change
+        // once it has been released.
+        using Change = typename PropT::atomic_change;
+        struct Writing {
+            PropT* prop = nullptr;
+            std::unique_ptr<Change> change;
+        };
+        auto writing = std::make_shared<Writing>();
+        onWriteBegin = [getProperty, writing]() {
+            auto prop = getProperty();
+            if (prop->testStatus(Property::Immutable)) {
+                throw Base::RuntimeError("Property is read-only");
+            }
+            writing->prop = prop;
+            writing->change = std::make_unique<Change>(*prop);
+        };
+        onWriteEnd = [self, name, writing](const Base::BufferLayout& /*layout*/) {
+            Property* prop = nullptr;
+            if (self->isValid()) {
+                prop = self->getPropertyContainerPtr()->getPropertyByName(name.c_str());
+            }
+            if (prop != writing->prop) {
+                // the property has been destroyed, there's nothing to notify
+                (void)writing->change.release();
+                return;
+            }
+            writing->change.reset();
+        };
+    }
+
+    return Base::PyBufferView::create(self, provider, onWriteBegin, onWriteEnd);
+}
+}
+
+PyObject* PropertyContainerPy::getPropertyBuffer(PyObject *args)
+{
+    char* name;
+    PyObject* writable = Py_False;
+    if (!PyArg_ParseTuple(args, "s|O!", &name, &PyBool_Type, &writable))
+        return nullptr;
+
+    Property* prop = getPropertyContainerPtr()->getPropertyByName(name);
+    if (!prop) {
+        PyErr_Format(PyExc_AttributeError, "Property container has no property '%s'", name);
+        return nullptr;
+    }
+
+    bool write = Base::asBoolean(writable);
+    if (write && prop->testStatus(Property::Immutable)) {
+        PyErr_Format(PyExc_AttributeError, "Object attribute '%s' is read-only", name);
+        return nullptr;
+    }
+
+    if (dynamic_cast<PropertyFloatList*>(prop))
+        return createListBuffer<PropertyFloatList>(this, name, write);
+    if (dynamic_cast<PropertyVectorList*>(prop))
+        return createListBuffer<PropertyVectorList>(this, name, write);
+
+    PyErr_Format(PyExc_TypeError, "Property '%s' is neither a float nor a vector list", name);
+    return nullptr;
+}
+
 PyObject *PropertyContainerPy::getCustomAttributes(const char* attr) const
 {
     // search in PropertyList
@@ -313,18 +313,14 @@ void PropertyVectorList::SaveDocFile (Base::Writer &writer) const
     Base::OutputStream str(writer.Stream());
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
+    static_assert(sizeof(Base::Vector3d) == 3 * sizeof(double), "Vector3d must not be padded");
+    const double* coords = reinterpret_cast<const double*>(_lValueList.data());
     if (!isSinglePrecision()) {
-        for (const auto & it : _lValueList) {
-            str << it.x << it.y << it.z;
-        }
+        str.write(coords, 3 * _lValueList.size());
     }
     else {
-        for (const auto & it : _lValueList) {
-            float x = (float)it.x;
-            float y = (float)it.y;
-            float z = (float)it.z;
-            str << x << y << z;
-        }
+        std::vector<float> values(coords, coords + 3 * _lValueList.size());
+        str.write(values.data(), values.size());
     }
 }
 
@@ -334,16 +330,15 @@ void PropertyVectorList::RestoreDocFile(Base::Reader &reader)
     uint32_t uCt=0;
     str >> uCt;
     std::vector<Base::Vector3d> values(uCt);
+    double* coords = reinterpret_cast<double*>(values.data());
     if (!isSinglePrecision()) {
-        for (auto & it : values) {
-            str >> it.x >> it.y >> it.z;
-        }
+        str.read(coords, 3 * values.size());
     }
     else {
-        float x,y,z;
-        for (auto & it : values) {
-            str >> x >> y >> z;
-            it.Set(x, y, z);
+        std::vector<float> floats(3 * values.size());
+        str.read(floats.data(), floats.size());
+        for (std::size_t i = 0; i < floats.size(); i++) {
+            coords[i] = floats[i];
         }
     }
     setValues(values);
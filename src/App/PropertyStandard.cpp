@@ -1240,15 +1240,11 @@ void PropertyFloatList::SaveDocFile (Base::Writer &writer) const
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
     if (!isSinglePrecision()) {
-        for (double it : _lValueList) {
-            str << it;
-        }
+        str.write(_lValueList.data(), _lValueList.size());
     }
     else {
-        for (double it : _lValueList) {
-            float v = static_cast<float>(it);
-            str << v;
-        }
+        std::vector<float> values(_lValueList.begin(), _lValueList.end());
+        str.write(values.data(), values.size());
     }
 }
 
@@ -1259,16 +1255,12 @@ void PropertyFloatList::RestoreDocFile(Base::Reader &reader)
     str >> uCt;
     std::vector<double> values(uCt);
     if (!isSinglePrecision()) {
-        for (double & it : values) {
-            str >> it;
-        }
+        str.read(values.data(), values.size());
     }
     else {
-        for (double & it : values) {
-            float val;
-            str >> val;
-            it = val;
-        }
+        std::vector<float> floats(uCt);
+        str.read(floats.data(), floats.size());
+        values.assign(floats.begin(), floats.end());
     }
     setValues(values);
 }
@@ -25,6 +25,8 @@
 #include <QCryptographicHash>
 #include <QHash>
 #include <deque>
+#include <mutex>
+#include <vector>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -88,6 +90,82 @@ public:
 
 TYPESYSTEM_SOURCE_ABSTRACT(App::StringID, Base::BaseClass)
 
+namespace
+{
+
+// Hands out StringID sized chunks carved from large blocks, to avoid a separate heap
+// allocation and its overhead for every StringID. Freed chunks are reused, the blocks
+// themselves are never released.
+class StringIDPool
+{
+public:
+    static StringIDPool& instance()
+    {
+        // deliberately leaked, StringIDs may still be released during static destruction
+        static auto pool = new StringIDPool;
+        return *pool;
+    }
+
+    void* allocate()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (freeList) {
+            Chunk* chunk = freeList;
+            freeList = chunk->next;
+            return chunk;
+        }
+        if (blocks.empty() || used == chunksPerBlock) {
+            blocks.push_back(std::make_unique<Chunk[]>(chunksPerBlock));
+            used = 0;
+        }
+        return &blocks.back()[used++];
+    }
+
+    void deallocate(void* ptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto chunk = static_cast<Chunk*>(ptr);
+        chunk->next = freeList;
+        freeList = chunk;
+    }
+
+private:
+    union Chunk
+    {
+        Chunk* next;
+        alignas(StringID) unsigned char storage[sizeof(StringID)];// NOLINT
+    };
+
+    static constexpr std::size_t chunksPerBlock = 1024;
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Chunk[]>> blocks;// NOLINT
+    std::size_t used = 0;
+    Chunk* freeList = nullptr;
+};
+
+}// namespace
+
+void* StringID::operator new(std::size_t size)
+{
+    if (size != sizeof(StringID)) {
+        return ::operator new(size);
+    }
+    return StringIDPool::instance().allocate();
+}
+
+void StringID::operator delete(void* ptr, std::size_t size)
+{
+    if (!ptr) {
+        return;
+    }
+    if (size != sizeof(StringID)) {
+        ::operator delete(ptr);
+        return;
+    }
+    StringIDPool::instance().deallocate(ptr);
+}
+
 StringID::~StringID()
 {
     if (_hasher) {
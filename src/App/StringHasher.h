@@ -137,6 +137,10 @@ public:
 
     ~StringID() override;
 
+    /// StringIDs are allocated from a pool, as named shapes create a great many of them
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     /// Returns the ID of this StringID
     long value() const
     {
@@ -27,12 +27,16 @@
 #pragma warning( disable : 4834 )
 #endif
 
+#include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/DocumentObserver.h>
 #include <App/StringHasher.h>
 #include <CXX/Objects.hxx>
 #include <boost/bimap.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <algorithm>
+#include <memory>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -93,6 +97,20 @@ struct DocumentP
 
     StringHasherRef Hasher;
 
+    // signals queued by DocumentSignalBatch
+    int signalBatchDepth = 0;
+    DocumentChangeSet pendingChanges;
+    std::set<std::pair<const DocumentObject*, const Property*>> pendingChangedKeys;
+    std::unordered_set<const DocumentObject*> pendingRecomputedKeys;
+    std::unordered_set<const Property*> pendingPropertyEditorKeys;
+    // the queued signals currently being delivered, more than one for nested batches
+    std::vector<DocumentChangeSet*> deliveringChanges;
+    // true while a queued signal is emitted again
+    bool replayingSignal = false;
+    // expires with the document, so that a batch scope cannot close the batch
+    // of another document created later at the same address
+    std::shared_ptr<void> signalBatchToken = std::make_shared<int>(0);
+
     DocumentP();
 
     void addRecomputeLog(const char *why, App::DocumentObject *obj) {
@@ -119,7 +137,42 @@ struct DocumentP
             _RecomputeLog.erase(obj);
     }
 
+    // drop the queued signals of all objects before they are deleted
+    void clearSignalBatch() {
+        pendingChanges.newObjects.clear();
+        pendingChanges.changedObjects.clear();
+        pendingChanges.recomputedObjects.clear();
+        pendingChangedKeys.clear();
+        pendingRecomputedKeys.clear();
+        auto isObjectProperty = [](const Property* prop) {
+            return prop && prop->getContainer()
+                && prop->getContainer()->isDerivedFrom(DocumentObject::getClassTypeId());
+        };
+        auto& editorChanges = pendingChanges.propertyEditorChanges;
+        editorChanges.erase(std::remove_if(editorChanges.begin(), editorChanges.end(),
+                    isObjectProperty), editorChanges.end());
+        for (auto it = pendingPropertyEditorKeys.begin(); it != pendingPropertyEditorKeys.end();) {
+            if (isObjectProperty(*it))
+                it = pendingPropertyEditorKeys.erase(it);
+            else
+                ++it;
+        }
+
+        // the change sets being delivered are only cleared, see Document::closeSignalBatch()
+        for (auto changes : deliveringChanges) {
+            std::fill(changes->newObjects.begin(), changes->newObjects.end(), nullptr);
+            std::fill(changes->changedObjects.begin(), changes->changedObjects.end(),
+                    std::make_pair(nullptr, nullptr));
+            std::fill(changes->recomputedObjects.begin(), changes->recomputedObjects.end(), nullptr);
+            for (auto& prop : changes->propertyEditorChanges) {
+                if (isObjectProperty(prop))
+                    prop = nullptr;
+            }
+        }
+    }
+
     void clearDocument() {
+        clearSignalBatch();
         objectArray.clear();
         for(auto &v : objectMap) {
             v.second->setStatus(ObjectStatus::Destroy, true);
@@ -0,0 +1,103 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef BASE_BUFFEREXPORTS_H
+#define BASE_BUFFEREXPORTS_H
+
+#include <memory>
+#include <vector>
+
+#include "Exception.h"
+
+
+namespace Base
+{
+
+/**
+ * Counts the buffers exported from the arrays of an object, e.g. by
+ * Base::PyBufferView. While a buffer is exported the arrays must neither be
+ * reallocated nor modified, so the object calls check() before it changes
+ * them. If the object itself is destroyed it passes its arrays to keepAlive().
+ *
+ * A copy of the object has its own arrays, so copies of this class start
+ * without exports.
+ */
+class BufferExports
+{
+public:
+    BufferExports() = default;
+    BufferExports(const BufferExports& /*other*/)
+    {}
+    BufferExports& operator=(const BufferExports& /*other*/)
+    {
+        return *this;
+    }
+    ~BufferExports() = default;
+
+    bool isExported() const
+    {
+        return state && state->count > 0;
+    }
+    /// Throws Base::RuntimeError if a buffer is exported
+    void check() const
+    {
+        if (isExported()) {
+            throw Base::RuntimeError("Cannot modify the data while a buffer of it is exported");
+        }
+    }
+    /// Counts as an exported buffer until the returned object is destroyed
+    std::shared_ptr<void> lock() const
+    {
+        if (!state) {
+            state = std::make_shared<State>();
+        }
+        state->count++;
+        return {state.get(), [keep = state](void* /*unused*/) {
+                    if (--keep->count == 0) {
+                        keep->storage.clear();
+                    }
+                }};
+    }
+    /// Takes over the memory of \a array until the last buffer is released
+    template<typename Array>
+    void keepAlive(Array& array) const
+    {
+        if (isExported()) {
+            auto storage = std::make_shared<Array>();
+            storage->swap(array);
+            state->storage.push_back(storage);
+        }
+    }
+
+private:
+    struct State
+    {
+        int count {0};
+        std::vector<std::shared_ptr<void>> storage;
+    };
+    // created with the first export
+    mutable std::shared_ptr<State> state;
+};
+
+}  // namespace Base
+
+#endif  // BASE_BUFFEREXPORTS_H
@@ -0,0 +1,220 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#include "PyBufferView.h"
+#include "Exception.h"
+
+
+using namespace Base;
+
+namespace
+{
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+struct BufferViewObject
+{
+    PyObject_HEAD
+    PyObject* owner;
+    PyBufferView::LayoutProvider* provider;
+    PyBufferView::WriteBegin* onWriteBegin;
+    PyBufferView::WriteEnd* onWriteEnd;
+    // the layout shared by the exported buffers
+    BufferLayout* layout;
+    int exports;
+};
+
+// kept in Py_buffer::internal until the buffer is released
+struct BufferShape
+{
+    Py_ssize_t shape[2];    // NOLINT
+    Py_ssize_t strides[2];  // NOLINT
+};
+
+template<typename Func>
+bool invoke(Func&& func)
+{
+    try {
+        func();
+        return true;
+    }
+    catch (const Base::Exception& e) {
+        e.setPyException();
+    }
+    catch (const std::exception& e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+    }
+    return false;
+}
+
+bool checkFlags(const BufferLayout& layout, int flags)
+{
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && layout.readOnly) {
+        PyErr_SetString(PyExc_BufferError, "Buffer is read-only");
+        return false;
+    }
+
+    bool contiguous = layout.rowStride == layout.columns * layout.itemSize;
+    if (!contiguous && (flags & PyBUF_STRIDES) != PyBUF_STRIDES) {
+        PyErr_SetString(PyExc_BufferError, "Buffer is not contiguous, strides are required");
+        return false;
+    }
+    return true;
+}
+
+int getBuffer(PyObject* obj, Py_buffer* view, int flags)
+{
+    auto self = reinterpret_cast<BufferViewObject*>(obj);
+    view->obj = nullptr;
+
+    if (!self->layout) {
+        BufferLayout layout;
+        try {
+            layout = (*self->provider)();
+        }
+        catch (const Base::Exception& e) {
+            PyErr_SetString(PyExc_BufferError, e.what());
+            return -1;
+        }
+        catch (const std::exception& e) {
+            PyErr_SetString(PyExc_BufferError, e.what());
+            return -1;
+        }
+
+        if (!checkFlags(layout, flags)) {
+            return -1;
+        }
+        if (!layout.readOnly && *self->onWriteBegin && !invoke(*self->onWriteBegin)) {
+            return -1;
+        }
+        self->layout = new BufferLayout(std::move(layout));
+    }
+    else if (!checkFlags(*self->layout, flags)) {
+        return -1;
+    }
+
+    const BufferLayout& layout = *self->layout;
+    self->exports++;
+
+    auto shape = new BufferShape;
+    shape->shape[0] = Py_ssize_t(layout.rows);
+    shape->shape[1] = Py_ssize_t(layout.columns);
+    shape->strides[0] = Py_ssize_t(layout.rowStride);
+    shape->strides[1] = Py_ssize_t(layout.itemSize);
+
+    view->buf = layout.rows > 0 ? layout.data : nullptr;
+    view->obj = obj;
+    Py_INCREF(obj);
+    view->len = Py_ssize_t(layout.rows * layout.columns * layout.itemSize);
+    view->itemsize = Py_ssize_t(layout.itemSize);
+    view->readonly = layout.readOnly ? 1 : 0;
+    view->ndim = layout.columns > 1 ? 2 : 1;
+    view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>(layout.format) : nullptr;  // NOLINT
+    view->shape = (flags & PyBUF_ND) ? static_cast<Py_ssize_t*>(shape->shape) : nullptr;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES
+        ? static_cast<Py_ssize_t*>(shape->strides)
+        : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = shape;
+    return 0;
+}
+
+void releaseBuffer(PyObject* obj, Py_buffer* view)
+{
+    auto self = reinterpret_cast<BufferViewObject*>(obj);
+    delete static_cast<BufferShape*>(view->internal);
+    if (--self->exports > 0) {
+        return;
+    }
+
+    std::unique_ptr<BufferLayout> layout(self->layout);
+    self->layout = nullptr;
+    // release the export lock first, so that the data can be changed again when
+    // the change is signalled
+    layout->storage.reset();
+    if (!layout->readOnly && *self->onWriteEnd && !invoke([self, &layout]() {
+            (*self->onWriteEnd)(*layout);
+        })) {
+        // a buffer release cannot fail
+        PyErr_WriteUnraisable(obj);
+    }
+}
+
+void dealloc(PyObject* obj)
+{
+    auto self = reinterpret_cast<BufferViewObject*>(obj);
+    delete self->layout;
+    delete self->provider;
+    delete self->onWriteBegin;
+    delete self->onWriteEnd;
+    Py_XDECREF(self->owner);
+    PyObject_Del(obj);
+}
+
+PyTypeObject* bufferViewType()
+{
+    static PyBufferProcs procs = {getBuffer, releaseBuffer};
+    static PyTypeObject type = {PyVarObject_HEAD_INIT(nullptr, 0)};
+    static bool init = false;
+    if (!init) {
+        type.tp_name = "FreeCAD.BufferView";
+        type.tp_basicsize = sizeof(BufferViewObject);
+        type.tp_dealloc = dealloc;
+        type.tp_as_buffer = &procs;
+        type.tp_flags = Py_TPFLAGS_DEFAULT;
+        type.tp_doc = "Array data exposed with the buffer protocol, e.g. for numpy.asarray()";
+        if (PyType_Ready(&type) < 0) {
+            return nullptr;
+        }
+        init = true;
+    }
+    return &type;
+}
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+}  // namespace
+
+PyObject* PyBufferView::create(PyObject* owner,
+                               LayoutProvider provider,
+                               WriteBegin onWriteBegin,
+                               WriteEnd onWriteEnd)
+{
+    PyTypeObject* type = bufferViewType();
+    if (!type) {
+        return nullptr;
+    }
+
+    BufferViewObject* self = PyObject_New(BufferViewObject, type);
+    if (!self) {
+        return nullptr;
+    }
+
+    Py_XINCREF(owner);
+    self->owner = owner;
+    self->provider = new LayoutProvider(std::move(provider));
+    self->onWriteBegin = new WriteBegin(std::move(onWriteBegin));
+    self->onWriteEnd = new WriteEnd(std::move(onWriteEnd));
+    self->layout = nullptr;
+    self->exports = 0;
+    return reinterpret_cast<PyObject*>(self);  // NOLINT
+}
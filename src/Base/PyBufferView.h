@@ -0,0 +1,134 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef BASE_PYBUFFERVIEW_H
+#define BASE_PYBUFFERVIEW_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+#include <Python.h>
+#include <FCGlobal.h>
+
+
+namespace Base
+{
+
+/**
+ * Describes a table of numbers in memory: \a rows rows of \a columns numbers
+ * each. The rows may lie further apart than the numbers they hold.
+ *
+ * \a data points into the storage of the C++ object, nothing is copied.
+ * \a storage is released together with the last buffer handed out to Python.
+ * It keeps the object alive and holds a Base::BufferExports lock, so that the
+ * object refuses to modify the data as long as the buffer is in use.
+ */
+struct BaseExport BufferLayout
+{
+    void* data {nullptr};
+    std::size_t rows {0};
+    std::size_t columns {1};
+    std::size_t itemSize {1};
+    std::size_t rowStride {1};
+    const char* format {"B"};
+    bool readOnly {true};
+    std::shared_ptr<void> storage;
+
+    /** The struct module format character of \a T. */
+    template<typename T>
+    static const char* formatOf()
+    {
+        static_assert(std::is_arithmetic_v<T>, "only arithmetic types can be exposed");
+        if constexpr (std::is_same_v<T, float>) {
+            return "f";
+        }
+        else if constexpr (std::is_same_v<T, double>) {
+            return "d";
+        }
+        else if constexpr (sizeof(T) == 1) {
+            return std::is_signed_v<T> ? "b" : "B";
+        }
+        else if constexpr (sizeof(T) == 2) {
+            return std::is_signed_v<T> ? "h" : "H";
+        }
+        else if constexpr (sizeof(T) == 4) {
+            return std::is_signed_v<T> ? "i" : "I";
+        }
+        else {
+            static_assert(sizeof(T) == 8, "unsupported integer size");
+            return std::is_signed_v<T> ? "q" : "Q";
+        }
+    }
+
+    /**
+     * Layout of \a rows rows of \a columns numbers, starting at \a first. The
+     * rows are \a rowStride bytes apart, or packed if it is 0.
+     */
+    template<typename T>
+    static BufferLayout
+    rowsOf(const T* first, std::size_t rows, std::size_t columns, std::size_t rowStride = 0)
+    {
+        BufferLayout layout;
+        layout.data = rows > 0 ? const_cast<T*>(first) : nullptr;  // NOLINT
+        layout.rows = rows;
+        layout.columns = columns;
+        layout.itemSize = sizeof(T);
+        layout.rowStride = rowStride > 0 ? rowStride : columns * sizeof(T);
+        layout.format = formatOf<T>();
+        return layout;
+    }
+};
+
+/**
+ * Exposes C++ arrays to Python with the buffer protocol, so that e.g.
+ * numpy.asarray() or memoryview() can use them without converting each
+ * element to a Python object.
+ *
+ * The provider is asked for the layout when the first buffer of the view is
+ * requested. All the buffers exported at the same time share it, and it is
+ * dropped once the last of them has been released, so that the next request
+ * sees the current size of the data again.
+ */
+class BaseExport PyBufferView
+{
+public:
+    using LayoutProvider = std::function<BufferLayout()>;
+    using WriteBegin = std::function<void()>;
+    using WriteEnd = std::function<void(const BufferLayout&)>;
+
+    /**
+     * Creates the Python object. \a owner is kept alive as long as the view
+     * exists. For writable layouts \a onWriteBegin is called before the first
+     * buffer of a layout is handed out, and \a onWriteEnd when its last buffer
+     * has been released, e.g. to signal that the data may have been changed.
+     */
+    static PyObject* create(PyObject* owner,
+                            LayoutProvider provider,
+                            WriteBegin onWriteBegin = {},
+                            WriteEnd onWriteEnd = {});
+};
+
+}  // namespace Base
+
+#endif  // BASE_PYBUFFERVIEW_H
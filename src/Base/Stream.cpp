@@ -27,6 +27,7 @@
 #include <QBuffer>
 #include <QByteArray>
 #include <QIODevice>
+#include <algorithm>
 #include <cstring>
 #ifdef __GNUC__
 #include <cstdint>
@@ -40,6 +41,59 @@
 
 using namespace Base;
 
+namespace
+{
+uint16_t byteSwap(uint16_t value)
+{
+    return uint16_t((value >> 8) | (value << 8));
+}
+
+uint32_t byteSwap(uint32_t value)
+{
+    return ((value & 0x000000FFU) << 24) | ((value & 0x0000FF00U) << 8)
+        | ((value & 0x00FF0000U) >> 8) | ((value & 0xFF000000U) >> 24);
+}
+
+uint64_t byteSwap(uint64_t value)
+{
+    return (uint64_t(byteSwap(uint32_t(value))) << 32) | byteSwap(uint32_t(value >> 32));
+}
+
+// The loops are simple enough to be vectorized by the compiler
+template<typename T>
+void swapArray(char* data, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++) {
+        T value;
+        std::memcpy(&value, data + i * sizeof(T), sizeof(T));
+        value = byteSwap(value);
+        std::memcpy(data + i * sizeof(T), &value, sizeof(T));
+    }
+}
+
+void swapBytes(char* data, std::size_t size, std::size_t count)
+{
+    switch (size) {
+        case 1:
+            break;
+        case 2:
+            swapArray<uint16_t>(data, count);
+            break;
+        case 4:
+            swapArray<uint32_t>(data, count);
+            break;
+        case 8:
+            swapArray<uint64_t>(data, count);
+            break;
+        default:
+            for (std::size_t i = 0; i < count; i++) {
+                std::reverse(data + i * size, data + (i + 1) * size);
+            }
+            break;
+    }
+}
+}  // namespace
+
 Stream::Stream() = default;
 
 Stream::~Stream() = default;
@@ -150,6 +204,25 @@ OutputStream& OutputStream::operator<<(double d)
     return *this;
 }
 
+void OutputStream::writeArray(const void* data, std::size_t size, std::size_t count)
+{
+    const char* bytes = static_cast<const char*>(data);
+    if (!isSwapped() || size == 1) {
+        _out.write(bytes, std::streamsize(size * count));
+        return;
+    }
+
+    // swap a copy of the data block by block
+    const std::size_t blockCount = std::max<std::size_t>(65536 / size, 1);
+    std::vector<char> block(std::min(count, blockCount) * size);
+    for (std::size_t index = 0; index < count; index += blockCount) {
+        std::size_t num = std::min(blockCount, count - index);
+        std::memcpy(block.data(), bytes + index * size, num * size);
+        swapBytes(block.data(), size, num);
+        _out.write(block.data(), std::streamsize(num * size));
+    }
+}
+
 InputStream::InputStream(std::istream& rin)
     : _in(rin)
 {}
@@ -246,6 +319,15 @@ InputStream& InputStream::operator>>(double& d)
     return *this;
 }
 
+void InputStream::readArray(void* data, std::size_t size, std::size_t count)
+{
+    char* bytes = static_cast<char*>(data);
+    _in.read(bytes, std::streamsize(size * count));
+    if (isSwapped()) {
+        swapBytes(bytes, size, count);
+    }
+}
+
 // ----------------------------------------------------------------------
 
 ByteArrayOStreambuf::ByteArrayOStreambuf(QByteArray& ba)
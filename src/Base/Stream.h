@@ -28,10 +28,12 @@
 #include <cstdint>
 #endif
 
+#include <cstddef>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include "FileInfo.h"
 
@@ -95,12 +97,26 @@ public:
     OutputStream& operator<<(float f);
     OutputStream& operator<<(double d);
 
+    /**
+     * Writes the \a count numbers of the array \a values with a single write
+     * to the underlying stream. The bytes are only swapped if needed.
+     */
+    template<typename T>
+    OutputStream& write(const T* values, std::size_t count)
+    {
+        static_assert(std::is_arithmetic_v<T>, "Only arrays of numbers can be written");
+        writeArray(values, sizeof(T), count);
+        return *this;
+    }
+
     OutputStream(const OutputStream&) = delete;
     OutputStream(OutputStream&&) = delete;
     void operator=(const OutputStream&) = delete;
     void operator=(OutputStream&&) = delete;
 
 private:
+    void writeArray(const void* data, std::size_t size, std::size_t count);
+
     std::ostream& _out;
 };
 
@@ -126,6 +142,18 @@ public:
     InputStream& operator>>(float& f);
     InputStream& operator>>(double& d);
 
+    /**
+     * Reads \a count numbers into the array \a values with a single read
+     * from the underlying stream. The bytes are only swapped if needed.
+     */
+    template<typename T>
+    InputStream& read(T* values, std::size_t count)
+    {
+        static_assert(std::is_arithmetic_v<T>, "Only arrays of numbers can be read");
+        readArray(values, sizeof(T), count);
+        return *this;
+    }
+
     explicit operator bool() const
     {
         // test if _Ipfx succeeded
@@ -138,6 +166,8 @@ public:
     void operator=(InputStream&&) = delete;
 
 private:
+    void readArray(void* data, std::size_t size, std::size_t count);
+
     std::istream& _in;
 };
 
@@ -106,7 +106,7 @@ PropertyView::PropertyView(QWidget *parent)
     //NOLINTBEGIN
     this->connectPropData =
     App::GetApplication().signalChangedObject.connect(std::bind
-        (&PropertyView::slotChangePropertyData, this, sp::_2));
+        (&PropertyView::slotChangeObjectPropertyData, this, sp::_1, sp::_2));
     this->connectPropView =
     Gui::Application::Instance->signalChangedObject.connect(std::bind
         (&PropertyView::slotChangePropertyView, this, sp::_1, sp::_2));
@@ -139,6 +139,8 @@ PropertyView::PropertyView(QWidget *parent)
                 std::bind(&PropertyView::slotDeletedObject, this, sp::_1));
     this->connectChangedDocument = App::GetApplication().signalChangedDocument.connect(
             std::bind(&PropertyView::slotChangePropertyData, this, sp::_2));
+    this->connectChangeSet = App::GetApplication().signalChangeSet.connect(
+            std::bind(&PropertyView::slotChangeSet, this, sp::_1, sp::_2));
     //NOLINTEND
 }
 
@@ -156,6 +158,7 @@ PropertyView::~PropertyView()
     this->connectDelObject.disconnect();
     this->connectDelViewObject.disconnect();
     this->connectChangedDocument.disconnect();
+    this->connectChangeSet.disconnect();
 }
 
 static bool _ShowAll;
@@ -220,6 +223,35 @@ void PropertyView::slotChangePropertyData(const App::Property& prop)
     }
 }
 
+void PropertyView::slotChangeObjectPropertyData(const App::DocumentObject& obj,
+                                                const App::Property& prop)
+{
+    // the replayed changes of a signal batch are handled at once in slotChangeSet()
+    App::Document* doc = obj.getDocument();
+    if (doc && doc->isReplayingSignalBatch())
+        return;
+    slotChangePropertyData(prop);
+}
+
+void PropertyView::slotChangeSet(const App::Document&, const App::DocumentChangeSet& changes)
+{
+    bool changed = false;
+    for (const auto& change : changes.changedObjects) {
+        if (propertyEditorData->propOwners.count(change.second->getContainer())) {
+            propertyEditorData->updateProperty(*change.second);
+            changed = true;
+        }
+    }
+    for (auto prop : changes.propertyEditorChanges) {
+        App::PropertyContainer* parent = prop->getContainer();
+        if (propertyEditorData->propOwners.count(parent)
+                || propertyEditorView->propOwners.count(parent))
+            changed = true;
+    }
+    if (changed)
+        timer->start(ViewParams::instance()->getPropertyViewTimer());
+}
+
 void PropertyView::slotChangePropertyView(const Gui::ViewProvider&, const App::Property& prop)
 {
     if (propertyEditorView->propOwners.count(prop.getContainer())) {
@@ -258,8 +290,10 @@ void PropertyView::slotRemoveDynamicProperty(const App::Property& prop)
     timer->start(ViewParams::instance()->getPropertyViewTimer());
 }
 
-void PropertyView::slotChangePropertyEditor(const App::Document &, const App::Property& prop)
+void PropertyView::slotChangePropertyEditor(const App::Document &doc, const App::Property& prop)
 {
+    if (doc.isReplayingSignalBatch())
+        return;
     App::PropertyContainer* parent = prop.getContainer();
     if (propertyEditorData->propOwners.count(parent)
             || propertyEditorView->propOwners.count(parent))
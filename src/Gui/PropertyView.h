@@ -34,6 +34,7 @@ namespace App {
   class Property;
   class PropertyContainer;
   class DocumentObject;
+  struct DocumentChangeSet;
 }
 
 namespace Gui {
@@ -79,6 +80,8 @@ protected:
 private:
     void onSelectionChanged(const SelectionChanges& msg) override;
     void slotChangePropertyData(const App::Property&);
+    void slotChangeObjectPropertyData(const App::DocumentObject&, const App::Property&);
+    void slotChangeSet(const App::Document&, const App::DocumentChangeSet&);
     void slotChangePropertyView(const Gui::ViewProvider&, const App::Property&);
     void slotAppendDynamicProperty(const App::Property&);
     void slotRemoveDynamicProperty(const App::Property&);
@@ -107,6 +110,7 @@ private:
     Connection connectDelObject;
     Connection connectDelViewObject;
     Connection connectChangedDocument;
+    Connection connectChangeSet;
     QTabWidget* tabs;
     QTimer* timer;
     bool updating = false;
@@ -26,7 +26,10 @@
 #define BOOST_GEOMETRY_DISABLE_DEPRECATED_03_WARNING
 
 #ifndef _PreComp_
+# include <atomic>
 # include <cfloat>
+# include <future>
+# include <thread>
 
 # include <boost_geometry.hpp>
 # include <boost/geometry/geometries/register/point.hpp>
@@ -39,6 +42,7 @@
 # include <BRepAdaptor_Curve.hxx>
 # include <BRepAdaptor_Surface.hxx>
 # include <BRepBndLib.hxx>
+# include <BRepBuilderAPI_Copy.hxx>
 # include <BRepBuilderAPI_MakeEdge.hxx>
 # include <BRepBuilderAPI_MakeFace.hxx>
 # include <BRepBuilderAPI_MakeVertex.hxx>
@@ -1666,32 +1670,18 @@ std::vector<shared_ptr<Area> > Area::makeSections(
     bool can_retry = fabs(tolerance) > Precision::Confusion();
     TopLoc_Location locInverse(loc.Inverted());
 
-    for (size_t i = 0; i < heights.size(); ++i) {
-        double z = heights[i];
+    // Slices the shapes at the height of section i. If the section is empty the height is
+    // moved by the tolerance and the slicing is retried once. Returns the sliced shapes and
+    // the final height.
+    auto sliceShapes = [&](const std::list<Shape>& shapes, size_t i, double& z) {
+        std::list<Shape> result;
         bool retried = !can_retry;
         while (true) {
             gp_Pln pln(gp_Pnt(0, 0, z), gp_Dir(0, 0, 1));
             Standard_Real a, b, c, d;
             pln.Coefficients(a, b, c, d);
-            BRepLib_MakeFace mkFace(pln, xMin, xMax, yMin, yMax);
-            const TopoDS_Shape& face = mkFace.Face();
-
-            shared_ptr<Area> area(std::make_shared<Area>(&myParams));
-            area->myParams.Outline = false;
-            area->setPlane(face.Moved(locInverse));
-
-            if (project) {
-                for (const auto& s : projectedShapes) {
-                    gp_Trsf t;
-                    t.SetTranslation(gp_Vec(0, 0, -d));
-                    TopLoc_Location wloc(t);
-                    area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
-                }
-                sections.push_back(area);
-                break;
-            }
 
-            for (auto it = myShapes.begin(); it != myShapes.end(); ++it) {
+            for (auto it = shapes.begin(); it != shapes.end(); ++it) {
                 const auto& s = *it;
                 BRep_Builder builder;
                 TopoDS_Compound comp;
@@ -1745,11 +1735,11 @@ std::vector<shared_ptr<Area> > Area::makeSections(
                 if (TopExp_Explorer(comp, TopAbs_EDGE).More()) {
                     const TopoDS_Shape& shape = comp.Moved(locInverse);
                     showShape(shape, nullptr, "section_%u_result", i);
-                    area->add(shape, s.op);
+                    result.emplace_back(s.op, shape);
                 }
-                else if (area->myShapes.empty()) {
+                else if (result.empty()) {
                     auto itNext = it;
-                    if (++itNext != myShapes.end() &&
+                    if (++itNext != shapes.end() &&
                         (itNext->op == OperationIntersection ||
                             itNext->op == OperationDifference))
                     {
@@ -1757,12 +1747,8 @@ std::vector<shared_ptr<Area> > Area::makeSections(
                     }
                 }
             }
-            if (!area->myShapes.empty()) {
-                sections.push_back(area);
-                FC_TIME_LOG(t1, "makeSection " << z);
-                showShape(area->getShape(), nullptr, "section_%u_final", i);
+            if (!result.empty())
                 break;
-            }
             if (retried) {
                 AREA_WARN("Discard empty section");
                 break;
@@ -1773,6 +1759,77 @@ std::vector<shared_ptr<Area> > Area::makeSections(
                 retried = true;
             }
         }
+        return result;
+    };
+
+    // The heights are independent of each other and are sliced in parallel. Each thread works
+    // on its own copy of the shapes because the boolean operations of the slicing may update
+    // the tolerances of the input shapes. The results are stored per height to keep the order
+    // of the sections. Showing the intermediate shapes for debugging requires the main thread.
+    std::vector<double> sectionHeights(heights);
+    std::vector<std::list<Shape>> sectionShapes(heights.size());
+    if (!project) {
+        size_t numThreads = std::min<size_t>(std::thread::hardware_concurrency(), heights.size());
+        if (numThreads < 2 || FC_LOG_INSTANCE.level() > FC_LOGLEVEL_TRACE) {
+            for (size_t i = 0; i < heights.size(); ++i)
+                sectionShapes[i] = sliceShapes(myShapes, i, sectionHeights[i]);
+        }
+        else {
+            std::atomic<size_t> nextHeight(0);
+            std::atomic<bool> failed(false);
+            auto worker = [&]() {
+                try {
+                    std::list<Shape> shapes;
+                    for (const Shape& s : myShapes)
+                        shapes.emplace_back(s.op, BRepBuilderAPI_Copy(s.shape).Shape());
+                    for (size_t i = nextHeight++; i < heights.size() && !failed; i = nextHeight++)
+                        sectionShapes[i] = sliceShapes(shapes, i, sectionHeights[i]);
+                }
+                catch (...) {
+                    failed = true;
+                    throw;
+                }
+            };
+
+            std::vector<std::future<void>> futures;
+            for (size_t i = 0; i < numThreads; ++i)
+                futures.push_back(std::async(std::launch::async, worker));
+            for (auto& future : futures)
+                future.get();
+        }
+    }
+
+    for (size_t i = 0; i < heights.size(); ++i) {
+        double z = sectionHeights[i];
+        if (!project && sectionShapes[i].empty())
+            continue;
+
+        gp_Pln pln(gp_Pnt(0, 0, z), gp_Dir(0, 0, 1));
+        Standard_Real a, b, c, d;
+        pln.Coefficients(a, b, c, d);
+        BRepLib_MakeFace mkFace(pln, xMin, xMax, yMin, yMax);
+        const TopoDS_Shape& face = mkFace.Face();
+
+        shared_ptr<Area> area(std::make_shared<Area>(&myParams));
+        area->myParams.Outline = false;
+        area->setPlane(face.Moved(locInverse));
+
+        if (project) {
+            for (const auto& s : projectedShapes) {
+                gp_Trsf t;
+                t.SetTranslation(gp_Vec(0, 0, -d));
+                TopLoc_Location wloc(t);
+                area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
+            }
+            sections.push_back(area);
+            continue;
+        }
+
+        for (const auto& s : sectionShapes[i])
+            area->add(s.shape, s.op);
+        sections.push_back(area);
+        FC_TIME_LOG(t1, "makeSection " << z);
+        showShape(area->getShape(), nullptr, "section_%u_final", i);
     }
     FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
     return sections;
@@ -137,64 +137,73 @@ std::string Command::toGCode (int precision, bool padzero) const
 
 void Command::setFromGCode (const std::string& str)
 {
+    setFromGCode(str.data(), str.data() + str.size());
+}
+
+static inline char toUpper(char ch)
+{
+    return static_cast<char>(toupper(static_cast<unsigned char>(ch)));
+}
+
+void Command::setFromGCode (const char* begin, const char* end)
+{
+    enum class Mode { None, Command, Argument, Comment };
+
     Parameters.clear();
-    std::string mode = "none";
-    std::string key;
+    Mode mode = Mode::None;
+    char key = 0;
     std::string value;
-    for (unsigned int i=0; i < str.size(); i++) {
-        if ( (isdigit(str[i])) || (str[i] == '-') || (str[i] == '.') ) {
-            value += str[i];
-        } else if (isalpha(str[i])) {
-            if (mode == "command") {
-                if (!key.empty() && !value.empty()) {
-                    std::string cmd = key + value;
-                    boost::to_upper(cmd);
-                    Name = cmd;
-                    key = "";
-                    value = "";
-                    mode = "argument";
+    for (const char* it = begin; it != end; ++it) {
+        char ch = *it;
+        int uch = static_cast<unsigned char>(ch);
+        if ( (isdigit(uch)) || (ch == '-') || (ch == '.') ) {
+            value += ch;
+        } else if (isalpha(uch)) {
+            if (mode == Mode::Command) {
+                if (key && !value.empty()) {
+                    // the value only consists of digits, '-' and '.'
+                    Name = toUpper(key);
+                    Name += value;
+                    key = 0;
+                    value.clear();
                 } else {
                     throw Base::BadFormatError("Badly formatted GCode command");
                 }
-                mode = "argument";
-            } else if (mode == "none") {
-                mode = "command";
-            } else if (mode == "argument") {
-                if (!key.empty() && !value.empty()) {
+                mode = Mode::Argument;
+            } else if (mode == Mode::None) {
+                mode = Mode::Command;
+            } else if (mode == Mode::Argument) {
+                if (key && !value.empty()) {
                     double val = std::atof(value.c_str());
-                    boost::to_upper(key);
-                    Parameters[key] = val;
-                    key = "";
-                    value = "";
+                    Parameters[std::string(1, toUpper(key))] = val;
+                    key = 0;
+                    value.clear();
                 } else {
                     throw Base::BadFormatError("Badly formatted GCode argument");
                 }
-            } else if (mode == "comment") {
-                value += str[i];
+            } else if (mode == Mode::Comment) {
+                value += ch;
             }
-            key = str[i];
-        } else if (str[i] == '(') {
-            mode = "comment";
-        } else if (str[i] == ')') {
-            key = "(";
-            value += ")";
+            key = ch;
+        } else if (ch == '(') {
+            mode = Mode::Comment;
+        } else if (ch == ')') {
+            key = '(';
+            value += ')';
         } else {
             // add non-ascii characters only if this is a comment
-            if (mode == "comment") {
-                value += str[i];
+            if (mode == Mode::Comment) {
+                value += ch;
             }
         }
     }
-    if (!key.empty() && !value.empty()) {
-        if ( (mode == "command") || (mode == "comment") ) {
-            std::string cmd = key + value;
-            if (mode == "command")
-                boost::to_upper(cmd);
-            Name = cmd;
+    if (key && !value.empty()) {
+        if ( (mode == Mode::Command) || (mode == Mode::Comment) ) {
+            Name = mode == Mode::Command ? toUpper(key) : key;
+            Name += value;
         } else {
             double val = std::atof(value.c_str());
-            boost::to_upper(key);
-            Parameters[key] = val;
+            Parameters[std::string(1, toUpper(key))] = val;
         }
     } else {
         throw Base::BadFormatError("Badly formatted GCode argument");
@@ -55,6 +55,7 @@ namespace Path
         void setCenter(const Base::Vector3d&, bool clockwise=true); // sets the center coordinates and the command name
         std::string toGCode (int precision=6, bool padzero=true) const; // returns a GCode string representation of the command
         void setFromGCode (const std::string&); // sets the parameters from the contents of the given GCode string
+        void setFromGCode (const char* begin, const char* end); // same as above for the characters in [begin, end)
         void setFromPlacement (const Base::Placement&); // sets the parameters from the contents of the given placement
         bool has(const std::string&) const; // returns true if the given string exists in the parameters
         Command transform(const Base::Placement&); // returns a transformed copy of this command
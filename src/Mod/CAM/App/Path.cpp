@@ -21,9 +21,15 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+# include <algorithm>
+# include <memory>
+# include <set>
+#endif
 
 #include <App/Application.h>
 #include <Base/Console.h>
+#include <Base/Exception.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/Writer.h>
@@ -274,10 +280,16 @@ Base::BoundBox3d Toolpath::getBoundBox() const
     return visitor.bb;
 }
 
-static void bulkAddCommand(const std::string &gcodestr, std::vector<Command*> &commands, bool &inches)
+static void bulkAddCommand(const char *begin, const char *end, std::vector<Command*> &commands, bool &inches)
 {
     Command *cmd = new Command();
-    cmd->setFromGCode(gcodestr);
+    try {
+        cmd->setFromGCode(begin, end);
+    }
+    catch (...) {
+        delete cmd;
+        throw;
+    }
     if ("G20" == cmd->Name) {
         inches = true;
         delete cmd;
@@ -292,54 +304,58 @@ static void bulkAddCommand(const std::string &gcodestr, std::vector<Command*> &c
     }
 }
 
-void Toolpath::setFromGCode(const std::string instr)
+void Toolpath::setFromGCode(const std::string &str)
 {
     clear();
 
     // remove comments
     //boost::regex e("\\(.*?\\)");
     //std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
 
-    // split input string by () or G or M commands
-    std::string mode = "command";
+    // every command starts with G, M or (, so this gives the number of commands
+    // without parsing the string twice
+    std::size_t count = std::count_if(str.begin(), str.end(), [](char ch) {
+        return ch == 'G' || ch == 'g' || ch == 'M' || ch == 'm' || ch == '(';
+    });
+    vpcCommands.reserve(count);
+
+    // split input string by () or G or M commands. The commands are parsed in place
+    // without copying them into temporary strings
+    const char *data = str.data();
+    bool comment = false;
     std::size_t found = str.find_first_of("(gGmM");
-    int last = -1;
+    std::size_t last = std::string::npos;
     bool inches = false;
     while (found != std::string::npos)
     {
         if (str[found] == '(') {
             // start of comment
-            if ( (last > -1) && (mode == "command") ) {
+            if ( (last != std::string::npos) && !comment ) {
                 // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found-last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+                bulkAddCommand(data + last, data + found, vpcCommands, inches);
             }
-            mode = "comment";
+            comment = true;
             last = found;
             found = str.find_first_of(')', found+1);
         } else if (str[found] == ')') {
             // end of comment
-            std::string gcodestr = str.substr(last, found-last+1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-            last = -1;
+            bulkAddCommand(data + last, data + found + 1, vpcCommands, inches);
+            last = std::string::npos;
             found = str.find_first_of("(gGmM", found+1);
-            mode = "command";
-        } else if (mode == "command") {
+            comment = false;
+        } else if (!comment) {
             // command
-            if (last > -1) {
-                std::string gcodestr = str.substr(last, found-last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+            if (last != std::string::npos) {
+                bulkAddCommand(data + last, data + found, vpcCommands, inches);
             }
             last = found;
             found = str.find_first_of("(gGmM", found+1);
         }
     }
     // add the last command found, if any
-    if (last > -1) {
-        if (mode == "command") {
-            std::string gcodestr = str.substr(last,std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
+    if (last != std::string::npos) {
+        if (!comment) {
+            bulkAddCommand(data + last, data + str.size(), vpcCommands, inches);
         }
     }
     recalculate();
@@ -447,8 +463,13 @@ void Toolpath::Save (Writer &writer) const
         }
         writer.decInd();
     } else {
+        // the binary format gets its own file name and schema version so that it's never
+        // mistaken for G-code
+        bool binary = useBinaryFormat(vpcCommands);
+        std::string file = writer.ObjectName + (binary ? ".ncb" : ".nc");
+        int version = binary ? BinarySchemaVersion : SchemaVersion;
         writer.Stream() << writer.ind()
-            << "<Path file=\"" << writer.addFile((writer.ObjectName+".nc").c_str(), this) << "\" version=\"" << SchemaVersion << "\">" << std::endl;
+            << "<Path file=\"" << writer.addFile(file.c_str(), this) << "\" version=\"" << version << "\">" << std::endl;
         writer.incInd();
         saveCenter(writer, center);
         writer.decInd();
@@ -456,11 +477,155 @@ void Toolpath::Save (Writer &writer) const
     writer.Stream() << writer.ind() << "</Path>" << std::endl;
 }
 
+// The binary format starts with this tag followed by the table of command names, the table
+// of parameter names and the commands. A command is stored as the index of its name, a bit
+// mask of its parameters and the parameter values in the order of the parameter table.
+static const char binaryTag[] = "FCPATHB1";
+static const std::size_t binaryTagSize = sizeof(binaryTag) - 1;
+// the parameter mask has 64 bits
+static const std::size_t maxBinaryKeys = 64;
+// command and parameter names are short, longer strings can only come from a corrupted file
+static const uint32_t maxBinaryNameLength = 1024;
+
+static void writeString(Base::OutputStream &str, std::ostream &out, const std::string &s)
+{
+    str << static_cast<uint32_t>(s.size());
+    out.write(s.data(), static_cast<std::streamsize>(s.size()));
+}
+
+static uint32_t readCount(Base::InputStream &str, std::istream &in)
+{
+    uint32_t count = 0;
+    str >> count;
+    if (!in)
+        throw Base::BadFormatError("Truncated toolpath");
+    return count;
+}
+
+static std::string readString(Base::InputStream &str, std::istream &in)
+{
+    uint32_t size = readCount(str, in);
+    if (size > maxBinaryNameLength)
+        throw Base::BadFormatError("Invalid name in toolpath");
+    std::string s(size, '\0');
+    in.read(&s[0], size);
+    if (!in)
+        throw Base::BadFormatError("Truncated toolpath");
+    return s;
+}
+
+static bool useBinaryFormat(const std::vector<Command*> &commands)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/CAM");
+    if (!hGrp->GetBool("BinaryToolpathStorage", false))
+        return false;
+
+    // with more than 64 different parameter names the bit mask can't be used
+    std::set<std::string> keys;
+    for (const Command *cmd : commands) {
+        for (const auto &it : cmd->Parameters)
+            keys.insert(it.first);
+    }
+    return keys.size() <= maxBinaryKeys;
+}
+
+void Toolpath::saveBinary(std::ostream &out) const
+{
+    // build the tables of names
+    std::map<std::string, uint32_t> names;
+    std::map<std::string, uint32_t> keys;
+    for (const Command *cmd : vpcCommands) {
+        names.emplace(cmd->Name, 0);
+        for (const auto &it : cmd->Parameters)
+            keys.emplace(it.first, 0);
+    }
+    uint32_t index = 0;
+    for (auto &it : names)
+        it.second = index++;
+    index = 0;
+    for (auto &it : keys)
+        it.second = index++;
+
+    Base::OutputStream str(out);
+    out.write(binaryTag, binaryTagSize);
+    str << static_cast<uint32_t>(names.size());
+    for (const auto &it : names)
+        writeString(str, out, it.first);
+    str << static_cast<uint32_t>(keys.size());
+    for (const auto &it : keys)
+        writeString(str, out, it.first);
+
+    str << static_cast<uint32_t>(vpcCommands.size());
+    for (const Command *cmd : vpcCommands) {
+        uint64_t mask = 0;
+        for (const auto &it : cmd->Parameters)
+            mask |= uint64_t(1) << keys[it.first];
+        str << names[cmd->Name] << mask;
+        // the parameters and the key table have the same sort order
+        for (const auto &it : cmd->Parameters)
+            str << it.second;
+    }
+}
+
+void Toolpath::restoreBinary(std::istream &in)
+{
+    // The counts aren't trusted to reserve memory as they may come from a corrupted file.
+    // The commands are only taken over if the whole file could be read.
+    Base::InputStream str(in);
+    uint32_t count = readCount(str, in);
+    std::vector<std::string> names;
+    for (uint32_t i = 0; i < count; i++)
+        names.push_back(readString(str, in));
+    count = readCount(str, in);
+    if (count > maxBinaryKeys)
+        throw Base::BadFormatError("Too many parameter names in toolpath");
+    std::vector<std::string> keys;
+    for (uint32_t i = 0; i < count; i++)
+        keys.push_back(readString(str, in));
+
+    count = readCount(str, in);
+    std::vector<std::unique_ptr<Command>> commands;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t name = 0;
+        uint64_t mask = 0;
+        str >> name >> mask;
+        if (!in)
+            throw Base::BadFormatError("Truncated toolpath");
+        if (name >= names.size() || (keys.size() < maxBinaryKeys && (mask >> keys.size()) != 0))
+            throw Base::BadFormatError("Invalid command in toolpath");
+
+        auto cmd = std::make_unique<Command>();
+        cmd->Name = names[name];
+        for (std::size_t key = 0; key < keys.size(); key++) {
+            if (mask & (uint64_t(1) << key)) {
+                double value = 0;
+                str >> value;
+                cmd->Parameters.emplace_hint(cmd->Parameters.end(), keys[key], value);
+            }
+        }
+        if (!in)
+            throw Base::BadFormatError("Truncated toolpath");
+        commands.push_back(std::move(cmd));
+    }
+
+    vpcCommands.reserve(commands.size());
+    for (auto &cmd : commands)
+        vpcCommands.push_back(cmd.release());
+}
+
 void Toolpath::SaveDocFile (Base::Writer &writer) const
 {
-    if (toGCode().empty())
+    if (vpcCommands.empty())
         return;
-    writer.Stream() << toGCode();
+
+    if (useBinaryFormat(vpcCommands)) {
+        saveBinary(writer.Stream());
+        return;
+    }
+
+    std::ostream &out = writer.Stream();
+    for (const Command *cmd : vpcCommands)
+        out << cmd->toGCode() << '\n';
 }
 
 void Toolpath::Restore(XMLReader &reader)
@@ -476,14 +641,55 @@ void Toolpath::Restore(XMLReader &reader)
 
 void Toolpath::RestoreDocFile(Base::Reader &reader)
 {
+    clear();
+
+    char buffer[4096];
+    reader.read(buffer, binaryTagSize);
+    std::streamsize size = reader.gcount();
+    if (size == static_cast<std::streamsize>(binaryTagSize) &&
+        std::equal(buffer, buffer + binaryTagSize, binaryTag)) {
+        try {
+            restoreBinary(reader);
+        }
+        catch (const Base::BadFormatError &e) {
+            // keep the toolpath empty instead of restoring a part of it
+            Base::Console().Error("Failed to read toolpath from %s: %s\n",
+                                  reader.getFileName().c_str(), e.what());
+        }
+        recalculate();
+        return;
+    }
+
+    std::string file = reader.getFileName();
+    if (file.size() > 4 && file.compare(file.size() - 4, 4, ".ncb") == 0) {
+        Base::Console().Error("Failed to read toolpath from %s: Not a binary toolpath\n",
+                              file.c_str());
+        recalculate();
+        return;
+    }
+
+    // Read the G-code in blocks. Runs of white space are replaced by a single blank as
+    // the G-code was formerly read word by word.
     std::string gcode;
-    std::string line;
-    while (reader >> line) {
-        gcode += line;
-        gcode += " ";
+    bool blank = false;
+    do {
+        for (std::streamsize i = 0; i < size; i++) {
+            char ch = buffer[i];
+            if (isspace(static_cast<unsigned char>(ch))) {
+                blank = true;
+                continue;
+            }
+            if (blank && !gcode.empty())
+                gcode += ' ';
+            blank = false;
+            gcode += ch;
+        }
+        reader.read(buffer, sizeof(buffer));
+        size = reader.gcount();
     }
-    setFromGCode(gcode);
+    while (size > 0);
 
+    setFromGCode(gcode);
 }
 
 
@@ -61,7 +61,7 @@ namespace Path
             double getLength(); // return the Length (mm) of the Path
             double getCycleTime(double, double, double, double); // return the Cycle Time (s) of the Path
             void recalculate(); // recalculates the points
-            void setFromGCode(const std::string); // sets the path from the contents of the given GCode string
+            void setFromGCode(const std::string&); // sets the path from the contents of the given GCode string
             std::string toGCode() const; // gets a gcode string representation from the Path
             Base::BoundBox3d getBoundBox() const;
 
@@ -75,8 +75,13 @@ namespace Path
             void setCenter(const Base::Vector3d &c);
 
             static const int SchemaVersion = 2;
+            // the version of documents with the binary toolpath format
+            static const int BinarySchemaVersion = 3;
 
         protected:
+            void saveBinary(std::ostream&) const;
+            void restoreBinary(std::istream&);
+
             std::vector<Command*> vpcCommands;
             Base::Vector3d center;
             //KDL::Path_Composite *pcPath;
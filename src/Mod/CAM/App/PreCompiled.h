@@ -43,11 +43,17 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
+#include <future>
 #include <iomanip>
 #include <map>
+#include <memory>
+#include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Boost
@@ -64,6 +70,7 @@
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
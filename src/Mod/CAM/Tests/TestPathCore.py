@@ -20,6 +20,10 @@
 # *                                                                         *
 # ***************************************************************************
 
+import os
+import tempfile
+import zipfile
+
 import FreeCAD
 import Path
 from Tests.PathTestUtils import PathTestBase
@@ -138,3 +142,80 @@ G0 Z0.500000
         path = Path.Path(commands)
 
         self.assertEqual(path.Length, 2)
+
+    def saveToolpath(self, binary):
+        """Save a document with a toolpath and return the file name"""
+        param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/CAM")
+        old = param.GetBool("BinaryToolpathStorage", False)
+        param.SetBool("BinaryToolpathStorage", binary)
+        try:
+            doc = FreeCAD.newDocument("TestToolpathStorage")
+            obj = doc.addObject("Path::Feature", "Toolpath")
+            obj.Path = self.toolpath
+            fileName = os.path.join(tempfile.gettempdir(), "TestToolpathStorage.FCStd")
+            doc.saveAs(fileName)
+            FreeCAD.closeDocument(doc.Name)
+        finally:
+            param.SetBool("BinaryToolpathStorage", old)
+        return fileName
+
+    def restoreToolpath(self, fileName):
+        """Open the document and return the restored toolpath"""
+        doc = FreeCAD.openDocument(fileName)
+        path = doc.getObject("Toolpath").Path
+        FreeCAD.closeDocument(doc.Name)
+        return path
+
+    def setUpToolpath(self):
+        self.toolpath = Path.Path()
+        self.toolpath.setFromGCode(
+            "G0 X1 Y2.5 Z10\nM03 S3000\nG1 X-1.25 F120\nG2 X0 Y0 I1 J-0.5\n(done)\nM05"
+        )
+
+    def test60(self):
+        """Test saving and restoring a toolpath as G-code"""
+        self.setUpToolpath()
+        fileName = self.saveToolpath(False)
+        with zipfile.ZipFile(fileName) as zf:
+            self.assertIn("Toolpath.nc", zf.namelist())
+            xml = zf.read("Document.xml").decode()
+            self.assertIn('<Path file="Toolpath.nc" version="2">', xml)
+
+        path = self.restoreToolpath(fileName)
+        self.assertEqual(path.toGCode(), self.toolpath.toGCode())
+        os.remove(fileName)
+
+    def test61(self):
+        """Test saving and restoring a toolpath in the binary format"""
+        self.setUpToolpath()
+        fileName = self.saveToolpath(True)
+        with zipfile.ZipFile(fileName) as zf:
+            self.assertIn("Toolpath.ncb", zf.namelist())
+            self.assertNotIn("Toolpath.nc", zf.namelist())
+            self.assertTrue(zf.read("Toolpath.ncb").startswith(b"FCPATHB1"))
+            xml = zf.read("Document.xml").decode()
+            self.assertIn('<Path file="Toolpath.ncb" version="3">', xml)
+
+        path = self.restoreToolpath(fileName)
+        self.assertEqual(len(path.Commands), len(self.toolpath.Commands))
+        for restored, command in zip(path.Commands, self.toolpath.Commands):
+            self.assertEqual(restored.Name, command.Name)
+            self.assertEqual(restored.Parameters, command.Parameters)
+        os.remove(fileName)
+
+    def test62(self):
+        """Test that a truncated binary toolpath isn't restored partially"""
+        self.setUpToolpath()
+        fileName = self.saveToolpath(True)
+        truncated = os.path.join(tempfile.gettempdir(), "TestToolpathTruncated.FCStd")
+        with zipfile.ZipFile(fileName) as src, zipfile.ZipFile(truncated, "w") as dst:
+            for name in src.namelist():
+                data = src.read(name)
+                if name == "Toolpath.ncb":
+                    data = data[: len(data) - 5]
+                dst.writestr(name, data)
+
+        path = self.restoreToolpath(truncated)
+        self.assertEqual(len(path.Commands), 0)
+        os.remove(fileName)
+        os.remove(truncated)
@@ -25,10 +25,12 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
@@ -38,22 +40,12 @@
 #include <vtkDataSetReader.h>
 #include <vtkDataSetWriter.h>
 #include <vtkDoubleArray.h>
-#include <vtkHexahedron.h>
 #include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
 #include <vtkPointData.h>
-#include <vtkPyramid.h>
-#include <vtkQuad.h>
-#include <vtkQuadraticHexahedron.h>
-#include <vtkQuadraticPyramid.h>
-#include <vtkQuadraticQuad.h>
-#include <vtkQuadraticTetra.h>
-#include <vtkQuadraticTriangle.h>
-#include <vtkQuadraticWedge.h>
-#include <vtkTetra.h>
-#include <vtkTriangle.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkUnstructuredGrid.h>
-#include <vtkWedge.h>
+#include <vtkVersionMacros.h>
 #include <vtkXMLPUnstructuredGridReader.h>
 #include <vtkXMLUnstructuredGridReader.h>
 #include <vtkXMLUnstructuredGridWriter.h>
@@ -100,34 +92,75 @@ void writeVTKFile(const char* filename, vtkSmartPointer<vtkUnstructuredGrid> dat
 namespace
 {
 
-// Helper function to fill vtkCellArray from SMDS_Mesh using vtk cell order
-template<typename T, typename E>
-void fillVtkArray(vtkSmartPointer<vtkCellArray>& elemArray, std::vector<int>& types, const E* elem)
+// Helper class to collect the cells of a SMDS_Mesh in the flat layout of vtkCellArray,
+// using vtk cell order
+class VtkCellBuffer
 {
-    vtkSmartPointer<T> cell = vtkSmartPointer<T>::New();
-    const std::vector<int>& order = SMDS_MeshCell::toVtkOrder(elem->GetEntityType());
-    if (!order.empty()) {
-        for (int i = 0; i < elem->NbNodes(); ++i) {
-            cell->GetPointIds()->SetId(i, elem->GetNode(order[i])->GetID() - 1);
+public:
+    explicit VtkCellBuffer(std::size_t numCells)
+    {
+        offsets.reserve(numCells + 1);
+        offsets.push_back(0);
+        types.reserve(numCells);
+    }
+
+    void add(const SMDS_MeshElement* elem)
+    {
+        const std::vector<int>& order = SMDS_MeshCell::toVtkOrder(elem->GetEntityType());
+        const int nbNodes = elem->NbNodes();
+        for (int i = 0; i < nbNodes; ++i) {
+            const SMDS_MeshNode* node = elem->GetNode(order.empty() ? i : order[i]);
+            connectivity.push_back(node->GetID() - 1);
         }
+        offsets.push_back(vtkIdType(connectivity.size()));
+        types.push_back(SMDS_MeshCell::toVtkType(elem->GetEntityType()));
     }
-    else {
-        for (int i = 0; i < elem->NbNodes(); ++i) {
-            cell->GetPointIds()->SetId(i, elem->GetNode(i)->GetID() - 1);
+
+    void setCells(vtkSmartPointer<vtkUnstructuredGrid>& grid)
+    {
+        if (types.empty()) {
+            return;
         }
+
+        vtkSmartPointer<vtkCellArray> elemArray = vtkSmartPointer<vtkCellArray>::New();
+#if VTK_MAJOR_VERSION >= 9
+        elemArray->SetData(toIdTypeArray(offsets), toIdTypeArray(connectivity));
+#else
+        // legacy layout: the number of points followed by the points of each cell
+        std::vector<vtkIdType> legacy;
+        legacy.reserve(types.size() + connectivity.size());
+        for (std::size_t i = 0; i < types.size(); ++i) {
+            legacy.push_back(offsets[i + 1] - offsets[i]);
+            legacy.insert(legacy.end(),
+                          connectivity.begin() + offsets[i],
+                          connectivity.begin() + offsets[i + 1]);
+        }
+        elemArray->SetCells(vtkIdType(types.size()), toIdTypeArray(legacy));
+#endif
+        grid->SetCells(types.data(), elemArray);
     }
-    elemArray->InsertNextCell(cell);
-    types.push_back(SMDS_MeshCell::toVtkType(elem->GetEntityType()));
-}
 
-// Helper function to fill SMDS_Mesh elements ID from vtk cell
-void fillMeshElementIds(vtkCell* cell, std::vector<int>& ids)
+private:
+    static vtkSmartPointer<vtkIdTypeArray> toIdTypeArray(const std::vector<vtkIdType>& values)
+    {
+        vtkSmartPointer<vtkIdTypeArray> array = vtkSmartPointer<vtkIdTypeArray>::New();
+        array->SetNumberOfValues(vtkIdType(values.size()));
+        std::copy(values.begin(), values.end(), array->GetPointer(0));
+        return array;
+    }
+
+    std::vector<vtkIdType> offsets;
+    std::vector<vtkIdType> connectivity;
+    std::vector<int> types;
+};
+
+// Helper function to fill SMDS_Mesh elements ID from the points of a vtk cell
+void fillMeshElementIds(int cellType, vtkIdList* pointIds, std::vector<int>& ids)
 {
-    VTKCellType cellType = static_cast<VTKCellType>(cell->GetCellType());
-    const std::vector<int>& order = SMDS_MeshCell::fromVtkOrder(cellType);
-    vtkIdType* vtkIds = cell->GetPointIds()->GetPointer(0);
-    ids.clear();
-    int nbPoints = cell->GetNumberOfPoints();
+    const std::vector<int>& order =
+        SMDS_MeshCell::fromVtkOrder(static_cast<VTKCellType>(cellType));
+    vtkIdType* vtkIds = pointIds->GetPointer(0);
+    int nbPoints = pointIds->GetNumberOfIds();
     ids.resize(nbPoints);
     if (!order.empty()) {
         for (int i = 0; i < nbPoints; ++i) {
@@ -157,15 +190,19 @@ void FemVTKTools::importVTKMesh(vtkSmartPointer<vtkDataSet> dataset, FemMesh* me
     meshds->ClearMesh();
 
     for (vtkIdType i = 0; i < nPoints; i++) {
-        double* p = dataset->GetPoint(i);
+        double p[3];
+        dataset->GetPoint(i, p);
         meshds->AddNodeWithID(p[0] * scale, p[1] * scale, p[2] * scale, i + 1);
     }
 
+    // query the points of the cells without building a vtkCell for each of them
+    vtkSmartPointer<vtkIdList> pointIds = vtkSmartPointer<vtkIdList>::New();
+    std::vector<int> ids;
     for (vtkIdType iCell = 0; iCell < nCells; iCell++) {
-        vtkCell* cell = dataset->GetCell(iCell);
-        std::vector<int> ids;
-        fillMeshElementIds(cell, ids);
-        switch (cell->GetCellType()) {
+        const int cellType = dataset->GetCellType(iCell);
+        dataset->GetCellPoints(iCell, pointIds);
+        fillMeshElementIds(cellType, pointIds, ids);
+        switch (cellType) {
             // 2D faces
             case VTK_TRIANGLE:  // tria3
                 meshds->AddFaceWithID(ids[0], ids[1], ids[2], iCell + 1);
@@ -331,86 +368,59 @@ FemMesh* FemVTKTools::readVTKMesh(const char* filename, FemMesh* mesh)
 }
 
 void exportFemMeshFaces(vtkSmartPointer<vtkUnstructuredGrid> grid,
-                        const SMDS_FaceIteratorPtr& aFaceIter)
+                        const SMDS_FaceIteratorPtr& aFaceIter,
+                        std::size_t numFaces)
 {
     Base::Console().Log("  Start: VTK mesh builder faces.\n");
 
-    vtkSmartPointer<vtkCellArray> elemArray = vtkSmartPointer<vtkCellArray>::New();
-    std::vector<int> types;
+    VtkCellBuffer cells(numFaces);
 
     while (aFaceIter->more()) {
         const SMDS_MeshFace* aFace = aFaceIter->next();
-        // triangle
-        if (aFace->GetEntityType() == SMDSEntity_Triangle) {
-            fillVtkArray<vtkTriangle>(elemArray, types, aFace);
-        }
-        // quad
-        else if (aFace->GetEntityType() == SMDSEntity_Quadrangle) {
-            fillVtkArray<vtkQuad>(elemArray, types, aFace);
-        }
-        // quadratic triangle
-        else if (aFace->GetEntityType() == SMDSEntity_Quad_Triangle) {
-            fillVtkArray<vtkQuadraticTriangle>(elemArray, types, aFace);
-        }
-        // quadratic quad
-        else if (aFace->GetEntityType() == SMDSEntity_Quad_Quadrangle) {
-            fillVtkArray<vtkQuadraticQuad>(elemArray, types, aFace);
-        }
-        else {
-            throw Base::TypeError("Face not yet supported by FreeCAD's VTK mesh builder\n");
+        switch (aFace->GetEntityType()) {
+            case SMDSEntity_Triangle:
+            case SMDSEntity_Quadrangle:
+            case SMDSEntity_Quad_Triangle:
+            case SMDSEntity_Quad_Quadrangle:
+                cells.add(aFace);
+                break;
+            default:
+                throw Base::TypeError("Face not yet supported by FreeCAD's VTK mesh builder\n");
         }
     }
 
-    if (elemArray->GetNumberOfCells() > 0) {
-        grid->SetCells(types.data(), elemArray);
-    }
+    cells.setCells(grid);
 
     Base::Console().Log("  End: VTK mesh builder faces.\n");
 }
 
 void exportFemMeshCells(vtkSmartPointer<vtkUnstructuredGrid> grid,
-                        const SMDS_VolumeIteratorPtr& aVolIter)
+                        const SMDS_VolumeIteratorPtr& aVolIter,
+                        std::size_t numVolumes)
 {
     Base::Console().Log("  Start: VTK mesh builder volumes.\n");
 
-    vtkSmartPointer<vtkCellArray> elemArray = vtkSmartPointer<vtkCellArray>::New();
-    std::vector<int> types;
+    VtkCellBuffer cells(numVolumes);
 
     while (aVolIter->more()) {
         const SMDS_MeshVolume* aVol = aVolIter->next();
-
-        if (aVol->GetEntityType() == SMDSEntity_Tetra) {  // tetra4
-            fillVtkArray<vtkTetra>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Pyramid) {  // pyra5
-            fillVtkArray<vtkPyramid>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Penta) {  // penta6
-            fillVtkArray<vtkWedge>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Hexa) {  // hexa8
-            fillVtkArray<vtkHexahedron>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Quad_Tetra) {  // tetra10
-            fillVtkArray<vtkQuadraticTetra>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Quad_Pyramid) {  // pyra13
-            fillVtkArray<vtkQuadraticPyramid>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Quad_Penta) {  // penta15
-            fillVtkArray<vtkQuadraticWedge>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Quad_Hexa) {  // hexa20
-            fillVtkArray<vtkQuadraticHexahedron>(elemArray, types, aVol);
-        }
-        else {
-            throw Base::TypeError("Volume not yet supported by FreeCAD's VTK mesh builder\n");
+        switch (aVol->GetEntityType()) {
+            case SMDSEntity_Tetra:         // tetra4
+            case SMDSEntity_Pyramid:       // pyra5
+            case SMDSEntity_Penta:         // penta6
+            case SMDSEntity_Hexa:          // hexa8
+            case SMDSEntity_Quad_Tetra:    // tetra10
+            case SMDSEntity_Quad_Pyramid:  // pyra13
+            case SMDSEntity_Quad_Penta:    // penta15
+            case SMDSEntity_Quad_Hexa:     // hexa20
+                cells.add(aVol);
+                break;
+            default:
+                throw Base::TypeError("Volume not yet supported by FreeCAD's VTK mesh builder\n");
         }
     }
 
-    if (elemArray->GetNumberOfCells() > 0) {
-        grid->SetCells(types.data(), elemArray);
-    }
+    cells.setCells(grid);
 
     Base::Console().Log("  End: VTK mesh builder volumes.\n");
 }
@@ -430,17 +440,30 @@ void FemVTKTools::exportVTKMesh(const FemMesh* mesh,
     vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
     SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
 
+    // memory is allocated by VTK points size for max node id, not for point count
+    // if the SMESH mesh has gaps in node numbering, points without any element
+    // assignment will be inserted in these point gaps too
+    // this needs to be taken into account on node mapping when FreeCAD FEM results
+    // are exported to vtk
+    std::vector<const SMDS_MeshNode*> nodes;
+    nodes.reserve(meshDS->NbNodes());
+    int maxId = 0;
     while (aNodeIter->more()) {
-        const SMDS_MeshNode* node = aNodeIter->next();  // why float, not double?
-        double coords[3] = {double(node->X() * scale),
-                            double(node->Y() * scale),
-                            double(node->Z() * scale)};
-        points->InsertPoint(node->GetID() - 1, coords);
-        // memory is allocated by VTK points size for max node id, not for point count
-        // if the SMESH mesh has gaps in node numbering, points without any element
-        // assignment will be inserted in these point gaps too
-        // this needs to be taken into account on node mapping when FreeCAD FEM results
-        // are exported to vtk
+        const SMDS_MeshNode* node = aNodeIter->next();
+        maxId = std::max(maxId, node->GetID());
+        nodes.push_back(node);
+    }
+
+    // allocate all points at once, the gaps are set to the origin
+    points->SetNumberOfPoints(maxId);
+    for (int i = 0; i < 3; ++i) {
+        points->GetData()->FillComponent(i, 0.0);
+    }
+    for (const SMDS_MeshNode* node : nodes) {  // why float, not double?
+        points->SetPoint(node->GetID() - 1,
+                         double(node->X() * scale),
+                         double(node->Y() * scale),
+                         double(node->Z() * scale));
     }
     grid->SetPoints(points);
     // nodes debugging
@@ -452,11 +475,11 @@ void FemVTKTools::exportVTKMesh(const FemMesh* mesh,
 
     // faces
     SMDS_FaceIteratorPtr aFaceIter = meshDS->facesIterator();
-    exportFemMeshFaces(grid, aFaceIter);
+    exportFemMeshFaces(grid, aFaceIter, info.NbFaces());
 
     // volumes
     SMDS_VolumeIteratorPtr aVolIter = meshDS->volumesIterator();
-    exportFemMeshCells(grid, aVolIter);
+    exportFemMeshCells(grid, aVolIter, info.NbVolumes());
 
     Base::Console().Log("End: VTK mesh builder ======================\n");
 }
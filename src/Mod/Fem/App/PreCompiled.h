@@ -160,6 +160,7 @@
 #include <vtkDoubleArray.h>
 #include <vtkHexahedron.h>
 #include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
 #include <vtkImageData.h>
 #include <vtkMultiBlockDataSet.h>
 #include <vtkMultiPieceDataSet.h>
@@ -179,6 +180,7 @@
 #include <vtkTriangle.h>
 #include <vtkUniformGrid.h>
 #include <vtkUnstructuredGrid.h>
+#include <vtkVersionMacros.h>
 #include <vtkWedge.h>
 #include <vtkXMLDataSetWriter.h>
 #include <vtkXMLImageDataReader.h>
@@ -82,6 +82,7 @@
 #include <QTextStream>
 #include <QThread>
 #include <QToolTip>
+#include <QtConcurrentMap>
 #include <qobject.h>
 
 // inventor
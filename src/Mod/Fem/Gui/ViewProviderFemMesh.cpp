@@ -42,12 +42,14 @@
 
 #include <sstream>
 
+#include <QThread>
+#include <QtConcurrentMap>
+
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
 #endif
 
 #include <App/DocumentObject.h>
-#include <Base/BoundBox.h>
 #include <Base/Console.h>
 #include <Base/TimeInfo.h>
 #include <Mod/Fem/App/FemMeshObject.h>
@@ -66,39 +68,33 @@ struct FemFace
     unsigned short Size;
     unsigned short FaceNo;
     bool hide;
-    Base::Vector3d getFirstNodePoint()
-    {
-        return Base::Vector3d(Nodes[0]->X(), Nodes[0]->Y(), Nodes[0]->Z());
-    }
 
-    Base::Vector3d set(short size,
-                       const SMDS_MeshElement* element,
-                       unsigned short id,
-                       short faceNo,
-                       const SMDS_MeshNode* n1,
-                       const SMDS_MeshNode* n2,
-                       const SMDS_MeshNode* n3,
-                       const SMDS_MeshNode* n4 = nullptr,
-                       const SMDS_MeshNode* n5 = nullptr,
-                       const SMDS_MeshNode* n6 = nullptr,
-                       const SMDS_MeshNode* n7 = nullptr,
-                       const SMDS_MeshNode* n8 = nullptr);
-
-    bool isSameFace(FemFace& face);
+    void set(short size,
+             const SMDS_MeshElement* element,
+             unsigned short id,
+             short faceNo,
+             const SMDS_MeshNode* n1,
+             const SMDS_MeshNode* n2,
+             const SMDS_MeshNode* n3,
+             const SMDS_MeshNode* n4 = nullptr,
+             const SMDS_MeshNode* n5 = nullptr,
+             const SMDS_MeshNode* n6 = nullptr,
+             const SMDS_MeshNode* n7 = nullptr,
+             const SMDS_MeshNode* n8 = nullptr);
 };
 
-Base::Vector3d FemFace::set(short size,
-                            const SMDS_MeshElement* element,
-                            unsigned short id,
-                            short faceNo,
-                            const SMDS_MeshNode* n1,
-                            const SMDS_MeshNode* n2,
-                            const SMDS_MeshNode* n3,
-                            const SMDS_MeshNode* n4,
-                            const SMDS_MeshNode* n5,
-                            const SMDS_MeshNode* n6,
-                            const SMDS_MeshNode* n7,
-                            const SMDS_MeshNode* n8)
+void FemFace::set(short size,
+                  const SMDS_MeshElement* element,
+                  unsigned short id,
+                  short faceNo,
+                  const SMDS_MeshNode* n1,
+                  const SMDS_MeshNode* n2,
+                  const SMDS_MeshNode* n3,
+                  const SMDS_MeshNode* n4,
+                  const SMDS_MeshNode* n5,
+                  const SMDS_MeshNode* n6,
+                  const SMDS_MeshNode* n7,
+                  const SMDS_MeshNode* n8)
 {
     Nodes[0] = n1;
     Nodes[1] = n2;
@@ -131,37 +127,128 @@ Base::Vector3d FemFace::set(short size,
             }
         }
     }
+}
+
+namespace
+{
 
-    return Base::Vector3d(Nodes[0]->X(), Nodes[0]->Y(), Nodes[0]->Z());
+// the nodes of the faces are sorted, so equal faces have the same nodes in the same order
+bool isLessFace(const FemFace* face1, const FemFace* face2)
+{
+    return std::lexicographical_compare(std::begin(face1->Nodes),
+                                        std::end(face1->Nodes),
+                                        std::begin(face2->Nodes),
+                                        std::end(face2->Nodes),
+                                        std::less<const SMDS_MeshNode*>());
 }
 
-class FemFaceGridItem: public std::vector<FemFace*>
+bool isSameFace(const FemFace* face1, const FemFace* face2)
 {
-public:
-    // FemFaceGridItem(void){reserve(200);}
-};
+    return std::equal(std::begin(face1->Nodes), std::end(face1->Nodes), std::begin(face2->Nodes));
+}
 
-bool FemFace::isSameFace(FemFace& face)
+// sort large sets of faces in blocks that are sorted in parallel and merged afterwards
+void sortFaces(std::vector<FemFace*>& faces)
 {
-    // the same element can not have the same face
-    if (face.ElementNumber == ElementNumber) {
-        return false;
+    using Block = std::pair<std::size_t, std::size_t>;
+    const std::size_t minBlockSize = 65536;
+    const std::size_t numThreads = std::max(QThread::idealThreadCount(), 1);
+    const std::size_t blockSize =
+        std::max(minBlockSize, (faces.size() + numThreads - 1) / numThreads);
+
+    std::vector<Block> blocks;
+    for (std::size_t begin = 0; begin < faces.size(); begin += blockSize) {
+        blocks.emplace_back(begin, std::min(begin + blockSize, faces.size()));
     }
-    if (face.Size != Size) {
-        return false;
+
+    auto sortBlock = [&faces](const Block& block) {
+        std::sort(faces.begin() + std::ptrdiff_t(block.first),
+                  faces.begin() + std::ptrdiff_t(block.second),
+                  isLessFace);
+    };
+    if (blocks.size() > 1) {
+        QtConcurrent::blockingMap(blocks, sortBlock);
     }
-    // if the same face size just compare if the sorted nodes are the same
-    if (Nodes[0] == face.Nodes[0] && Nodes[1] == face.Nodes[1] && Nodes[2] == face.Nodes[2]
-        && Nodes[3] == face.Nodes[3] && Nodes[4] == face.Nodes[4] && Nodes[5] == face.Nodes[5]
-        && Nodes[6] == face.Nodes[6] && Nodes[7] == face.Nodes[7]) {
-        hide = true;
-        face.hide = true;
-        return true;
+    else if (!blocks.empty()) {
+        sortBlock(blocks.front());
     }
 
-    return false;
+    for (std::size_t width = blockSize; width < faces.size(); width *= 2) {
+        for (std::size_t begin = 0; begin + width < faces.size(); begin += 2 * width) {
+            auto first = faces.begin() + std::ptrdiff_t(begin);
+            auto last = faces.begin() + std::ptrdiff_t(std::min(begin + 2 * width, faces.size()));
+            std::inplace_merge(first, first + std::ptrdiff_t(width), last, isLessFace);
+        }
+    }
+}
+
+// hide the faces that are shared by different elements, i.e. the faces inside the mesh
+void hideInnerFaces(std::vector<FemFace>& faces)
+{
+    std::vector<FemFace*> sorted;
+    sorted.reserve(faces.size());
+    for (auto& face : faces) {
+        sorted.push_back(&face);
+    }
+    sortFaces(sorted);
+
+    std::size_t end = 0;
+    for (std::size_t begin = 0; begin < sorted.size(); begin = end) {
+        bool shared = false;
+        for (end = begin + 1; end < sorted.size() && isSameFace(sorted[begin], sorted[end]);
+             end++) {
+            shared = shared || sorted[end]->ElementNumber != sorted[begin]->ElementNumber;
+        }
+        if (shared) {
+            for (std::size_t i = begin; i < end; i++) {
+                sorted[i]->hide = true;
+            }
+        }
+    }
 }
 
+// maps the nodes of the shown faces to the points of the coordinate node
+class NodeIndexMap
+{
+public:
+    void add(const SMDS_MeshNode* node)
+    {
+        nodes.push_back(node);
+    }
+
+    // the points are sorted by the address of the nodes
+    void build()
+    {
+        std::sort(nodes.begin(), nodes.end(), std::less<const SMDS_MeshNode*>());
+        nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+        int maxId = 0;
+        for (auto node : nodes) {
+            maxId = std::max(maxId, node->GetID());
+        }
+        index.assign(std::size_t(maxId) + 1, -1);
+        for (std::size_t i = 0; i < nodes.size(); i++) {
+            index[nodes[i]->GetID()] = int(i);
+        }
+    }
+
+    const std::vector<const SMDS_MeshNode*>& getNodes() const
+    {
+        return nodes;
+    }
+
+    int operator[](const SMDS_MeshNode* node) const
+    {
+        return index[node->GetID()];
+    }
+
+private:
+    std::vector<const SMDS_MeshNode*> nodes;
+    std::vector<int> index;  // by node id
+};
+
+}  // namespace
+
 // ----------------------------------------------------------------------------
 
 class ViewProviderFemMesh::Private
@@ -755,13 +842,13 @@ void ViewProviderFEMMeshBuilder::buildNodes(const App::Property* prop,
     }
 }
 
-inline void insEdgeVec(std::map<int, std::set<int>>& map, int n1, int n2)
+inline void insEdgeVec(std::vector<std::pair<int, int>>& edges, int n1, int n2)
 {
     // FIXME: The if-else distinction doesn't make sense
     // if (n1<n2)
-    //     map[n2].insert(n1);
+    //     edges.emplace_back(n2, n1);
     // else
-    map[n2].insert(n1);
+    edges.emplace_back(n2, n1);
 }
 
 inline unsigned long ElemFold(unsigned long Element, unsigned long FaceNbr)
@@ -836,7 +923,6 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
     Base::Console().Log("    %f: Start build up %i face helper\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()),
                         facesHelper.size());
-    Base::BoundBox3d BndBox;
 
     int i = 0;
 
@@ -849,52 +935,52 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
             switch (num) {
                 case 3:
                     // tria3 face = N1, N2, N3
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(2)));
+                    facesHelper[i++].set(3,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(2));
                     break;
                 case 4:
                     // quad4 face = N1, N2, N3, N4
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(3)));
+                    facesHelper[i++].set(4,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(2),
+                                         aFace->GetNode(3));
                     break;
                 case 6:
                     // tria6 face = N1, N4, N2, N5, N3, N6
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(3),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(4),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(5)));
+                    facesHelper[i++].set(6,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(3),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(4),
+                                         aFace->GetNode(2),
+                                         aFace->GetNode(5));
                     break;
                 case 8:
                     // quad8 face = N1, N5, N2, N6, N3, N7, N4, N8
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(4),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(5),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(6),
-                                                    aFace->GetNode(3),
-                                                    aFace->GetNode(7)));
+                    facesHelper[i++].set(8,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(4),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(5),
+                                         aFace->GetNode(2),
+                                         aFace->GetNode(6),
+                                         aFace->GetNode(3),
+                                         aFace->GetNode(7));
                     break;
                 default:
                     // unknown face type
@@ -919,34 +1005,34 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 2 = N1, N4, N2
                     // face 3 = N2, N4, N3
                     // face 4 = N3, N4, N1
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(0));
                     break;
                 // pyra5 volume
                 case 5:
@@ -955,42 +1041,42 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N2, N5, N3
                     // face 4 = N3, N5, N4
                     // face 5 = N4, N5, N1
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(0));
                     break;
                 // penta6 volume
                 case 6:
@@ -999,44 +1085,44 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N1, N4, N5, N2
                     // face 4 = N2, N5, N6, N3
                     // face 5 = N3, N6, N4, N1
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(4)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(4));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(0));
                     break;
                 // hexa8 volume
                 case 8:
@@ -1046,54 +1132,54 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 4 = N2, N6, N7, N3
                     // face 5 = N3, N7, N8, N4
                     // face 6 = N4, N8, N5, N1
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    6,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(5));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         6,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(0));
                     break;
                 // tetra10 volume
                 case 10:
@@ -1101,46 +1187,46 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 2 = N1, N8,  N4, N9,  N2, N5
                     // face 3 = N2, N9,  N4, N10, N3, N6
                     // face 4 = N3, N10, N4, N8,  N1, N7
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(6)));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(6));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(8),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(4));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(8),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(5));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(6));
                     break;
                 // pyra13 volume
                 case 13:
@@ -1149,58 +1235,58 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N2, N11, N5, N12, N3, N7
                     // face 4 = N3, N12, N5, N13, N4, N8
                     // face 5 = N4, N13, N5, N10, N1, N9
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8)));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(8));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(5));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(6));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(7));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(8));
                     break;
                 // penta15 volume
                 case 15:
@@ -1209,62 +1295,62 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N1, N13, N4, N10, N5, N14, N2, N7
                     // face 4 = N2, N14, N5, N11, N6, N15, N3, N8
                     // face 5 = N3, N15, N6, N12, N4, N13, N1, N9
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(9)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(7)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8)));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(8));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(9));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(6));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(7));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(8));
                     break;
                 // hexa20 volume
                 case 20:
@@ -1274,78 +1360,78 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 4 = N2, N18, N6, N14, N7, N19, N3, N10
                     // face 5 = N3, N19, N7, N15, N8, N20, N4, N11
                     // face 6 = N4, N20, N8, N16, N5, N17, N1, N12
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(11)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(15),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(12)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(16),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(17),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(17),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(18),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(9)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(18),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(19),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(10)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    6,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(19),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(15),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(16),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(11)));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(8),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(11));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(15),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(12));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(16),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(17),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(8));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(17),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(18),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(9));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(18),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(19),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(10));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         6,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(19),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(15),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(16),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(11));
                     break;
                 // unknown volume type
                 default:
@@ -1356,98 +1442,19 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
     }
     int FaceSize = facesHelper.size();
 
-
-    if (FaceSize < MaxFacesShowInner) {
-        Base::Console().Log("    %f: Start eliminate internal faces SIMPLE\n",
+    // search for double (inside) faces and hide them, small meshes may show them on demand
+    if (!ShowInner || FaceSize >= MaxFacesShowInner) {
+        Base::Console().Log("    %f: Start eliminate internal faces\n",
                             Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
-
-        // search for double (inside) faces and hide them
-        if (!ShowInner) {
-            for (int l = 0; l < FaceSize; l++) {
-                if (!facesHelper[l].hide) {
-                    for (int i = l + 1; i < FaceSize; i++) {
-                        if (facesHelper[l].isSameFace(facesHelper[i])) {
-                            break;
-                        }
-                    }
-                }
-            }
-        }
+        hideInnerFaces(facesHelper);
     }
-    else {
-        Base::Console().Log("    %f: Start eliminate internal faces GRID\n",
-                            Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
-        BndBox.Enlarge(BndBox.CalcDiagonalLength() / 10000.0);
-        // calculate grid properties
-        double edge = pow(FaceSize, 1.0 / 3.0);
-        double edgeL = BndBox.LengthX() + BndBox.LengthY() + BndBox.LengthZ();
-        double gridFactor = 5.0;
-        double size = (edgeL / (3 * edge)) * gridFactor;
-
-        unsigned int NbrX = (unsigned int)(BndBox.LengthX() / size) + 1;
-        unsigned int NbrY = (unsigned int)(BndBox.LengthY() / size) + 1;
-        unsigned int NbrZ = (unsigned int)(BndBox.LengthZ() / size) + 1;
-        Base::Console().Log("      Size:F:%f,  X:%i  ,Y:%i  ,Z:%i\n", gridFactor, NbrX, NbrY, NbrZ);
-
-        double Xmin = BndBox.MinX;
-        double Ymin = BndBox.MinY;
-        double Zmin = BndBox.MinZ;
-        double Xln = BndBox.LengthX() / NbrX;
-        double Yln = BndBox.LengthY() / NbrY;
-        double Zln = BndBox.LengthZ() / NbrZ;
-
-        std::vector<FemFaceGridItem> Grid(NbrX * NbrY * NbrZ);
-
-
-        unsigned int iX = 0;
-        unsigned int iY = 0;
-        unsigned int iZ = 0;
-
-        for (int l = 0; l < FaceSize; l++) {
-            Base::Vector3d point(facesHelper[l].getFirstNodePoint());
-            double x = (point.x - Xmin) / Xln;
-            double y = (point.y - Ymin) / Yln;
-            double z = (point.z - Zmin) / Zln;
-
-            iX = x;
-            iY = y;
-            iZ = z;
-
-            if (iX >= NbrX || iY >= NbrY || iZ >= NbrZ) {
-                Base::Console().Log("      Outof range!\n");
-            }
-
-            Grid[iX + iY * NbrX + iZ * NbrX * NbrY].push_back(&facesHelper[l]);
-        }
-
-        unsigned int max = 0, avg = 0;
-        for (const auto& it : Grid) {
-            for (size_t l = 0; l < it.size(); l++) {
-                if (!it[l]->hide) {
-                    for (size_t i = l + 1; i < it.size(); i++) {
-                        if (it[l]->isSameFace(*(it[i]))) {
-                            break;
-                        }
-                    }
-                }
-            }
-            if (it.size() > max) {
-                max = it.size();
-            }
-            avg += it.size();
-        }
-        avg = avg / Grid.size();
-
-        Base::Console().Log("      VoxelSize: Max:%i ,Average:%i\n", max, avg);
-
-    }  // if( FaceSize < 1000)
 
 
     Base::Console().Log("    %f: Start build up node map\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 
     // sort out double nodes and build up index map
-    std::map<const SMDS_MeshNode*, int> mapNodeIndex;
+    NodeIndexMap mapNodeIndex;
 
     // handling the corner case beams only, means no faces/triangles only nodes and edges
     if (onlyEdges) {
@@ -1457,7 +1464,7 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
             const SMDS_MeshEdge* aEdge = aEdgeIte->next();
             int num = aEdge->NbNodes();
             for (int i = 0; i < num; i++) {
-                mapNodeIndex[aEdge->GetNode(i)] = 0;
+                mapNodeIndex.add(aEdge->GetNode(i));
             }
         }
     }
@@ -1467,7 +1474,7 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
             if (!facesHelper[l].hide) {
                 for (auto Node : facesHelper[l].Nodes) {
                     if (Node) {
-                        mapNodeIndex[Node] = 0;
+                        mapNodeIndex.add(Node);
                     }
                     else {
                         break;
@@ -1480,15 +1487,15 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 
     // set the point coordinates
-    coords->point.setNum(mapNodeIndex.size());
-    vNodeElementIdx.resize(mapNodeIndex.size());
-    std::map<const SMDS_MeshNode*, int>::iterator it = mapNodeIndex.begin();
+    mapNodeIndex.build();
+    const std::vector<const SMDS_MeshNode*>& nodes = mapNodeIndex.getNodes();
+    coords->point.setNum(nodes.size());
+    vNodeElementIdx.resize(nodes.size());
     SbVec3f* verts = coords->point.startEditing();
-    for (int i = 0; it != mapNodeIndex.end(); ++it, i++) {
-        verts[i].setValue((float)it->first->X(), (float)it->first->Y(), (float)it->first->Z());
-        it->second = i;
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        verts[i].setValue((float)nodes[i]->X(), (float)nodes[i]->Y(), (float)nodes[i]->Z());
         // set selection idx
-        vNodeElementIdx[i] = it->first->GetID();
+        vNodeElementIdx[i] = nodes[i]->GetID();
     }
     coords->point.finishEditing();
 
@@ -1521,7 +1528,7 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
     }
     Base::Console().Log("    NumTriangles:%i\n", triangleCount);
     // edge map collect and sort edges of the faces to be shown.
-    std::map<int, std::set<int>> EdgeMap;
+    std::vector<std::pair<int, int>> EdgeMap;
 
     // handling the corner case beams only, means no faces/triangles only nodes and edges
     if (onlyEdges) {
@@ -2972,27 +2979,20 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
 
     Base::Console().Log("    %f: Start build up edge vector\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
-    // std::map<int,std::set<int> > EdgeMap;
-    // count edges
-    int EdgeSize = 0;
-    for (std::map<int, std::set<int>>::const_iterator it = EdgeMap.begin(); it != EdgeMap.end();
-         ++it) {
-        EdgeSize += it->second.size();
-    }
+    // sort out double edges
+    std::sort(EdgeMap.begin(), EdgeMap.end());
+    EdgeMap.erase(std::unique(EdgeMap.begin(), EdgeMap.end()), EdgeMap.end());
+    int EdgeSize = EdgeMap.size();
 
     // set the triangle face indices
     lines->coordIndex.setNum(3 * EdgeSize);
     index = 0;
     indices = lines->coordIndex.startEditing();
 
-    for (std::map<int, std::set<int>>::const_iterator it = EdgeMap.begin(); it != EdgeMap.end();
-         ++it) {
-        for (std::set<int>::const_iterator it2 = it->second.begin(); it2 != it->second.end();
-             ++it2) {
-            indices[index++] = it->first;
-            indices[index++] = *it2;
-            indices[index++] = -1;
-        }
+    for (const auto& edge : EdgeMap) {
+        indices[index++] = edge.first;
+        indices[index++] = edge.second;
+        indices[index++] = -1;
     }
 
     lines->coordIndex.finishEditing();
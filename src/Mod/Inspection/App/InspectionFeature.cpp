@@ -24,14 +24,23 @@
 
 #ifndef _PreComp_
 #include <boost/core/ignore_unused.hpp>
+#include <memory>
+#include <mutex>
 #include <numeric>
+#include <set>
 
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepGProp_Face.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Builder.hxx>
+#include <Poly_Triangle.hxx>
 #include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
 #include <gp_Pnt.hxx>
 
 #include <QEventLoop>
@@ -46,11 +55,13 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/PointsGrid.h>
 
@@ -476,9 +487,130 @@ float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 
 // ----------------------------------------------------------------
 
-InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
+class InspectNominalShape::Tessellation
+{
+public:
+    Tessellation(const TopoDS_Shape& rShape, float offset)
+        : offset(offset)
+    {
+        // mesh a copy so that the triangulation of the original shape is left untouched
+        BRepBuilderAPI_Copy copy(rShape, Standard_False);
+        shape = copy.Shape();
+        Part::TopoShape topoShape(shape);
+        deflection = static_cast<float>(topoShape.getAccuracy());
+        BRepMesh_IncrementalMesh aMesh(shape,
+                                       deflection,
+                                       /*isRelative*/ Standard_False,
+                                       /*theAngDeflection*/ 0.5,
+                                       /*isInParallel*/ Standard_True);
+
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        TopExp::MapShapes(shape, TopAbs_FACE, faces);
+        for (int index = 1; index <= faces.Extent(); index++) {
+            std::vector<gp_Pnt> nodes;
+            std::vector<Poly_Triangle> triangles;
+            if (!Part::Tools::getTriangulation(TopoDS::Face(faces(index)), nodes, triangles)) {
+                untriangulated.push_back(index);
+                continue;
+            }
+
+            auto base = static_cast<MeshCore::PointIndex>(points.size());
+            for (const auto& it : nodes) {
+                points.emplace_back(float(it.X()), float(it.Y()), float(it.Z()));
+            }
+            for (const auto& it : triangles) {
+                Standard_Integer n1, n2, n3;
+                it.Get(n1, n2, n3);
+                facets.emplace_back(base + n1, base + n2, base + n3);
+                faceOfFacet.push_back(index);
+            }
+        }
+
+        mesh.Adopt(points, facets);
+        bvh = std::make_unique<MeshCore::MeshFacetBVH>(mesh);
+
+        Base::BoundBox3d bbox = topoShape.getBoundBox();
+        box = Base::BoundBox3f(float(bbox.MinX),
+                               float(bbox.MinY),
+                               float(bbox.MinZ),
+                               float(bbox.MaxX),
+                               float(bbox.MaxY),
+                               float(bbox.MaxZ));
+        box.Enlarge(offset + deflection);
+    }
+
+    bool isValid() const
+    {
+        return mesh.CountFacets() > 0;
+    }
+
+    TopoDS_Shape shape;
+    TopTools_IndexedMapOfShape faces;
+    std::vector<int> faceOfFacet;
+    std::vector<int> untriangulated;
+    MeshCore::MeshKernel mesh;
+    std::unique_ptr<MeshCore::MeshFacetBVH> bvh;
+    Base::BoundBox3f box;
+    float deflection {0.0F};
+    float offset {0.0F};
+};
+
+/**
+ * Building a classifier for a solid is expensive, so the classifiers are reused
+ * for all points. A classifier can only be used by one thread at a time, so there
+ * is one for each thread that classifies a point at the same time.
+ */
+class InspectNominalShape::ClassifierPool
+{
+public:
+    explicit ClassifierPool(const TopoDS_Shape& rShape)
+        : shape(rShape)
+    {}
+
+    bool isInside(const gp_Pnt& pnt3d, Standard_Real tol)
+    {
+        std::unique_ptr<BRepClass3d_SolidClassifier> classifier;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!unused.empty()) {
+                classifier = std::move(unused.back());
+                unused.pop_back();
+            }
+        }
+        if (!classifier) {
+            classifier = std::make_unique<BRepClass3d_SolidClassifier>(shape);
+        }
+
+        classifier->Perform(pnt3d, tol);
+        bool inside = (classifier->State() == TopAbs_IN);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        unused.push_back(std::move(classifier));
+        return inside;
+    }
+
+private:
+    const TopoDS_Shape& shape;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<BRepClass3d_SolidClassifier>> unused;
+};
+
+InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float offset, bool tessellate)
     : _rShape(shape)
 {
+    classifiers = new ClassifierPool(_rShape);
+    if (tessellate && !_rShape.IsNull()) {
+        tessellation = new Tessellation(_rShape, offset);
+        if (tessellation->isValid()) {
+            isSolid = (_rShape.ShapeType() == TopAbs_SOLID);
+            return;
+        }
+
+        delete tessellation;
+        tessellation = nullptr;
+    }
+
     distss = new BRepExtrema_DistShapeShape();
     distss->LoadS1(_rShape);
 
@@ -498,10 +630,21 @@ InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radi
 InspectNominalShape::~InspectNominalShape()
 {
     delete distss;
+    delete tessellation;
+    delete classifiers;
+}
+
+bool InspectNominalShape::isThreadSafe() const
+{
+    return tessellation != nullptr;
 }
 
 float InspectNominalShape::getDistance(const Base::Vector3f& point) const
 {
+    if (tessellation) {
+        return getDistanceTessellated(point);
+    }
+
     gp_Pnt pnt3d(point.x, point.y, point.z);
     BRepBuilderAPI_MakeVertex mkVert(pnt3d);
     distss->LoadS2(mkVert.Vertex());
@@ -525,23 +668,93 @@ float InspectNominalShape::getDistance(const Base::Vector3f& point) const
     return fMinDist;
 }
 
+float InspectNominalShape::getDistanceTessellated(const Base::Vector3f& point) const
+{
+    if (!tessellation->box.IsInBox(point)) {
+        return FLT_MAX;  // must be inside bbox
+    }
+
+    // Faces that couldn't be meshed must always be checked. For all other faces the mesh
+    // deviates by at most the deflection so that only the faces of triangles close to the
+    // nearest triangle can contain the nearest point.
+    std::set<int> candidates(tessellation->untriangulated.begin(),
+                             tessellation->untriangulated.end());
+    float deflection = tessellation->deflection;
+    MeshCore::FacetIndex facet {};
+    float approx {};
+    if (tessellation->bvh->NearestFacetToPoint(point,
+                                               tessellation->offset + deflection,
+                                               facet,
+                                               approx)) {
+        std::vector<MeshCore::FacetIndex> facets;
+        tessellation->bvh->FacetsInRange(point, approx + 2.0F * deflection, facets);
+        for (auto it : facets) {
+            candidates.insert(tessellation->faceOfFacet[it]);
+        }
+    }
+
+    if (candidates.empty()) {
+        // out of search radius but a point deep inside a solid must get the negative sign
+        if (isSolid && isInsideSolid(gp_Pnt(point.x, point.y, point.z))) {
+            return -FLT_MAX;
+        }
+        return FLT_MAX;
+    }
+
+    TopoDS_Compound comp;
+    BRep_Builder builder;
+    builder.MakeCompound(comp);
+    for (int index : candidates) {
+        builder.Add(comp, tessellation->faces(index));
+    }
+
+    // use a local extrema object so that this can be called from several threads
+    gp_Pnt pnt3d(point.x, point.y, point.z);
+    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
+    BRepExtrema_DistShapeShape dss(comp, mkVert.Vertex());
+
+    float fMinDist = FLT_MAX;
+    if (dss.IsDone() && dss.NbSolution() > 0) {
+        fMinDist = (float)dss.Value();
+        bool inFace = false;
+        bool below = isBelowFace(dss, pnt3d, inFace);
+        if (isSolid) {
+            // the face normal is only reliable if the nearest point is inside the face
+            if (inFace ? below : isInsideSolid(pnt3d)) {
+                fMinDist = -fMinDist;
+            }
+        }
+        else if (fMinDist > 0 && below) {
+            fMinDist = -fMinDist;
+        }
+    }
+    return fMinDist;
+}
+
 bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
 {
     const Standard_Real tol = 0.001;
-    BRepClass3d_SolidClassifier classifier(_rShape);
-    classifier.Perform(pnt3d, tol);
-    return (classifier.State() == TopAbs_IN);
+    return classifiers->isInside(pnt3d, tol);
 }
 
 bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
+{
+    bool inFace = false;
+    return isBelowFace(*distss, pnt3d, inFace);
+}
+
+bool InspectNominalShape::isBelowFace(const BRepExtrema_DistShapeShape& dss,
+                                      const gp_Pnt& pnt3d,
+                                      bool& inFace)
 {
     // check if the distance was computed from a face
-    for (Standard_Integer index = 1; index <= distss->NbSolution(); index++) {
-        if (distss->SupportTypeShape1(index) == BRepExtrema_IsInFace) {
-            TopoDS_Shape face = distss->SupportOnShape1(index);
+    for (Standard_Integer index = 1; index <= dss.NbSolution(); index++) {
+        if (dss.SupportTypeShape1(index) == BRepExtrema_IsInFace) {
+            inFace = true;
+            TopoDS_Shape face = dss.SupportOnShape1(index);
             Standard_Real u, v;
-            distss->ParOnFaceS1(index, u, v);
-            // gp_Pnt pnt = distss->PointOnShape1(index);
+            dss.ParOnFaceS1(index, u, v);
+            // gp_Pnt pnt = dss.PointOnShape1(index);
             BRepGProp_Face props(TopoDS::Face(face));
             gp_Vec normal;
             gp_Pnt center;
@@ -773,6 +986,7 @@ Feature::Feature()
     ADD_PROPERTY(Thickness, (0.0));
     ADD_PROPERTY(Actual, (nullptr));
     ADD_PROPERTY(Nominals, (nullptr));
+    ADD_PROPERTY(TessellateNominals, (false));
     ADD_PROPERTY(Distances, (0.0));
 }
 
@@ -792,6 +1006,9 @@ short Feature::mustExecute() const
     if (Nominals.isTouched()) {
         return 1;
     }
+    if (TessellateNominals.isTouched()) {
+        return 1;
+    }
     return 0;
 }
 
@@ -822,6 +1039,8 @@ App::DocumentObjectExecReturn* Feature::execute()
         throw Base::TypeError("Unknown geometric type");
     }
 
+    bool tessellate = TessellateNominals.getValue();
+
     // clang-format off
     // get a list of nominals
     std::vector<InspectNominalGeometry*> inspectNominal;
@@ -837,9 +1056,12 @@ App::DocumentObjectExecReturn* Feature::execute()
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(it);
-            nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
+            auto shape = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue(), tessellate);
+            if (!shape->isThreadSafe()) {
+                useMultithreading = false;
+            }
+            nominal = shape;
         }
 
         if (nominal) {
@@ -162,16 +162,30 @@ private:
 class InspectionExport InspectNominalShape: public InspectNominalGeometry
 {
 public:
-    InspectNominalShape(const TopoDS_Shape&, float offset);
+    /**
+     * If \a tessellate is true the shape is meshed first and the mesh is used to find the
+     * faces close to a point and to skip points farther away than \a offset. The exact
+     * distance is then only computed for these faces which makes getDistance() much faster
+     * and safe to be called from several threads.
+     */
+    InspectNominalShape(const TopoDS_Shape&, float offset, bool tessellate = false);
     ~InspectNominalShape() override;
     float getDistance(const Base::Vector3f&) const override;
+    /// Returns true if getDistance() can be called from several threads at the same time
+    bool isThreadSafe() const;
 
 private:
+    float getDistanceTessellated(const Base::Vector3f&) const;
     bool isInsideSolid(const gp_Pnt&) const;
     bool isBelowFace(const gp_Pnt&) const;
+    static bool isBelowFace(const BRepExtrema_DistShapeShape&, const gp_Pnt&, bool& inFace);
 
 private:
-    BRepExtrema_DistShapeShape* distss;
+    class Tessellation;
+    class ClassifierPool;
+    BRepExtrema_DistShapeShape* distss {nullptr};
+    Tessellation* tessellation {nullptr};
+    ClassifierPool* classifiers {nullptr};
     const TopoDS_Shape& _rShape;
     bool isSolid {false};
 };
@@ -254,6 +268,7 @@ public:
     App::PropertyFloat Thickness;
     App::PropertyLink Actual;
     App::PropertyLinkList Nominals;
+    App::PropertyBool TessellateNominals;
     PropertyDistanceList Distances;
     //@}
 
@@ -0,0 +1,716 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <future>
+#include <memory>
+#include <thread>
+#endif
+
+#include <Base/Tools2D.h>
+#include <Base/ViewProj.h>
+
+#include "BVH.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+
+// Maximum number of facets stored in a leaf
+constexpr std::size_t LeafSize = 8;
+
+struct Node
+{
+    Base::BoundBox3f box;
+    std::unique_ptr<Node> left;
+    std::unique_ptr<Node> right;
+    std::size_t first {0};
+    std::size_t last {0};
+
+    bool isLeaf() const
+    {
+        return !left;
+    }
+};
+
+// Stack for the traversal of the tree. Since the tree is balanced its depth
+// is bounded by the logarithm of the number of facets.
+class NodeStack
+{
+public:
+    void push(const Node* node)
+    {
+        nodes[size++] = node;
+    }
+    const Node* pop()
+    {
+        return nodes[--size];
+    }
+    bool empty() const
+    {
+        return size == 0;
+    }
+
+private:
+    std::array<const Node*, 128> nodes {};
+    std::size_t size {0};
+};
+
+// The line p + t * d. The components are kept in plain arrays because the
+// ray tests are the hot spots of all queries.
+struct Ray
+{
+    Ray(const Base::Vector3f& p, const Base::Vector3f& d)
+        : org {p.x, p.y, p.z}
+        , dir {d.x, d.y, d.z}
+    {}
+
+    float org[3];
+    float dir[3];
+};
+
+// Computes the parameter interval [t0, t1] of the ray inside the box
+bool intersectBox(const Base::BoundBox3f& box, const Ray& ray, float& t0, float& t1)
+{
+    const float lo[3] = {box.MinX, box.MinY, box.MinZ};
+    const float hi[3] = {box.MaxX, box.MaxY, box.MaxZ};
+    t0 = -FLT_MAX;
+    t1 = FLT_MAX;
+    for (int i = 0; i < 3; i++) {
+        if (ray.dir[i] == 0.0F) {
+            if (ray.org[i] < lo[i] || ray.org[i] > hi[i]) {
+                return false;
+            }
+            continue;
+        }
+
+        float inv = 1.0F / ray.dir[i];
+        float ta = (lo[i] - ray.org[i]) * inv;
+        float tb = (hi[i] - ray.org[i]) * inv;
+        if (ta > tb) {
+            std::swap(ta, tb);
+        }
+        t0 = std::max(t0, ta);
+        t1 = std::min(t1, tb);
+        if (t0 > t1) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Intersects the ray with the triangle (v0, v1, v2) (Moeller-Trumbore)
+bool intersectTriangle(const Base::Vector3f& v0,
+                       const Base::Vector3f& v1,
+                       const Base::Vector3f& v2,
+                       const Ray& ray,
+                       float& t)
+{
+    const float e1[3] = {v1.x - v0.x, v1.y - v0.y, v1.z - v0.z};
+    const float e2[3] = {v2.x - v0.x, v2.y - v0.y, v2.z - v0.z};
+    const float* d = ray.dir;
+    const float h[3] = {d[1] * e2[2] - d[2] * e2[1],
+                        d[2] * e2[0] - d[0] * e2[2],
+                        d[0] * e2[1] - d[1] * e2[0]};
+    float a = e1[0] * h[0] + e1[1] * h[1] + e1[2] * h[2];
+    if (a == 0.0F) {
+        return false;
+    }
+
+    float f = 1.0F / a;
+    const float s[3] = {ray.org[0] - v0.x, ray.org[1] - v0.y, ray.org[2] - v0.z};
+    float u = f * (s[0] * h[0] + s[1] * h[1] + s[2] * h[2]);
+    if (u < 0.0F || u > 1.0F) {
+        return false;
+    }
+
+    const float q[3] = {s[1] * e1[2] - s[2] * e1[1],
+                        s[2] * e1[0] - s[0] * e1[2],
+                        s[0] * e1[1] - s[1] * e1[0]};
+    float v = f * (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]);
+    if (v < 0.0F || u + v > 1.0F) {
+        return false;
+    }
+
+    t = f * (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]);
+    return true;
+}
+
+// Checks if the segment (a, b) touches the rectangle (Liang-Barsky)
+bool intersectSegment(const Base::BoundBox2d& box, const Base::Vector2d& a, const Base::Vector2d& b)
+{
+    const double p[4] = {a.x - b.x, b.x - a.x, a.y - b.y, b.y - a.y};
+    const double q[4] = {a.x - box.MinX, box.MaxX - a.x, a.y - box.MinY, box.MaxY - a.y};
+    double t0 = 0.0;
+    double t1 = 1.0;
+    for (int i = 0; i < 4; i++) {
+        if (p[i] == 0.0) {
+            if (q[i] < 0.0) {
+                return false;
+            }
+            continue;
+        }
+
+        double t = q[i] / p[i];
+        if (p[i] < 0.0) {
+            t0 = std::max(t0, t);
+        }
+        else {
+            t1 = std::min(t1, t);
+        }
+        if (t0 > t1) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Returns the squared distance between the point and the box
+float distanceSquared(const Base::BoundBox3f& box, const Base::Vector3f& p)
+{
+    float dx = std::max({box.MinX - p.x, 0.0F, p.x - box.MaxX});
+    float dy = std::max({box.MinY - p.y, 0.0F, p.y - box.MaxY});
+    float dz = std::max({box.MinZ - p.z, 0.0F, p.z - box.MaxZ});
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Returns the homogeneous w component of the projected point
+float projectW(const Base::Matrix4D& mat, const Base::Vector3f& p)
+{
+    return static_cast<float>(mat[3][0] * p.x + mat[3][1] * p.y + mat[3][2] * p.z + mat[3][3]);
+}
+
+int numThreads()
+{
+    return std::max<int>(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+}  // namespace
+
+class MeshFacetBVH::Private
+{
+public:
+    explicit Private(const MeshKernel& mesh)
+        : mesh(mesh)
+    {
+        modCount = mesh.GetModificationCount();
+    }
+
+    void build()
+    {
+        const MeshPointArray& points = mesh.GetPoints();
+        const MeshFacetArray& facets = mesh.GetFacets();
+        std::size_t count = facets.size();
+        if (count == 0) {
+            return;
+        }
+
+        order.resize(count);
+        centers.resize(count);
+        for (std::size_t i = 0; i < count; i++) {
+            const MeshFacet& face = facets[i];
+            order[i] = static_cast<FacetIndex>(i);
+            centers[i] = (points[face._aulPoints[0]] + points[face._aulPoints[1]]
+                          + points[face._aulPoints[2]])
+                / 3.0F;
+        }
+
+        root = buildNode(0, count, numThreads());
+
+        // the centres are only needed while building
+        centers.clear();
+        centers.shrink_to_fit();
+    }
+
+    std::unique_ptr<Node> buildNode(std::size_t first, std::size_t last, int threads)
+    {
+        const MeshPointArray& points = mesh.GetPoints();
+        const MeshFacetArray& facets = mesh.GetFacets();
+
+        auto node = std::make_unique<Node>();
+        node->first = first;
+        node->last = last;
+
+        Base::BoundBox3f centerBox;
+        for (std::size_t i = first; i < last; i++) {
+            const MeshFacet& face = facets[order[i]];
+            for (PointIndex ptIndex : face._aulPoints) {
+                node->box.Add(points[ptIndex]);
+            }
+            centerBox.Add(centers[order[i]]);
+        }
+
+        if (last - first <= LeafSize) {
+            return node;
+        }
+
+        // split at the median along the longest extent of the facet centres
+        unsigned short axis = 0;
+        if (centerBox.LengthY() > centerBox.LengthX()) {
+            axis = 1;
+        }
+        if (centerBox.LengthZ() > std::max(centerBox.LengthX(), centerBox.LengthY())) {
+            axis = 2;
+        }
+
+        std::size_t mid = first + (last - first) / 2;
+        std::nth_element(order.begin() + first,
+                         order.begin() + mid,
+                         order.begin() + last,
+                         [this, axis](FacetIndex a, FacetIndex b) {
+                             return centers[a][axis] < centers[b][axis];
+                         });
+
+        if (threads > 1) {
+            auto future = std::async(std::launch::async, [this, first, mid, threads]() {
+                return buildNode(first, mid, threads / 2);
+            });
+            node->right = buildNode(mid, last, threads - threads / 2);
+            node->left = future.get();
+        }
+        else {
+            node->left = buildNode(first, mid, 1);
+            node->right = buildNode(mid, last, 1);
+        }
+
+        return node;
+    }
+
+    bool isValid(const MeshKernel& kernel) const
+    {
+        return &kernel == &mesh && modCount == mesh.GetModificationCount();
+    }
+
+    std::size_t countNodes(const Node* node) const
+    {
+        if (!node) {
+            return 0;
+        }
+        return 1 + countNodes(node->left.get()) + countNodes(node->right.get());
+    }
+
+    // Checks if a facet other than 'skip' is hit by the segment between 'from' and 'to'
+    bool isOccluded(const Base::Vector3f& from, const Base::Vector3f& to, FacetIndex skip) const
+    {
+        const float eps = 1e-4F;
+        if (!root || from == to) {
+            return false;
+        }
+
+        const MeshPointArray& points = mesh.GetPoints();
+        const MeshFacetArray& facets = mesh.GetFacets();
+        Ray ray(from, to - from);
+        NodeStack stack;
+        stack.push(root.get());
+        while (!stack.empty()) {
+            const Node* node = stack.pop();
+
+            float t0 {};
+            float t1 {};
+            if (!intersectBox(node->box, ray, t0, t1) || t1 < eps || t0 > 1.0F) {
+                continue;
+            }
+
+            if (node->isLeaf()) {
+                for (std::size_t i = node->first; i < node->last; i++) {
+                    FacetIndex index = order[i];
+                    if (index == skip) {
+                        continue;
+                    }
+                    const MeshFacet& face = facets[index];
+                    float t {};
+                    if (intersectTriangle(points[face._aulPoints[0]],
+                                          points[face._aulPoints[1]],
+                                          points[face._aulPoints[2]],
+                                          ray,
+                                          t)
+                        && t > eps && t < 1.0F) {
+                        return true;
+                    }
+                }
+            }
+            else {
+                stack.push(node->left.get());
+                stack.push(node->right.get());
+            }
+        }
+
+        return false;
+    }
+
+    bool isVisible(const Base::ViewProjMethod& proj,
+                   const Base::Matrix4D& mat,
+                   bool perspective,
+                   FacetIndex index) const
+    {
+        MeshGeomFacet facet = mesh.GetFacet(index);
+        Base::Vector3f center = facet.GetGravityPoint();
+
+        // Test the centre and points close to the corners. The points are moved a bit
+        // towards the centre so that they aren't hidden by adjacent facets.
+        std::array<Base::Vector3f, 4> samples {center,
+                                               center + 0.9F * (facet._aclPoints[0] - center),
+                                               center + 0.9F * (facet._aclPoints[1] - center),
+                                               center + 0.9F * (facet._aclPoints[2] - center)};
+        for (const auto& pnt : samples) {
+            if (perspective && projectW(mat, pnt) <= 0.0F) {
+                continue;
+            }
+
+            Base::Vector3f scr = proj(pnt);
+            if (scr.x < 0.0F || scr.x > 1.0F || scr.y < 0.0F || scr.y > 1.0F || scr.z < 0.0F
+                || scr.z > 1.0F) {
+                continue;
+            }
+
+            Base::Vector3f eye = proj.inverse(Base::Vector3f(scr.x, scr.y, 0.0F));
+            if (!isOccluded(pnt, eye, index)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    const MeshKernel& mesh;
+    std::vector<FacetIndex> order;
+    std::vector<Base::Vector3f> centers;
+    std::unique_ptr<Node> root;
+
+    // used to check if the kernel has changed
+    unsigned long modCount {0};
+};
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& mesh)
+    : d(new Private(mesh))
+{
+    d->build();
+}
+
+MeshFacetBVH::~MeshFacetBVH()
+{
+    delete d;
+}
+
+bool MeshFacetBVH::IsValid(const MeshKernel& mesh) const
+{
+    return d->isValid(mesh);
+}
+
+std::size_t MeshFacetBVH::CountNodes() const
+{
+    return d->countNodes(d->root.get());
+}
+
+bool MeshFacetBVH::NearestFacetOnRay(const Base::Vector3f& pnt,
+                                     const Base::Vector3f& dir,
+                                     float fMaxAngle,
+                                     Base::Vector3f& res,
+                                     FacetIndex& facet) const
+{
+    if (!d->root) {
+        return false;
+    }
+
+    float len = dir.Length();
+    if (len == 0.0F) {
+        return false;
+    }
+
+    Ray ray(pnt, dir);
+    bool found = false;
+    float bestDist = FLT_MAX;
+    Base::Vector3f bestPnt;
+    FacetIndex bestIndex = FACET_INDEX_MAX;
+
+    NodeStack stack;
+    stack.push(d->root.get());
+    while (!stack.empty()) {
+        const Node* node = stack.pop();
+
+        // lower bound of the distance between 'pnt' and any intersection inside the box
+        float t0 {};
+        float t1 {};
+        if (!intersectBox(node->box, ray, t0, t1)) {
+            continue;
+        }
+        float minDist =
+            (t0 <= 0.0F && t1 >= 0.0F) ? 0.0F : std::min(std::fabs(t0), std::fabs(t1)) * len;
+        if (minDist > bestDist) {
+            continue;
+        }
+
+        if (node->isLeaf()) {
+            Base::Vector3f intersection;
+            for (std::size_t i = node->first; i < node->last; i++) {
+                FacetIndex index = d->order[i];
+                MeshGeomFacet face = d->mesh.GetFacet(index);
+                if (face.Foraminate(pnt, dir, intersection, fMaxAngle)) {
+                    float dist = Base::Distance(intersection, pnt);
+                    if (!found || dist < bestDist || (dist == bestDist && index < bestIndex)) {
+                        found = true;
+                        bestDist = dist;
+                        bestPnt = intersection;
+                        bestIndex = index;
+                    }
+                }
+            }
+        }
+        else {
+            stack.push(node->left.get());
+            stack.push(node->right.get());
+        }
+    }
+
+    if (found) {
+        res = bestPnt;
+        facet = bestIndex;
+    }
+
+    return found;
+}
+
+bool MeshFacetBVH::NearestFacetToPoint(const Base::Vector3f& pnt,
+                                       float maxDist,
+                                       FacetIndex& facet,
+                                       float& dist) const
+{
+    if (!d->root) {
+        return false;
+    }
+
+    bool found = false;
+    float bestDist = maxDist;
+    FacetIndex bestIndex = FACET_INDEX_MAX;
+
+    NodeStack stack;
+    stack.push(d->root.get());
+    while (!stack.empty()) {
+        const Node* node = stack.pop();
+        if (distanceSquared(node->box, pnt) > bestDist * bestDist) {
+            continue;
+        }
+
+        if (node->isLeaf()) {
+            for (std::size_t i = node->first; i < node->last; i++) {
+                FacetIndex index = d->order[i];
+                float value = d->mesh.GetFacet(index).DistanceToPoint(pnt);
+                if (value < bestDist || (value == bestDist && (!found || index < bestIndex))) {
+                    found = true;
+                    bestDist = value;
+                    bestIndex = index;
+                }
+            }
+        }
+        else {
+            // visit the nearer child first so that more nodes can be skipped
+            const Node* left = node->left.get();
+            const Node* right = node->right.get();
+            if (distanceSquared(left->box, pnt) < distanceSquared(right->box, pnt)) {
+                std::swap(left, right);
+            }
+            stack.push(left);
+            stack.push(right);
+        }
+    }
+
+    if (found) {
+        facet = bestIndex;
+        dist = bestDist;
+    }
+
+    return found;
+}
+
+void MeshFacetBVH::FacetsInRange(const Base::Vector3f& pnt,
+                                 float maxDist,
+                                 std::vector<FacetIndex>& facets) const
+{
+    if (!d->root) {
+        return;
+    }
+
+    std::size_t offset = facets.size();
+    NodeStack stack;
+    stack.push(d->root.get());
+    while (!stack.empty()) {
+        const Node* node = stack.pop();
+        if (distanceSquared(node->box, pnt) > maxDist * maxDist) {
+            continue;
+        }
+
+        if (node->isLeaf()) {
+            for (std::size_t i = node->first; i < node->last; i++) {
+                FacetIndex index = d->order[i];
+                if (d->mesh.GetFacet(index).DistanceToPoint(pnt) <= maxDist) {
+                    facets.push_back(index);
+                }
+            }
+        }
+        else {
+            stack.push(node->left.get());
+            stack.push(node->right.get());
+        }
+    }
+
+    std::sort(facets.begin() + offset, facets.end());
+}
+
+void MeshFacetBVH::FacetsInPolygon(const Base::ViewProjMethod* proj,
+                                   const Base::Polygon2d& poly,
+                                   bool inner,
+                                   std::vector<FacetIndex>& facets) const
+{
+    if (!d->root) {
+        return;
+    }
+
+    const MeshPointArray& points = d->mesh.GetPoints();
+    const MeshFacetArray& faces = d->mesh.GetFacets();
+    Base::BoundBox2d bb = poly.CalcBoundBox();
+    Base::Matrix4D mat = proj->getComposedProjectionMatrix();
+    Base::ViewProjMatrix fixedProj(mat);
+    bool perspective = (mat[3][0] != 0.0 || mat[3][1] != 0.0 || mat[3][2] != 0.0);
+
+    enum class Location
+    {
+        Outside,
+        Inside,
+        Unknown
+    };
+
+    // checks where the projected box is with respect to the polygon
+    auto locate = [&](const Base::BoundBox3f& box) {
+        Base::BoundBox2d box2d;
+        for (unsigned short i = 0; i < 8; i++) {
+            Base::Vector3f corner = box.CalcPoint(i);
+            // the projection of points behind the eye is meaningless
+            if (perspective && projectW(mat, corner) <= 0.0F) {
+                return Location::Unknown;
+            }
+            Base::Vector3f pt2d = fixedProj(corner);
+            box2d.Add(Base::Vector2d(pt2d.x, pt2d.y));
+        }
+
+        if (!bb.Intersect(box2d)) {
+            return Location::Outside;
+        }
+
+        // if no edge of the polygon touches the rectangle then it's either
+        // completely inside or outside
+        std::size_t num = poly.GetCtVectors();
+        for (std::size_t i = 0; i < num; i++) {
+            if (intersectSegment(box2d, poly[i], poly[(i + 1) % num])) {
+                return Location::Unknown;
+            }
+        }
+
+        Base::Vector2d center((box2d.MinX + box2d.MaxX) / 2.0, (box2d.MinY + box2d.MaxY) / 2.0);
+        return poly.Contains(center) ? Location::Inside : Location::Outside;
+    };
+
+    std::size_t offset = facets.size();
+    NodeStack stack;
+    stack.push(d->root.get());
+    while (!stack.empty()) {
+        const Node* node = stack.pop();
+
+        Location location = locate(node->box);
+        if (location != Location::Unknown) {
+            // all corners of all facets are either outside or inside
+            if ((location == Location::Inside) == inner) {
+                facets.insert(facets.end(),
+                              d->order.begin() + node->first,
+                              d->order.begin() + node->last);
+            }
+            continue;
+        }
+
+        if (node->isLeaf()) {
+            for (std::size_t i = node->first; i < node->last; i++) {
+                FacetIndex index = d->order[i];
+                for (PointIndex ptIndex : faces[index]._aulPoints) {
+                    Base::Vector3f pt2d = fixedProj(points[ptIndex]);
+                    if ((bb.Contains(Base::Vector2d(pt2d.x, pt2d.y))
+                         && poly.Contains(Base::Vector2d(pt2d.x, pt2d.y)))
+                        ^ !inner) {
+                        facets.push_back(index);
+                        break;
+                    }
+                }
+            }
+        }
+        else {
+            stack.push(node->left.get());
+            stack.push(node->right.get());
+        }
+    }
+
+    std::sort(facets.begin() + offset, facets.end());
+}
+
+void MeshFacetBVH::VisibleFacets(const Base::ViewProjMethod* proj,
+                                 std::vector<FacetIndex>& facets) const
+{
+    std::size_t count = d->mesh.CountFacets();
+    if (!d->root || count == 0) {
+        return;
+    }
+
+    Base::Matrix4D mat = proj->getComposedProjectionMatrix();
+    Base::ViewProjMatrix fixedProj(mat);
+    bool perspective = (mat[3][0] != 0.0 || mat[3][1] != 0.0 || mat[3][2] != 0.0);
+
+    // the facets are independent of each other, so split them into chunks
+    auto numChunks = static_cast<std::size_t>(numThreads());
+    std::size_t chunkSize = (count + numChunks - 1) / numChunks;
+    std::vector<std::future<std::vector<FacetIndex>>> futures;
+    for (std::size_t first = 0; first < count; first += chunkSize) {
+        std::size_t last = std::min(first + chunkSize, count);
+        futures.push_back(std::async(std::launch::async, [&, first, last]() {
+            std::vector<FacetIndex> visible;
+            for (std::size_t i = first; i < last; i++) {
+                auto index = static_cast<FacetIndex>(i);
+                if (d->isVisible(fixedProj, mat, perspective, index)) {
+                    visible.push_back(index);
+                }
+            }
+            return visible;
+        }));
+    }
+
+    // the chunks are in ascending order so the result is sorted
+    for (auto& future : futures) {
+        std::vector<FacetIndex> visible = future.get();
+        facets.insert(facets.end(), visible.begin(), visible.end());
+    }
+}
@@ -0,0 +1,114 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef MESH_BVH_H
+#define MESH_BVH_H
+
+#include "Elements.h"
+
+namespace Base
+{
+class Polygon2d;
+class ViewProjMethod;
+}  // namespace Base
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshFacetBVH class is a bounding volume hierarchy over the facets of a mesh kernel.
+ * It is built once in parallel and speeds up ray picking, polygon selection and the
+ * search for visible facets which otherwise had to test every single facet.
+ * @note The hierarchy keeps a reference to the kernel it was built for. If the kernel
+ * changes the hierarchy becomes invalid and must be rebuilt, see IsValid() and
+ * MeshKernel::GetModificationCount().
+ */
+class MeshExport MeshFacetBVH
+{
+public:
+    explicit MeshFacetBVH(const MeshKernel& mesh);
+    ~MeshFacetBVH();
+
+    /** Checks whether the hierarchy was built for the given kernel and the kernel
+     * hasn't been modified since. */
+    bool IsValid(const MeshKernel& mesh) const;
+    /** Returns the number of nodes of the hierarchy. */
+    std::size_t CountNodes() const;
+
+    /**
+     * Searches for the facet that is hit by the line (\a pnt, \a dir) and whose intersection
+     * point is closest to \a pnt. The semantics are the same as of
+     * MeshAlgorithm::NearestFacetOnRay().
+     */
+    bool NearestFacetOnRay(const Base::Vector3f& pnt,
+                           const Base::Vector3f& dir,
+                           float fMaxAngle,
+                           Base::Vector3f& res,
+                           FacetIndex& facet) const;
+    /**
+     * Searches for the facet with the shortest distance to \a pnt. Facets farther away
+     * than \a maxDist are ignored.
+     */
+    bool NearestFacetToPoint(const Base::Vector3f& pnt,
+                             float maxDist,
+                             FacetIndex& facet,
+                             float& dist) const;
+    /** Returns the sorted indices of all facets whose distance to \a pnt is at most \a maxDist. */
+    void FacetsInRange(const Base::Vector3f& pnt,
+                       float maxDist,
+                       std::vector<FacetIndex>& facets) const;
+    /**
+     * Returns the sorted indices of all facets with at least one corner inside
+     * (\a inner is true) or outside (\a inner is false) of the projected polygon.
+     * The semantics are the same as of MeshAlgorithm::CheckFacets().
+     */
+    void FacetsInPolygon(const Base::ViewProjMethod* proj,
+                         const Base::Polygon2d& poly,
+                         bool inner,
+                         std::vector<FacetIndex>& facets) const;
+    /**
+     * Returns the sorted indices of all facets that are not completely hidden by other
+     * facets when looking through the view volume \a proj. A facet is visible if its centre
+     * or a point close to one of its corners is inside the view volume and not covered by
+     * another facet.
+     * @note Only these four points are sampled, so unlike the colour-coded readback of
+     * ViewProviderMesh::getVisibleFacets() a facet is missed if it is only visible in between.
+     */
+    void VisibleFacets(const Base::ViewProjMethod* proj, std::vector<FacetIndex>& facets) const;
+
+    MeshFacetBVH(const MeshFacetBVH&) = delete;
+    MeshFacetBVH(MeshFacetBVH&&) = delete;
+    void operator=(const MeshFacetBVH&) = delete;
+    void operator=(MeshFacetBVH&&) = delete;
+
+private:
+    class Private;
+    Private* d;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_BVH_H
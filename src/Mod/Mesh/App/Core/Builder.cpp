@@ -56,6 +56,7 @@ void MeshBuilder::SetTolerance(float fTol)
 
 void MeshBuilder::Initialize(size_t ctFacets, bool deletion)
 {
+    _meshKernel.Touch();
     if (deletion) {
         // Clear the mesh structure and free all memory
         _meshKernel.Clear();
@@ -128,6 +129,7 @@ void MeshBuilder::AddFacet(const Base::Vector3f& pt1,
 
 void MeshBuilder::AddFacet(Base::Vector3f* facetPoints, unsigned char flag, unsigned long prop)
 {
+    _meshKernel.Touch();
     this->_seq->next(true);  // allow to cancel
 
     // adjust circulation direction
@@ -229,6 +231,7 @@ void MeshBuilder::RemoveUnreferencedPoints()
 
 void MeshBuilder::Finish(bool freeMemory)
 {
+    _meshKernel.Touch();
     // now we can resize the vertex array to the exact size and copy the vertices with their correct
     // positions in the array
     PointIndex i = 0;
@@ -22,33 +22,38 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <algorithm>
+#include <cfloat>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
+#endif
+
 #include "Decimation.h"
+#include "Functional.h"
 #include "MeshKernel.h"
 #include "Simplify.h"
 
 
 using namespace MeshCore;
 
-MeshSimplify::MeshSimplify(MeshKernel& mesh)
-    : myKernel(mesh)
-{}
-
-void MeshSimplify::simplify(float tolerance, float reduction)
+namespace
 {
-    Simplify alg;
-
-    const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
+void fillSimplify(Simplify& alg, const MeshPointArray& points, const MeshFacetArray& facets)
+{
+    alg.vertices.reserve(points.size());
+    for (const auto& point : points) {
         Simplify::Vertex v;
         v.tstart = 0;
         v.tcount = 0;
         v.border = 0;
-        v.p = points[i];
+        v.p = point;
         alg.vertices.push_back(v);
     }
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
-    for (std::size_t i = 0; i < facets.size(); i++) {
+    alg.triangles.reserve(facets.size());
+    for (const auto& facet : facets) {
         Simplify::Triangle t;
         t.deleted = 0;
         t.dirty = 0;
@@ -56,21 +61,18 @@ void MeshSimplify::simplify(float tolerance, float reduction)
             j = 0.0;
         }
         for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
+            t.v[j] = static_cast<int>(facet._aulPoints[j]);
         }
         alg.triangles.push_back(t);
     }
+}
 
-    int target_count = static_cast<int>(static_cast<float>(facets.size()) * (1.0f - reduction));
-
-    // Simplification starts
-    alg.simplify_mesh(target_count, tolerance);
-
-    // Simplification done
-    MeshPointArray new_points;
-    new_points.reserve(alg.vertices.size());
+void takeSimplify(const Simplify& alg, MeshPointArray& points, MeshFacetArray& facets)
+{
+    points.clear();
+    points.reserve(alg.vertices.size());
     for (const auto& vertex : alg.vertices) {
-        new_points.push_back(vertex.p);
+        points.push_back(vertex.p);
     }
 
     std::size_t numFacets = 0;
@@ -79,37 +81,91 @@ void MeshSimplify::simplify(float tolerance, float reduction)
             numFacets++;
         }
     }
-    MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
+
+    facets.clear();
+    facets.reserve(numFacets);
     for (const auto& triangle : alg.triangles) {
         if (!triangle.deleted) {
             MeshFacet face;
             face._aulPoints[0] = triangle.v[0];
             face._aulPoints[1] = triangle.v[1];
             face._aulPoints[2] = triangle.v[2];
-            new_facets.push_back(face);
+            facets.push_back(face);
         }
     }
-
-    myKernel.Adopt(new_points, new_facets, true);
 }
 
-void MeshSimplify::simplify(int targetSize)
+void simplifyKernel(MeshKernel& kernel, int targetSize, double tolerance)
 {
     Simplify alg;
+    fillSimplify(alg, kernel.GetPoints(), kernel.GetFacets());
 
-    const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
+    // Simplification starts
+    alg.simplify_mesh(targetSize, tolerance);
+
+    // Simplification done
+    MeshPointArray new_points;
+    MeshFacetArray new_facets;
+    takeSimplify(alg, new_points, new_facets);
+    kernel.Adopt(new_points, new_facets, true);
+}
+
+// Decimates the band of facets around the seam vertices of the stitched blocks.
+// The vertices of the band that are also used by other facets are locked, so that
+// only the band must be held in the decimation structures.
+void simplifySeams(MeshPointArray& points,
+                   MeshFacetArray& facets,
+                   const std::vector<bool>& seam,
+                   int targetSize,
+                   double tolerance)
+{
+    std::size_t target = static_cast<std::size_t>(std::max(targetSize, 0));
+    if (facets.size() <= target) {
+        return;
+    }
+
+    std::vector<bool> inBand(facets.size(), false);
+    std::vector<bool> outside(points.size(), false);
+    std::vector<PointIndex> localPoints;
+    for (std::size_t i = 0; i < facets.size(); i++) {
+        const auto& indices = facets[i]._aulPoints;
+        inBand[i] = seam[indices[0]] || seam[indices[1]] || seam[indices[2]];
+        for (PointIndex pointIndex : indices) {
+            if (inBand[i]) {
+                localPoints.push_back(pointIndex);
+            }
+            else {
+                outside[pointIndex] = true;
+            }
+        }
+    }
+    if (localPoints.empty()) {
+        return;
+    }
+
+    std::sort(localPoints.begin(), localPoints.end());
+    localPoints.erase(std::unique(localPoints.begin(), localPoints.end()), localPoints.end());
+
+    Simplify alg;
+    alg.vertices.reserve(localPoints.size());
+    for (PointIndex pointIndex : localPoints) {
         Simplify::Vertex v;
         v.tstart = 0;
         v.tcount = 0;
         v.border = 0;
-        v.p = points[i];
+        v.p = points[pointIndex];
+        if (outside[pointIndex]) {
+            v.lockid = static_cast<int>(pointIndex) + 1;
+        }
         alg.vertices.push_back(v);
     }
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
+    std::size_t keep = 0;
     for (std::size_t i = 0; i < facets.size(); i++) {
+        if (!inBand[i]) {
+            keep++;
+            continue;
+        }
         Simplify::Triangle t;
         t.deleted = 0;
         t.dirty = 0;
@@ -117,38 +173,278 @@ void MeshSimplify::simplify(int targetSize)
             j = 0.0;
         }
         for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
+            auto it = std::lower_bound(localPoints.begin(),
+                                       localPoints.end(),
+                                       facets[i]._aulPoints[j]);
+            t.v[j] = static_cast<int>(it - localPoints.begin());
         }
         alg.triangles.push_back(t);
     }
 
-    // Simplification starts
-    alg.simplify_mesh(targetSize, FLT_MAX);
+    int bandTarget = target > keep ? static_cast<int>(target - keep) : 0;
+    alg.simplify_mesh(bandTarget, tolerance);
 
-    // Simplification done
-    MeshPointArray new_points;
-    new_points.reserve(alg.vertices.size());
-    for (const auto& vertex : alg.vertices) {
-        new_points.push_back(vertex.p);
+    // Put the untouched facets and the decimated band together and drop the
+    // points that are no longer used
+    MeshPointArray newPoints;
+    MeshFacetArray newFacets;
+    std::vector<PointIndex> remap(points.size(), POINT_INDEX_MAX);
+    auto mapPoint = [&](PointIndex pointIndex) {
+        if (remap[pointIndex] == POINT_INDEX_MAX) {
+            remap[pointIndex] = static_cast<PointIndex>(newPoints.size());
+            newPoints.push_back(points[pointIndex]);
+        }
+        return remap[pointIndex];
+    };
+
+    for (std::size_t i = 0; i < facets.size(); i++) {
+        if (!inBand[i]) {
+            const auto& indices = facets[i]._aulPoints;
+            newFacets.emplace_back(mapPoint(indices[0]),
+                                   mapPoint(indices[1]),
+                                   mapPoint(indices[2]));
+        }
     }
 
-    std::size_t numFacets = 0;
+    std::vector<PointIndex> localToGlobal;
+    localToGlobal.reserve(alg.vertices.size());
+    for (const auto& vertex : alg.vertices) {
+        if (vertex.lockid > 0) {
+            localToGlobal.push_back(mapPoint(static_cast<PointIndex>(vertex.lockid - 1)));
+        }
+        else {
+            localToGlobal.push_back(static_cast<PointIndex>(newPoints.size()));
+            newPoints.push_back(vertex.p);
+        }
+    }
     for (const auto& triangle : alg.triangles) {
         if (!triangle.deleted) {
-            numFacets++;
+            newFacets.emplace_back(localToGlobal[triangle.v[0]],
+                                   localToGlobal[triangle.v[1]],
+                                   localToGlobal[triangle.v[2]]);
         }
     }
+
+    points.swap(newPoints);
+    facets.swap(newFacets);
+}
+
+// The decimated part of a block. Vertices shared with other blocks keep their
+// global index, all other vertices have POINT_INDEX_MAX.
+struct SimplifiedBlock
+{
+    MeshPointArray points;
+    MeshFacetArray facets;
+    std::vector<PointIndex> globalIndex;
+};
+}  // namespace
+
+MeshSimplify::MeshSimplify(MeshKernel& mesh)
+    : myKernel(mesh)
+{}
+
+void MeshSimplify::setBlockSize(std::size_t size)
+{
+    blockSize = size;
+}
+
+void MeshSimplify::simplify(float tolerance, float reduction)
+{
+    std::size_t numFacets = myKernel.CountFacets();
+    int target_count = static_cast<int>(static_cast<float>(numFacets) * (1.0f - reduction));
+
+    if (blockSize > 0 && numFacets > blockSize) {
+        simplifyBlocks(target_count, tolerance);
+    }
+    else {
+        simplifyKernel(myKernel, target_count, tolerance);
+    }
+}
+
+void MeshSimplify::simplify(int targetSize)
+{
+    if (blockSize > 0 && myKernel.CountFacets() > blockSize) {
+        simplifyBlocks(targetSize, FLT_MAX);
+    }
+    else {
+        simplifyKernel(myKernel, targetSize, FLT_MAX);
+    }
+}
+
+void MeshSimplify::simplifyBlocks(int targetSize, double tolerance)
+{
+    const MeshPointArray& points = myKernel.GetPoints();
+    const MeshFacetArray& facets = myKernel.GetFacets();
+
+    // Split the facets into compact blocks by recursively halving them at the median
+    // of their centres along the longest axis
+    std::vector<FacetIndex> order(facets.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto center = [&](FacetIndex index, unsigned short axis) {
+        const MeshFacet& face = facets[index];
+        return points[face._aulPoints[0]][axis] + points[face._aulPoints[1]][axis]
+            + points[face._aulPoints[2]][axis];
+    };
+
+    std::vector<std::pair<std::size_t, std::size_t>> blocks;
+    std::vector<std::pair<std::size_t, std::size_t>> pending;
+    pending.emplace_back(0, order.size());
+    while (!pending.empty()) {
+        auto range = pending.back();
+        pending.pop_back();
+        if (range.second - range.first <= blockSize) {
+            blocks.push_back(range);
+            continue;
+        }
+
+        Base::BoundBox3f box;
+        for (std::size_t i = range.first; i < range.second; i++) {
+            box.Add(Base::Vector3f(center(order[i], 0), center(order[i], 1), center(order[i], 2)));
+        }
+        unsigned short axis = 0;
+        if (box.LengthY() > box.LengthX() && box.LengthY() >= box.LengthZ()) {
+            axis = 1;
+        }
+        else if (box.LengthZ() > box.LengthX() && box.LengthZ() > box.LengthY()) {
+            axis = 2;
+        }
+
+        std::size_t mid = range.first + (range.second - range.first) / 2;
+        std::nth_element(order.begin() + range.first,
+                         order.begin() + mid,
+                         order.begin() + range.second,
+                         [&](FacetIndex f1, FacetIndex f2) {
+                             return center(f1, axis) < center(f2, axis);
+                         });
+        pending.emplace_back(mid, range.second);
+        pending.emplace_back(range.first, mid);
+    }
+
+    // Lock all vertices that are used by more than one block
+    const int unused = -1;
+    const int shared = -2;
+    std::vector<int> owner(points.size(), unused);
+    for (std::size_t block = 0; block < blocks.size(); block++) {
+        for (std::size_t i = blocks[block].first; i < blocks[block].second; i++) {
+            for (PointIndex pointIndex : facets[order[i]]._aulPoints) {
+                int& value = owner[pointIndex];
+                if (value == unused) {
+                    value = static_cast<int>(block);
+                }
+                else if (value != static_cast<int>(block)) {
+                    value = shared;
+                }
+            }
+        }
+    }
+
+    // Decimate the blocks in parallel. Only as many blocks as threads are held in the
+    // decimation structures at a time.
+    double ratio = double(targetSize) / double(facets.size());
+    auto decimate = [&](std::size_t first, std::size_t last, std::vector<SimplifiedBlock>& result) {
+        for (std::size_t block = first; block < last; block++) {
+            std::size_t begin = blocks[block].first;
+            std::size_t end = blocks[block].second;
+
+            std::vector<PointIndex> localPoints;
+            localPoints.reserve(3 * (end - begin));
+            for (std::size_t i = begin; i < end; i++) {
+                for (PointIndex pointIndex : facets[order[i]]._aulPoints) {
+                    localPoints.push_back(pointIndex);
+                }
+            }
+            std::sort(localPoints.begin(), localPoints.end());
+            localPoints.erase(std::unique(localPoints.begin(), localPoints.end()),
+                              localPoints.end());
+
+            Simplify alg;
+            alg.vertices.reserve(localPoints.size());
+            for (PointIndex pointIndex : localPoints) {
+                Simplify::Vertex v;
+                v.tstart = 0;
+                v.tcount = 0;
+                v.border = 0;
+                v.p = points[pointIndex];
+                if (owner[pointIndex] == shared) {
+                    v.lockid = static_cast<int>(pointIndex) + 1;
+                }
+                alg.vertices.push_back(v);
+            }
+
+            alg.triangles.reserve(end - begin);
+            for (std::size_t i = begin; i < end; i++) {
+                Simplify::Triangle t;
+                t.deleted = 0;
+                t.dirty = 0;
+                for (double& j : t.err) {
+                    j = 0.0;
+                }
+                for (int j = 0; j < 3; j++) {
+                    PointIndex pointIndex = facets[order[i]]._aulPoints[j];
+                    auto it = std::lower_bound(localPoints.begin(), localPoints.end(), pointIndex);
+                    t.v[j] = static_cast<int>(it - localPoints.begin());
+                }
+                alg.triangles.push_back(t);
+            }
+
+            int target = static_cast<int>(double(end - begin) * ratio);
+            alg.simplify_mesh(target, tolerance);
+
+            SimplifiedBlock simplified;
+            takeSimplify(alg, simplified.points, simplified.facets);
+            simplified.globalIndex.reserve(alg.vertices.size());
+            for (const auto& vertex : alg.vertices) {
+                simplified.globalIndex.push_back(vertex.lockid > 0
+                                                     ? static_cast<PointIndex>(vertex.lockid - 1)
+                                                     : POINT_INDEX_MAX);
+            }
+            result.push_back(std::move(simplified));
+        }
+        return true;
+    };
+
+    int threads = int(std::thread::hardware_concurrency());
+    std::vector<SimplifiedBlock> simplified =
+        parallel_collect<SimplifiedBlock>(blocks.size(), 1, threads, decimate);
+
+    // Stitch the blocks together at their locked vertices
+    MeshPointArray new_points;
     MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            MeshFacet face;
-            face._aulPoints[0] = triangle.v[0];
-            face._aulPoints[1] = triangle.v[1];
-            face._aulPoints[2] = triangle.v[2];
-            new_facets.push_back(face);
+    std::unordered_map<PointIndex, PointIndex> sharedPoints;
+    for (const auto& block : simplified) {
+        std::vector<PointIndex> localToGlobal(block.points.size());
+        for (std::size_t i = 0; i < block.points.size(); i++) {
+            PointIndex globalIndex = block.globalIndex[i];
+            if (globalIndex != POINT_INDEX_MAX) {
+                auto it = sharedPoints.find(globalIndex);
+                if (it != sharedPoints.end()) {
+                    localToGlobal[i] = it->second;
+                    continue;
+                }
+                sharedPoints[globalIndex] = static_cast<PointIndex>(new_points.size());
+            }
+            localToGlobal[i] = static_cast<PointIndex>(new_points.size());
+            new_points.push_back(block.points[i]);
+        }
+
+        for (const auto& facet : block.facets) {
+            new_facets.emplace_back(localToGlobal[facet._aulPoints[0]],
+                                    localToGlobal[facet._aulPoints[1]],
+                                    localToGlobal[facet._aulPoints[2]]);
         }
     }
 
+    simplified.clear();
+    order.clear();
+    owner.clear();
+
+    // A final pass reduces the facets along the block boundaries. It only loads the
+    // facets around the formerly locked vertices, not the whole mesh.
+    std::vector<bool> seam(new_points.size(), false);
+    for (const auto& it : sharedPoints) {
+        seam[it.second] = true;
+    }
+    sharedPoints.clear();
+    simplifySeams(new_points, new_facets, seam, targetSize, tolerance);
     myKernel.Adopt(new_points, new_facets, true);
 }
@@ -24,6 +24,7 @@
 #ifndef MESH_DECIMATION_H
 #define MESH_DECIMATION_H
 
+#include <cstddef>
 #include <Mod/Mesh/MeshGlobal.h>
 
 namespace MeshCore
@@ -36,9 +37,23 @@ public:
     MeshSimplify(MeshKernel&);  // explicit bombs
     void simplify(float tolerance, float reduction);
     void simplify(int targetSize);
+    /**
+     * If the mesh has more than \a size facets it is split into spatial blocks of at most
+     * \a size facets. The blocks are decimated in parallel while the vertices they share
+     * are locked. Afterwards the blocks are stitched together and a final pass over the
+     * facets around the shared vertices reduces the remaining facets. This needs much less
+     * memory for huge meshes because only the blocks being processed, and at the end the
+     * band along the block boundaries, must be held in the decimation structures.
+     * A size of 0 disables the block mode which is the default.
+     */
+    void setBlockSize(std::size_t size);
+
+private:
+    void simplifyBlocks(int targetSize, double tolerance);
 
 private:
     MeshKernel& myKernel;
+    std::size_t blockSize {0};
 };
 
 }  // namespace MeshCore
@@ -26,11 +26,13 @@
 #include <algorithm>
 #include <map>
 #include <queue>
+#include <thread>
 #endif
 
 #include <boost/math/special_functions/fpclassify.hpp>
 
 #include "Degeneration.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "TopoAlgorithm.h"
@@ -39,6 +41,30 @@
 
 using namespace MeshCore;
 
+namespace
+{
+// Returns the sorted indices of all facets for which pred returns true. The facets are checked
+// in parallel. If firstOnly is true the search stops after the first match.
+template<class Pred>
+std::vector<FacetIndex> collectFacets(const MeshKernel& mesh, Pred pred, bool firstOnly = false)
+{
+    auto check = [&](std::size_t first, std::size_t last, std::vector<FacetIndex>& result) {
+        for (std::size_t index = first; index < last; index++) {
+            if (pred(FacetIndex(index))) {
+                result.push_back(FacetIndex(index));
+                if (firstOnly) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    int threads = int(std::thread::hardware_concurrency());
+    return parallel_collect<FacetIndex>(mesh.CountFacets(), 0x10000, threads, check);
+}
+}  // namespace
+
 bool MeshEvalInvalids::Evaluate()
 {
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
@@ -397,7 +423,8 @@ std::vector<FacetIndex> MeshEvalDuplicateFacets::GetIndices() const
     // if there are two adjacent faces which references the same vertices
     std::vector<FacetIndex> aInds;
     MeshFacet_EqualTo pred;
-    std::sort(faces.begin(), faces.end(), MeshFacet_Less());
+    int threads = int(std::thread::hardware_concurrency());
+    MeshCore::parallel_sort(faces.begin(), faces.end(), MeshFacet_Less(), threads);
 
     std::vector<FaceIterator>::iterator ft = faces.begin();
     while (ft < faces.end()) {
@@ -476,14 +503,10 @@ bool MeshEvalInternalFacets::Evaluate()
 
 bool MeshEvalDegeneratedFacets::Evaluate()
 {
-    MeshFacetIterator it(_rclMesh);
-    for (it.Init(); it.More(); it.Next()) {
-        if (it->IsDegenerated(fEpsilon)) {
-            return false;
-        }
-    }
-
-    return true;
+    auto degenerated = [this](FacetIndex index) {
+        return _rclMesh.GetFacet(index).IsDegenerated(fEpsilon);
+    };
+    return collectFacets(_rclMesh, degenerated, true).empty();
 }
 
 unsigned long MeshEvalDegeneratedFacets::CountEdgeTooSmall(float fMinEdgeLength) const
@@ -506,15 +529,10 @@ unsigned long MeshEvalDegeneratedFacets::CountEdgeTooSmall(float fMinEdgeLength)
 
 std::vector<FacetIndex> MeshEvalDegeneratedFacets::GetIndices() const
 {
-    std::vector<FacetIndex> aInds;
-    MeshFacetIterator it(_rclMesh);
-    for (it.Init(); it.More(); it.Next()) {
-        if (it->IsDegenerated(fEpsilon)) {
-            aInds.push_back(it.Position());
-        }
-    }
-
-    return aInds;
+    auto degenerated = [this](FacetIndex index) {
+        return _rclMesh.GetFacet(index).IsDegenerated(fEpsilon);
+    };
+    return collectFacets(_rclMesh, degenerated);
 }
 
 bool MeshFixDegeneratedFacets::Fixup()
@@ -719,14 +737,10 @@ bool MeshEvalDeformedFacets::Evaluate()
     float fCosMinAngle = cos(fMinAngle);
     float fCosMaxAngle = cos(fMaxAngle);
 
-    MeshFacetIterator it(_rclMesh);
-    for (it.Init(); it.More(); it.Next()) {
-        if (it->IsDeformed(fCosMinAngle, fCosMaxAngle)) {
-            return false;
-        }
-    }
-
-    return true;
+    auto deformed = [&](FacetIndex index) {
+        return _rclMesh.GetFacet(index).IsDeformed(fCosMinAngle, fCosMaxAngle);
+    };
+    return collectFacets(_rclMesh, deformed, true).empty();
 }
 
 std::vector<FacetIndex> MeshEvalDeformedFacets::GetIndices() const
@@ -734,15 +748,10 @@ std::vector<FacetIndex> MeshEvalDeformedFacets::GetIndices() const
     float fCosMinAngle = cos(fMinAngle);
     float fCosMaxAngle = cos(fMaxAngle);
 
-    std::vector<FacetIndex> aInds;
-    MeshFacetIterator it(_rclMesh);
-    for (it.Init(); it.More(); it.Next()) {
-        if (it->IsDeformed(fCosMinAngle, fCosMaxAngle)) {
-            aInds.push_back(it.Position());
-        }
-    }
-
-    return aInds;
+    auto deformed = [&](FacetIndex index) {
+        return _rclMesh.GetFacet(index).IsDeformed(fCosMinAngle, fCosMaxAngle);
+    };
+    return collectFacets(_rclMesh, deformed);
 }
 
 bool MeshFixDeformedFacets::Fixup()
@@ -932,27 +941,32 @@ bool MeshFixDentsOnSurface::Fixup()
 
 bool MeshEvalFoldsOnSurface::Evaluate()
 {
-    this->indices.clear();
     const MeshFacetArray& rFAry = _rclMesh.GetFacets();
-    unsigned long ct = 0;
-    for (MeshFacetArray::const_iterator it = rFAry.begin(); it != rFAry.end(); ++it, ct++) {
-        for (int i = 0; i < 3; i++) {
-            FacetIndex n1 = it->_aulNeighbours[i];
-            FacetIndex n2 = it->_aulNeighbours[(i + 1) % 3];
-            Base::Vector3f v1 = _rclMesh.GetFacet(*it).GetNormal();
-            if (n1 != FACET_INDEX_MAX && n2 != FACET_INDEX_MAX) {
-                Base::Vector3f v2 = _rclMesh.GetFacet(n1).GetNormal();
-                Base::Vector3f v3 = _rclMesh.GetFacet(n2).GetNormal();
-                if (v2 * v3 > 0.0f) {
-                    if (v1 * v2 < -0.1f && v1 * v3 < -0.1f) {
-                        indices.push_back(n1);
-                        indices.push_back(n2);
-                        indices.push_back(ct);
+    auto findFolds = [&](std::size_t first, std::size_t last, std::vector<FacetIndex>& result) {
+        for (std::size_t ct = first; ct < last; ct++) {
+            const MeshFacet& face = rFAry[ct];
+            Base::Vector3f v1 = _rclMesh.GetFacet(face).GetNormal();
+            for (int i = 0; i < 3; i++) {
+                FacetIndex n1 = face._aulNeighbours[i];
+                FacetIndex n2 = face._aulNeighbours[(i + 1) % 3];
+                if (n1 != FACET_INDEX_MAX && n2 != FACET_INDEX_MAX) {
+                    Base::Vector3f v2 = _rclMesh.GetFacet(n1).GetNormal();
+                    Base::Vector3f v3 = _rclMesh.GetFacet(n2).GetNormal();
+                    if (v2 * v3 > 0.0f) {
+                        if (v1 * v2 < -0.1f && v1 * v3 < -0.1f) {
+                            result.push_back(n1);
+                            result.push_back(n2);
+                            result.push_back(FacetIndex(ct));
+                        }
                     }
                 }
             }
         }
-    }
+        return true;
+    };
+
+    int threads = int(std::thread::hardware_concurrency());
+    this->indices = parallel_collect<FacetIndex>(rFAry.size(), 0x10000, threads, findFolds);
 
     // remove duplicates
     std::sort(this->indices.begin(), this->indices.end());
@@ -1179,29 +1193,21 @@ bool MeshEvalCorruptedFacets::Evaluate()
 {
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
 
-    for (const auto& it : rFaces) {
-        // duplicated point indices
-        if (it.IsDegenerated()) {
-            return false;
-        }
-    }
-
-    return true;
+    // duplicated point indices
+    auto corrupted = [&rFaces](FacetIndex index) {
+        return rFaces[index].IsDegenerated();
+    };
+    return collectFacets(_rclMesh, corrupted, true).empty();
 }
 
 std::vector<FacetIndex> MeshEvalCorruptedFacets::GetIndices() const
 {
-    std::vector<FacetIndex> aInds;
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    FacetIndex ind = 0;
-
-    for (MeshFacetArray::_TConstIterator it = rFaces.begin(); it != rFaces.end(); ++it, ind++) {
-        if (it->IsDegenerated()) {
-            aInds.push_back(ind);
-        }
-    }
 
-    return aInds;
+    auto corrupted = [&rFaces](FacetIndex index) {
+        return rFaces[index].IsDegenerated();
+    };
+    return collectFacets(_rclMesh, corrupted);
 }
 
 bool MeshFixCorruptedFacets::Fixup()
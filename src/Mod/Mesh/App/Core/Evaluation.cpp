@@ -24,6 +24,7 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <thread>
 #include <vector>
 #endif
 
@@ -598,186 +599,141 @@ bool MeshFixSingleFacet::Fixup()
 
 // ----------------------------------------------------------------
 
-bool MeshEvalSelfIntersection::Evaluate()
+namespace
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
+using FacetPair = std::pair<FacetIndex, FacetIndex>;
 
+// Returns the pairs of intersecting facets. The grid cells are checked in parallel and the
+// result is ordered as if the cells were processed one after another. If firstOnly is true
+// the search stops after the first intersection.
+std::vector<FacetPair> findSelfIntersections(const MeshKernel& mesh, bool firstOnly, bool canAbort)
+{
     // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
+    MeshFacetGrid cMeshFacetGrid(mesh);
+    const MeshFacetArray& rFaces = mesh.GetFacets();
     unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
     cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
 
-    MeshFacetIterator cMFI(_rclMesh);
+    // Contains bounding boxes for every facet
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(rFaces.size());
+    MeshFacetIterator cMFI(mesh);
     for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
         boxes.push_back((*cMFI).GetBoundBox());
     }
 
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
+    auto checkCells = [&](std::size_t first, std::size_t last, std::vector<FacetPair>& result) {
         std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next();
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
         MeshGeomFacet facet1, facet2;
         Base::Vector3f pt1, pt2;
-        for (std::vector<FacetIndex>::iterator it = aulGridElements.begin();
-             it != aulGridElements.end();
-             ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (std::vector<FacetIndex>::iterator jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
+        for (std::size_t cell = first; cell < last; cell++) {
+            // Get the facet indices, belonging to the current grid unit
+            unsigned long ulX = cell % ulGridX;
+            unsigned long ulY = (cell / ulGridX) % ulGridY;
+            unsigned long ulZ = cell / (ulGridX * ulGridY);
+            aulGridElements.clear();
+            cMeshFacetGrid.GetElements(ulX, ulY, ulZ, aulGridElements);
+
+            for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
+                const Base::BoundBox3f& box1 = boxes[*it];
+                facet1 = mesh.GetFacet(*it);
+                const MeshFacet& rface1 = rFaces[*it];
+                for (auto jt = it + 1; jt != aulGridElements.end(); ++jt) {
+                    // If the facets share a common vertex we do not check for self-intersections
+                    // because they could but usually do not intersect each other and the
+                    // algorithm below would detect false-positives, otherwise
+                    const MeshFacet& rface2 = rFaces[*jt];
+                    if (rface1._aulPoints[0] == rface2._aulPoints[0]
+                        || rface1._aulPoints[0] == rface2._aulPoints[1]
+                        || rface1._aulPoints[0] == rface2._aulPoints[2]) {
+                        continue;  // ignore facets sharing a common vertex
+                    }
+                    if (rface1._aulPoints[1] == rface2._aulPoints[0]
+                        || rface1._aulPoints[1] == rface2._aulPoints[1]
+                        || rface1._aulPoints[1] == rface2._aulPoints[2]) {
+                        continue;  // ignore facets sharing a common vertex
+                    }
+                    if (rface1._aulPoints[2] == rface2._aulPoints[0]
+                        || rface1._aulPoints[2] == rface2._aulPoints[1]
+                        || rface1._aulPoints[2] == rface2._aulPoints[2]) {
+                        continue;  // ignore facets sharing a common vertex
+                    }
 
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
+                    const Base::BoundBox3f& box2 = boxes[*jt];
+                    if (box1 && box2) {
+                        facet2 = mesh.GetFacet(*jt);
+                        int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
+                        if (ret == 2) {
+                            result.emplace_back(*it, *jt);
+                            if (firstOnly) {
+                                // abort after the first detected self-intersection
+                                return false;
+                            }
+                        }
                     }
                 }
             }
         }
-    }
 
-    return true;
+        return true;
+    };
+
+    // Calculates the intersections
+    std::size_t numCells = std::size_t(ulGridX) * ulGridY * ulGridZ;
+    std::size_t chunkSize = std::max<std::size_t>(numCells / 1024, 1);
+    std::size_t numChunks = (numCells + chunkSize - 1) / chunkSize;
+    Base::SequencerLauncher seq("Checking for self-intersections...", numChunks);
+    std::size_t reported = 0;
+    auto progress = [&](std::size_t done) {
+        for (; reported < done; reported++) {
+            seq.next(canAbort);
+        }
+    };
+
+    int threads = int(std::thread::hardware_concurrency());
+    return parallel_collect<FacetPair>(numCells, chunkSize, threads, checkCells, progress);
+}
+}  // namespace
+
+bool MeshEvalSelfIntersection::Evaluate()
+{
+    return findSelfIntersections(_rclMesh, true, false).empty();
 }
 
 void MeshEvalSelfIntersection::GetIntersections(
     const std::vector<std::pair<FacetIndex, FacetIndex>>& indices,
     std::vector<std::pair<Base::Vector3f, Base::Vector3f>>& intersection) const
 {
-    intersection.reserve(indices.size());
-    MeshFacetIterator cMF1(_rclMesh);
-    MeshFacetIterator cMF2(_rclMesh);
-
-    Base::Vector3f pt1, pt2;
-    std::vector<std::pair<FacetIndex, FacetIndex>>::const_iterator it;
-    for (it = indices.begin(); it != indices.end(); ++it) {
-        cMF1.Set(it->first);
-        cMF2.Set(it->second);
-
-        Base::BoundBox3f box1 = cMF1->GetBoundBox();
-        Base::BoundBox3f box2 = cMF2->GetBoundBox();
-        if (box1 && box2) {
-            int ret = cMF1->IntersectWithFacet(*cMF2, pt1, pt2);
-            if (ret == 2) {
-                intersection.emplace_back(pt1, pt2);
+    using PointPair = std::pair<Base::Vector3f, Base::Vector3f>;
+    auto intersect = [&](std::size_t first, std::size_t last, std::vector<PointPair>& result) {
+        Base::Vector3f pt1, pt2;
+        for (std::size_t index = first; index < last; index++) {
+            MeshGeomFacet facet1 = _rclMesh.GetFacet(indices[index].first);
+            MeshGeomFacet facet2 = _rclMesh.GetFacet(indices[index].second);
+
+            Base::BoundBox3f box1 = facet1.GetBoundBox();
+            Base::BoundBox3f box2 = facet2.GetBoundBox();
+            if (box1 && box2) {
+                int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
+                if (ret == 2) {
+                    result.emplace_back(pt1, pt2);
+                }
             }
         }
-    }
+        return true;
+    };
+
+    int threads = int(std::thread::hardware_concurrency());
+    std::vector<PointPair> points =
+        parallel_collect<PointPair>(indices.size(), 4096, threads, intersect);
+    intersection.insert(intersection.end(), points.begin(), points.end());
 }
 
 void MeshEvalSelfIntersection::GetIntersections(
     std::vector<std::pair<FacetIndex, FacetIndex>>& intersection) const
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-    // intersection.clear();
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next(true);
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (std::vector<FacetIndex>::iterator it = aulGridElements.begin();
-             it != aulGridElements.end();
-             ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (std::vector<FacetIndex>::iterator jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back(*it, *jt);
-                    }
-                }
-            }
-        }
-    }
+    std::vector<FacetPair> pairs = findSelfIntersections(_rclMesh, false, true);
+    intersection.insert(intersection.end(), pairs.begin(), pairs.end());
 }
 
 std::vector<FacetIndex> MeshFixSelfIntersection::GetFacets() const
@@ -24,7 +24,9 @@
 #define MESH_FUNCTIONAL_H
 
 #include <algorithm>
+#include <atomic>
 #include <future>
+#include <vector>
 
 
 namespace MeshCore
@@ -62,6 +64,85 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/**
+ * Splits the range [0, count) into chunks of \a chunkSize indices and calls
+ * \a func(first, last, result) for each chunk using \a threads threads. Every chunk
+ * collects into its own vector and the vectors are concatenated in chunk order, so the
+ * returned sequence is the same as of a sequential run. If \a func returns false the
+ * remaining chunks are skipped.
+ * \a progress(done) is invoked from the calling thread with the number of finished chunks.
+ * It may throw to cancel the operation.
+ */
+template<class Result, class Func, class Progress>
+std::vector<Result>
+parallel_collect(std::size_t count, std::size_t chunkSize, int threads, Func func, Progress progress)
+{
+    chunkSize = std::max<std::size_t>(chunkSize, 1);
+    std::size_t numChunks = (count + chunkSize - 1) / chunkSize;
+    std::vector<std::vector<Result>> chunks(numChunks);
+    std::atomic<std::size_t> next {0};
+    std::atomic<std::size_t> done {0};
+    std::atomic<bool> stop {false};
+
+    auto work = [&](auto&& notify) {
+        try {
+            for (std::size_t index = next++; index < numChunks && !stop; index = next++) {
+                std::size_t first = index * chunkSize;
+                std::size_t last = std::min(first + chunkSize, count);
+                if (!func(first, last, chunks[index])) {
+                    stop = true;
+                }
+                ++done;
+                notify();
+            }
+        }
+        catch (...) {
+            stop = true;
+            throw;
+        }
+    };
+
+    std::vector<std::future<void>> tasks;
+    std::size_t numTasks = std::min<std::size_t>(std::max(threads, 1), numChunks);
+    for (std::size_t i = 1; i < numTasks; i++) {
+        tasks.push_back(std::async(std::launch::async, work, [] {}));
+    }
+
+    try {
+        work([&] {
+            progress(done.load());
+        });
+    }
+    catch (...) {
+        for (auto& it : tasks) {
+            it.wait();
+        }
+        throw;
+    }
+
+    for (auto& it : tasks) {
+        it.get();
+    }
+
+    std::size_t total = 0;
+    for (const auto& it : chunks) {
+        total += it.size();
+    }
+
+    std::vector<Result> result;
+    result.reserve(total);
+    for (const auto& it : chunks) {
+        result.insert(result.end(), it.begin(), it.end());
+    }
+    return result;
+}
+
+template<class Result, class Func>
+std::vector<Result> parallel_collect(std::size_t count, std::size_t chunkSize, int threads, Func func)
+{
+    return parallel_collect<Result>(count, chunkSize, threads, func, [](std::size_t) {});
+}
+
 }  // namespace MeshCore
 
 
@@ -112,6 +112,16 @@ public:
                               std::set<ElementIndex>& raclInd) const;
     unsigned long GetElements(const Base::Vector3f& rclPoint,
                               std::vector<ElementIndex>& aulFacets) const;
+    /** Appends the indices of the elements in the given grid. */
+    void GetElements(unsigned long ulX,
+                     unsigned long ulY,
+                     unsigned long ulZ,
+                     std::vector<ElementIndex>& raulElements) const
+    {
+        raulElements.insert(raulElements.end(),
+                            _aulGrid[ulX][ulY][ulZ].begin(),
+                            _aulGrid[ulX][ulY][ulZ].end());
+    }
     //@}
 
     /** Returns the lengths of the grid elements in x,y and z direction. */
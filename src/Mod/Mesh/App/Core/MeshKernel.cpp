@@ -62,6 +62,7 @@ MeshKernel::MeshKernel(MeshKernel&& rclMesh)
 MeshKernel& MeshKernel::operator=(const MeshKernel& rclMesh)
 {
     if (this != &rclMesh) {  // must be a different instance
+        Touch();
         this->_aclPointArray = rclMesh._aclPointArray;
         this->_aclFacetArray = rclMesh._aclFacetArray;
         this->_clBoundBox = rclMesh._clBoundBox;
@@ -73,6 +74,7 @@ MeshKernel& MeshKernel::operator=(const MeshKernel& rclMesh)
 MeshKernel& MeshKernel::operator=(MeshKernel&& rclMesh)
 {
     if (this != &rclMesh) {  // must be a different instance
+        Touch();
         this->_aclPointArray = std::move(rclMesh._aclPointArray);
         this->_aclFacetArray = std::move(rclMesh._aclFacetArray);
         this->_clBoundBox = rclMesh._clBoundBox;
@@ -99,6 +101,7 @@ void MeshKernel::Assign(const MeshPointArray& rPoints,
                         const MeshFacetArray& rFacets,
                         bool checkNeighbourHood)
 {
+    Touch();
     _aclPointArray = rPoints;
     _aclFacetArray = rFacets;
     RecalcBoundBox();
@@ -109,6 +112,7 @@ void MeshKernel::Assign(const MeshPointArray& rPoints,
 
 void MeshKernel::Adopt(MeshPointArray& rPoints, MeshFacetArray& rFacets, bool checkNeighbourHood)
 {
+    Touch();
     _aclPointArray.swap(rPoints);
     _aclFacetArray.swap(rFacets);
     RecalcBoundBox();
@@ -119,6 +123,8 @@ void MeshKernel::Adopt(MeshPointArray& rPoints, MeshFacetArray& rFacets, bool ch
 
 void MeshKernel::Swap(MeshKernel& mesh)
 {
+    Touch();
+    mesh.Touch();
     this->_aclPointArray.swap(mesh._aclPointArray);
     this->_aclFacetArray.swap(mesh._aclFacetArray);
     this->_clBoundBox = mesh._clBoundBox;
@@ -132,6 +138,7 @@ MeshKernel& MeshKernel::operator+=(const MeshGeomFacet& rclSFacet)
 
 void MeshKernel::AddFacet(const MeshGeomFacet& rclSFacet)
 {
+    Touch();
     MeshFacet clFacet;
 
     // set corner points
@@ -192,6 +199,7 @@ void MeshKernel::AddFacets(const std::vector<MeshGeomFacet>& rclFAry)
 
 unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry, bool checkManifolds)
 {
+    Touch();
     // Build map of edges of the referencing facets we want to append
 #ifdef FC_DEBUG
     unsigned long countPoints = CountPoints();
@@ -382,6 +390,7 @@ void MeshKernel::Merge(const MeshKernel& rKernel)
 
 void MeshKernel::Merge(const MeshPointArray& rPoints, const MeshFacetArray& rFaces)
 {
+    Touch();
     if (rPoints.empty() || rFaces.empty()) {
         return;  // nothing to do
     }
@@ -439,12 +448,14 @@ void MeshKernel::Merge(const MeshPointArray& rPoints, const MeshFacetArray& rFac
 
 void MeshKernel::Cleanup()
 {
+    Touch();
     MeshCleanup meshCleanup(_aclPointArray, _aclFacetArray);
     meshCleanup.RemoveInvalids();
 }
 
 void MeshKernel::Clear()
 {
+    Touch();
     _aclPointArray.clear();
     _aclFacetArray.clear();
 
@@ -457,6 +468,7 @@ void MeshKernel::Clear()
 
 bool MeshKernel::DeleteFacet(const MeshFacetIterator& rclIter)
 {
+    Touch();
     FacetIndex ulNFacet {}, ulInd {};
 
     if (rclIter._clIter >= _aclFacetArray.end()) {
@@ -508,6 +520,7 @@ bool MeshKernel::DeleteFacet(FacetIndex ulInd)
 
 void MeshKernel::DeleteFacets(const std::vector<FacetIndex>& raulFacets)
 {
+    Touch();
     _aclPointArray.SetProperty(0);
 
     // number of referencing facets per point
@@ -553,6 +566,7 @@ bool MeshKernel::DeletePoint(PointIndex ulInd)
 
 bool MeshKernel::DeletePoint(const MeshPointIterator& rclIter)
 {
+    Touch();
     MeshFacetIterator pFIter(*this), pFEnd(*this);
     std::vector<MeshFacetIterator> clToDel;
     PointIndex ulInd {};
@@ -586,6 +600,7 @@ bool MeshKernel::DeletePoint(const MeshPointIterator& rclIter)
 
 void MeshKernel::DeletePoints(const std::vector<PointIndex>& raulPoints)
 {
+    Touch();
     _aclPointArray.ResetInvalid();
     for (PointIndex ptIndex : raulPoints) {
         _aclPointArray[ptIndex].SetInvalid();
@@ -622,6 +637,7 @@ void MeshKernel::DeletePoints(const std::vector<PointIndex>& raulPoints)
 
 void MeshKernel::ErasePoint(PointIndex ulIndex, FacetIndex ulFacetIndex, bool bOnlySetInvalid)
 {
+    Touch();
     std::vector<MeshFacet>::iterator pFIter, pFEnd, pFNot;
 
     pFIter = _aclFacetArray.begin();
@@ -671,6 +687,7 @@ void MeshKernel::ErasePoint(PointIndex ulIndex, FacetIndex ulFacetIndex, bool bO
 
 void MeshKernel::RemoveInvalids()
 {
+    Touch();
     std::vector<unsigned long> aulDecrements;
     std::vector<unsigned long>::iterator pDIter;
     unsigned long ulDec {};
@@ -901,17 +918,35 @@ void MeshKernel::Write(std::ostream& rclOut) const
     // write the number of points and facets
     str << static_cast<uint32_t>(CountPoints()) << static_cast<uint32_t>(CountFacets());
 
-    // write the data
-    for (const auto& it : _aclPointArray) {
-        str << it.x << it.y << it.z;
+    // write the data block-wise
+    const std::size_t blockSize = 16384;
+    std::vector<float> coords;
+    for (std::size_t i = 0; i < _aclPointArray.size(); i += blockSize) {
+        std::size_t end = std::min(i + blockSize, _aclPointArray.size());
+        coords.clear();
+        for (std::size_t j = i; j < end; j++) {
+            const MeshPoint& pnt = _aclPointArray[j];
+            coords.push_back(pnt.x);
+            coords.push_back(pnt.y);
+            coords.push_back(pnt.z);
+        }
+        str.write(coords.data(), coords.size());
     }
 
-    for (const auto& it : _aclFacetArray) {
-        str << static_cast<uint32_t>(it._aulPoints[0]) << static_cast<uint32_t>(it._aulPoints[1])
-            << static_cast<uint32_t>(it._aulPoints[2]);
-        str << static_cast<uint32_t>(it._aulNeighbours[0])
-            << static_cast<uint32_t>(it._aulNeighbours[1])
-            << static_cast<uint32_t>(it._aulNeighbours[2]);
+    std::vector<uint32_t> indices;
+    for (std::size_t i = 0; i < _aclFacetArray.size(); i += blockSize) {
+        std::size_t end = std::min(i + blockSize, _aclFacetArray.size());
+        indices.clear();
+        for (std::size_t j = i; j < end; j++) {
+            const MeshFacet& face = _aclFacetArray[j];
+            for (auto index : face._aulPoints) {
+                indices.push_back(static_cast<uint32_t>(index));
+            }
+            for (auto index : face._aulNeighbours) {
+                indices.push_back(static_cast<uint32_t>(index));
+            }
+        }
+        str.write(indices.data(), indices.size());
     }
 
     str << _clBoundBox.MinX << _clBoundBox.MaxX;
@@ -921,6 +956,7 @@ void MeshKernel::Write(std::ostream& rclOut) const
 
 void MeshKernel::Read(std::istream& rclIn)
 {
+    Touch();
     if (!rclIn || rclIn.bad()) {
         return;
     }
@@ -956,65 +992,59 @@ void MeshKernel::Read(std::istream& rclIn)
         str >> uCtPts >> uCtFts;
 
         try {
-            // read the data
+            // read the data block-wise
+            const std::size_t blockSize = 16384;
             MeshPointArray pointArray;
             pointArray.resize(uCtPts);
-            for (auto& it : pointArray) {
-                str >> it.x >> it.y >> it.z;
+
+            std::vector<float> coords;
+            for (std::size_t i = 0; i < uCtPts; i += blockSize) {
+                std::size_t num = std::min<std::size_t>(blockSize, uCtPts - i);
+                coords.resize(3 * num);
+                str.read(coords.data(), coords.size());
+                for (std::size_t j = 0; j < num; j++) {
+                    MeshPoint& pnt = pointArray[i + j];
+                    pnt.x = coords[3 * j];
+                    pnt.y = coords[3 * j + 1];
+                    pnt.z = coords[3 * j + 2];
+                }
             }
 
             MeshFacetArray facetArray;
             facetArray.resize(uCtFts);
 
-            uint32_t v1 {}, v2 {}, v3 {};
-            for (auto& it : facetArray) {
-                str >> v1 >> v2 >> v3;
-
-                // make sure to have valid indices
-                if (v1 >= uCtPts || v2 >= uCtPts || v3 >= uCtPts) {
-                    throw Base::BadFormatError("Invalid data structure");
-                }
-
-                it._aulPoints[0] = v1;
-                it._aulPoints[1] = v2;
-                it._aulPoints[2] = v3;
-
-                // On systems where an 'unsigned long' is a 64-bit value
-                // the empty neighbour must be explicitly set to 'FACET_INDEX_MAX'
-                // because in algorithms this value is always used to check
-                // for open edges.
-                str >> v1 >> v2 >> v3;
-
-                // make sure to have valid indices
-                if (v1 >= uCtFts && v1 < open_edge) {
-                    throw Base::BadFormatError("Invalid data structure");
-                }
-                if (v2 >= uCtFts && v2 < open_edge) {
-                    throw Base::BadFormatError("Invalid data structure");
-                }
-                if (v3 >= uCtFts && v3 < open_edge) {
-                    throw Base::BadFormatError("Invalid data structure");
-                }
-
-                if (v1 < open_edge) {
-                    it._aulNeighbours[0] = v1;
-                }
-                else {
-                    it._aulNeighbours[0] = FACET_INDEX_MAX;
-                }
-
-                if (v2 < open_edge) {
-                    it._aulNeighbours[1] = v2;
-                }
-                else {
-                    it._aulNeighbours[1] = FACET_INDEX_MAX;
-                }
+            std::vector<uint32_t> indices;
+            for (std::size_t i = 0; i < uCtFts; i += blockSize) {
+                std::size_t num = std::min<std::size_t>(blockSize, uCtFts - i);
+                indices.resize(6 * num);
+                str.read(indices.data(), indices.size());
+                for (std::size_t j = 0; j < num; j++) {
+                    MeshFacet& face = facetArray[i + j];
+                    const uint32_t* index = &indices[6 * j];
+                    for (int k = 0; k < 3; k++) {
+                        // make sure to have valid indices
+                        if (index[k] >= uCtPts) {
+                            throw Base::BadFormatError("Invalid data structure");
+                        }
+                        face._aulPoints[k] = index[k];
+                    }
 
-                if (v3 < open_edge) {
-                    it._aulNeighbours[2] = v3;
-                }
-                else {
-                    it._aulNeighbours[2] = FACET_INDEX_MAX;
+                    // On systems where an 'unsigned long' is a 64-bit value
+                    // the empty neighbour must be explicitly set to 'FACET_INDEX_MAX'
+                    // because in algorithms this value is always used to check
+                    // for open edges.
+                    for (int k = 0; k < 3; k++) {
+                        uint32_t neighbour = index[k + 3];
+                        if (neighbour >= uCtFts && neighbour < open_edge) {
+                            throw Base::BadFormatError("Invalid data structure");
+                        }
+                        if (neighbour < open_edge) {
+                            face._aulNeighbours[k] = neighbour;
+                        }
+                        else {
+                            face._aulNeighbours[k] = FACET_INDEX_MAX;
+                        }
+                    }
                 }
             }
 
@@ -1109,6 +1139,7 @@ void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 
 void MeshKernel::Transform(const Base::Matrix4D& rclMat)
 {
+    Touch();
     MeshPointArray::_TIterator clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
     Base::Matrix4D clMatrix(rclMat);
 
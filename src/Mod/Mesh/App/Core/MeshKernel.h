@@ -161,6 +161,22 @@ public:
         return _bValid;
     }
 
+    /** Returns the modification counter. It gets increased by every method that modifies
+     * the points or facets and allows to check whether data derived from the mesh is still
+     * up-to-date.
+     */
+    unsigned long GetModificationCount() const
+    {
+        return _ulModCount;
+    }
+    /** Increases the modification counter. Code that modifies the point or facet arrays
+     * directly must call this method.
+     */
+    void Touch()
+    {
+        _ulModCount++;
+    }
+
     /** Returns the array of all data points. */
     const MeshPointArray& GetPoints() const
     {
@@ -174,6 +190,7 @@ public:
     /** Returns a modifier for the point array */
     MeshPointModifier ModifyPoints()
     {
+        Touch();
         return MeshPointModifier(_aclPointArray);
     }
 
@@ -190,6 +207,7 @@ public:
     /** Returns a modifier for the facet array */
     MeshFacetModifier ModifyFacets()
     {
+        Touch();
         return MeshFacetModifier(_aclFacetArray);
     }
 
@@ -486,6 +504,7 @@ private:
     MeshFacetArray _aclFacetArray;        /**< Holds the array of facets. */
     mutable Base::BoundBox3f _clBoundBox; /**< The current calculated bounding box. */
     bool _bValid {true};                  /**< Current state of validality. */
+    unsigned long _ulModCount {0};        /**< Modification counter. */
 
     // friends
     friend class MeshPointIterator;
@@ -551,16 +570,19 @@ inline void MeshKernel::GetFacetNeighbours(FacetIndex ulIndex,
 inline void MeshKernel::MovePoint(PointIndex ulPtIndex, const Base::Vector3f& rclTrans)
 {
     _aclPointArray[ulPtIndex] += rclTrans;
+    Touch();
 }
 
 inline void MeshKernel::SetPoint(PointIndex ulPtIndex, const Base::Vector3f& rPoint)
 {
     _aclPointArray[ulPtIndex] = rPoint;
+    Touch();
 }
 
 inline void MeshKernel::SetPoint(PointIndex ulPtIndex, float x, float y, float z)
 {
     _aclPointArray[ulPtIndex].Set(x, y, z);
+    Touch();
 }
 
 inline void MeshKernel::AdjustNormal(MeshFacet& rclFacet, const Base::Vector3f& rclNormal)
@@ -570,6 +592,7 @@ inline void MeshKernel::AdjustNormal(MeshFacet& rclFacet, const Base::Vector3f&
         % (_aclPointArray[rclFacet._aulPoints[2]] - _aclPointArray[rclFacet._aulPoints[0]]);
     if ((clN * rclNormal) < 0.0f) {
         rclFacet.FlipNormal();
+        Touch();
     }
 }
 
@@ -614,6 +637,7 @@ inline void MeshKernel::SetFacetPoints(FacetIndex ulFaIndex,
     rclFacet._aulPoints[0] = rclP0;
     rclFacet._aulPoints[1] = rclP1;
     rclFacet._aulPoints[2] = rclP2;
+    Touch();
 }
 
 
@@ -55,6 +55,7 @@ MeshTopoAlgorithm::~MeshTopoAlgorithm()
 
 bool MeshTopoAlgorithm::InsertVertex(FacetIndex ulFacetPos, const Base::Vector3f& rclPoint)
 {
+    _rclMesh.Touch();
     MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
     MeshFacet clNewFacet1, clNewFacet2;
 
@@ -105,6 +106,7 @@ bool MeshTopoAlgorithm::InsertVertex(FacetIndex ulFacetPos, const Base::Vector3f
 
 bool MeshTopoAlgorithm::SnapVertex(FacetIndex ulFacetPos, const Base::Vector3f& rP)
 {
+    _rclMesh.Touch();
     MeshFacet& rFace = _rclMesh._aclFacetArray[ulFacetPos];
     if (!rFace.HasOpenEdge()) {
         return false;
@@ -141,6 +143,7 @@ bool MeshTopoAlgorithm::SnapVertex(FacetIndex ulFacetPos, const Base::Vector3f&
 
 void MeshTopoAlgorithm::OptimizeTopology(float fMaxAngle)
 {
+    _rclMesh.Touch();
     // For each internal edge get the adjacent facets. When doing an edge swap we must update
     // this structure.
     std::map<std::pair<PointIndex, PointIndex>, std::vector<FacetIndex>> aEdge2Face;
@@ -310,6 +313,7 @@ using FaceEdgePriority = std::pair<float, FaceEdge>;
 
 void MeshTopoAlgorithm::OptimizeTopology()
 {
+    _rclMesh.Touch();
     // Find all edges that can be swapped and insert them into a
     // priority queue
     const MeshFacetArray& faces = _rclMesh.GetFacets();
@@ -354,6 +358,7 @@ void MeshTopoAlgorithm::OptimizeTopology()
 
 void MeshTopoAlgorithm::DelaunayFlip(float fMaxAngle)
 {
+    _rclMesh.Touch();
     // For each internal edge get the adjacent facets.
     std::set<std::pair<FacetIndex, FacetIndex>> aEdge2Face;
     FacetIndex index = 0;
@@ -409,6 +414,7 @@ void MeshTopoAlgorithm::DelaunayFlip(float fMaxAngle)
 
 int MeshTopoAlgorithm::DelaunayFlip()
 {
+    _rclMesh.Touch();
     int cnt_swap = 0;
     _rclMesh._aclFacetArray.ResetFlag(MeshFacet::TMP0);
     size_t cnt_facets = _rclMesh._aclFacetArray.size();
@@ -451,6 +457,7 @@ int MeshTopoAlgorithm::DelaunayFlip()
 
 void MeshTopoAlgorithm::AdjustEdgesToCurvatureDirection()
 {
+    _rclMesh.Touch();
     std::vector<Wm4::Vector3<float>> aPnts;
     MeshPointIterator cPIt(_rclMesh);
     aPnts.reserve(_rclMesh.CountPoints());
@@ -551,6 +558,7 @@ bool MeshTopoAlgorithm::InsertVertexAndSwapEdge(FacetIndex ulFacetPos,
                                                 const Base::Vector3f& rclPoint,
                                                 float fMaxAngle)
 {
+    _rclMesh.Touch();
     if (!InsertVertex(ulFacetPos, rclPoint)) {
         return false;
     }
@@ -682,6 +690,7 @@ bool MeshTopoAlgorithm::ShouldSwapEdge(FacetIndex ulFacetPos,
 
 void MeshTopoAlgorithm::SwapEdge(FacetIndex ulFacetPos, FacetIndex ulNeighbour)
 {
+    _rclMesh.Touch();
     MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
     MeshFacet& rclN = _rclMesh._aclFacetArray[ulNeighbour];
 
@@ -716,6 +725,7 @@ bool MeshTopoAlgorithm::SplitEdge(FacetIndex ulFacetPos,
                                   FacetIndex ulNeighbour,
                                   const Base::Vector3f& rP)
 {
+    _rclMesh.Touch();
     MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
     MeshFacet& rclN = _rclMesh._aclFacetArray[ulNeighbour];
 
@@ -778,6 +788,7 @@ bool MeshTopoAlgorithm::SplitOpenEdge(FacetIndex ulFacetPos,
                                       unsigned short uSide,
                                       const Base::Vector3f& rP)
 {
+    _rclMesh.Touch();
     MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
     if (rclF._aulNeighbours[uSide] != FACET_INDEX_MAX) {
         return false;  // not open
@@ -908,6 +919,7 @@ void MeshTopoAlgorithm::Cleanup()
 
 bool MeshTopoAlgorithm::CollapseVertex(const VertexCollapse& vc)
 {
+    _rclMesh.Touch();
     if (vc._circumFacets.size() != vc._circumPoints.size()) {
         return false;
     }
@@ -978,6 +990,7 @@ bool MeshTopoAlgorithm::CollapseVertex(const VertexCollapse& vc)
 
 bool MeshTopoAlgorithm::CollapseEdge(FacetIndex ulFacetPos, FacetIndex ulNeighbour)
 {
+    _rclMesh.Touch();
     MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
     MeshFacet& rclN = _rclMesh._aclFacetArray[ulNeighbour];
 
@@ -1100,6 +1113,7 @@ bool MeshTopoAlgorithm::IsCollapseEdgeLegal(const EdgeCollapse& ec) const
 
 bool MeshTopoAlgorithm::CollapseEdge(const EdgeCollapse& ec)
 {
+    _rclMesh.Touch();
     std::vector<FacetIndex>::const_iterator it;
     for (it = ec._removeFacets.begin(); it != ec._removeFacets.end(); ++it) {
         MeshFacet& f = _rclMesh._aclFacetArray[*it];
@@ -1142,6 +1156,7 @@ bool MeshTopoAlgorithm::CollapseEdge(const EdgeCollapse& ec)
 
 bool MeshTopoAlgorithm::CollapseFacet(FacetIndex ulFacetPos)
 {
+    _rclMesh.Touch();
     MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
     if (!rclF.IsValid()) {
         return false;  // the facet is marked invalid from a previous run
@@ -1212,6 +1227,7 @@ void MeshTopoAlgorithm::SplitFacet(FacetIndex ulFacetPos,
                                    const Base::Vector3f& rP1,
                                    const Base::Vector3f& rP2)
 {
+    _rclMesh.Touch();
     float fEps = MESH_MIN_EDGE_LEN;
     MeshFacet& rFace = _rclMesh._aclFacetArray[ulFacetPos];
     MeshPoint& rVertex0 = _rclMesh._aclPointArray[rFace._aulPoints[0]];
@@ -1255,6 +1271,7 @@ void MeshTopoAlgorithm::SplitFacet(FacetIndex ulFacetPos,
 
 void MeshTopoAlgorithm::SplitFacetOnOneEdge(FacetIndex ulFacetPos, const Base::Vector3f& rP)
 {
+    _rclMesh.Touch();
     float fMinDist = FLOAT_MAX;
     unsigned short iEdgeNo = USHRT_MAX;
     MeshFacet& rFace = _rclMesh._aclFacetArray[ulFacetPos];
@@ -1285,6 +1302,7 @@ void MeshTopoAlgorithm::SplitFacetOnTwoEdges(FacetIndex ulFacetPos,
                                              const Base::Vector3f& rP1,
                                              const Base::Vector3f& rP2)
 {
+    _rclMesh.Touch();
     // search for the matching edges
     unsigned short iEdgeNo1 = USHRT_MAX, iEdgeNo2 = USHRT_MAX;
     float fMinDist1 = FLOAT_MAX, fMinDist2 = FLOAT_MAX;
@@ -1395,6 +1413,7 @@ void MeshTopoAlgorithm::SplitFacet(FacetIndex ulFacetPos,
                                    PointIndex P2,
                                    PointIndex Pn)
 {
+    _rclMesh.Touch();
     MeshFacet& rFace = _rclMesh._aclFacetArray[ulFacetPos];
     unsigned short side = rFace.Side(P1, P2);
     if (side != USHRT_MAX) {
@@ -1415,6 +1434,7 @@ void MeshTopoAlgorithm::SplitFacet(FacetIndex ulFacetPos,
 
 void MeshTopoAlgorithm::AddFacet(PointIndex P1, PointIndex P2, PointIndex P3)
 {
+    _rclMesh.Touch();
     MeshFacet facet;
     facet._aulPoints[0] = P1;
     facet._aulPoints[1] = P2;
@@ -1430,6 +1450,7 @@ void MeshTopoAlgorithm::AddFacet(PointIndex P1,
                                  FacetIndex N2,
                                  FacetIndex N3)
 {
+    _rclMesh.Touch();
     MeshFacet facet;
     facet._aulPoints[0] = P1;
     facet._aulPoints[1] = P2;
@@ -1474,6 +1495,7 @@ void MeshTopoAlgorithm::SplitNeighbourFacet(FacetIndex ulFacetPos,
                                             unsigned short uFSide,
                                             const Base::Vector3f rPoint)
 {
+    _rclMesh.Touch();
     MeshFacet& rclF = _rclMesh._aclFacetArray[ulFacetPos];
 
     FacetIndex ulNeighbour = rclF._aulNeighbours[uFSide];
@@ -1532,6 +1554,7 @@ void MeshTopoAlgorithm::SplitNeighbourFacet(FacetIndex ulFacetPos,
 
 bool MeshTopoAlgorithm::RemoveDegeneratedFacet(FacetIndex index)
 {
+    _rclMesh.Touch();
     if (index >= _rclMesh._aclFacetArray.size()) {
         return false;
     }
@@ -1608,6 +1631,7 @@ bool MeshTopoAlgorithm::RemoveDegeneratedFacet(FacetIndex index)
 
 bool MeshTopoAlgorithm::RemoveCorruptedFacet(FacetIndex index)
 {
+    _rclMesh.Touch();
     if (index >= _rclMesh._aclFacetArray.size()) {
         return false;
     }
@@ -1642,6 +1666,7 @@ void MeshTopoAlgorithm::FillupHoles(unsigned long length,
                                     AbstractPolygonTriangulator& cTria,
                                     std::list<std::vector<PointIndex>>& aFailed)
 {
+    _rclMesh.Touch();
     // get the mesh boundaries as an array of point indices
     std::list<std::vector<PointIndex>> aBorders, aFillBorders;
     MeshAlgorithm cAlgo(_rclMesh);
@@ -1666,6 +1691,7 @@ void MeshTopoAlgorithm::FillupHoles(int level,
                                     const std::list<std::vector<PointIndex>>& aBorders,
                                     std::list<std::vector<PointIndex>>& aFailed)
 {
+    _rclMesh.Touch();
     // get the facets to a point
     MeshRefPointToFacets cPt2Fac(_rclMesh);
     MeshAlgorithm cAlgo(_rclMesh);
@@ -1768,6 +1794,7 @@ void MeshTopoAlgorithm::FindComponents(unsigned long count, std::vector<FacetInd
 
 void MeshTopoAlgorithm::RemoveComponents(unsigned long count)
 {
+    _rclMesh.Touch();
     std::vector<FacetIndex> removeFacets;
     FindComponents(count, removeFacets);
     if (!removeFacets.empty()) {
@@ -1777,6 +1804,7 @@ void MeshTopoAlgorithm::RemoveComponents(unsigned long count)
 
 void MeshTopoAlgorithm::HarmonizeNormals()
 {
+    _rclMesh.Touch();
     std::vector<FacetIndex> uIndices = MeshEvalOrientation(_rclMesh).GetIndices();
     for (FacetIndex index : uIndices) {
         _rclMesh._aclFacetArray[index].FlipNormal();
@@ -1785,6 +1813,7 @@ void MeshTopoAlgorithm::HarmonizeNormals()
 
 void MeshTopoAlgorithm::FlipNormals()
 {
+    _rclMesh.Touch();
     for (MeshFacetArray::_TIterator i = _rclMesh._aclFacetArray.begin();
          i < _rclMesh._aclFacetArray.end();
          ++i) {
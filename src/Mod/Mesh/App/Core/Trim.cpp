@@ -772,6 +772,7 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
 void MeshTrimming::TrimFacets(const std::vector<FacetIndex>& raulFacets,
                               std::vector<MeshGeomFacet>& aclNewFacets)
 {
+    myMesh.Touch();
     Base::Vector3f clP;
     std::vector<Base::Vector3f> clIntsct;
     int iSide {};
@@ -26,6 +26,7 @@
 #include <sstream>
 #endif
 
+#include <App/Application.h>
 #include <Base/Builder3D.h>
 #include <Base/Console.h>
 #include <Base/Converter.h>
@@ -38,6 +39,7 @@
 #include <Base/ViewProj.h>
 #include <Base/Writer.h>
 
+#include "Core/BVH.h"
 #include "Core/Builder.h"
 #include "Core/Decimation.h"
 #include "Core/Degeneration.h"
@@ -156,6 +158,7 @@ void MeshObject::getFacesFromSubElement(const Data::Segment* element,
 
 void MeshObject::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    _exports.check();
     MeshCore::MeshKernel kernel;
     swap(kernel);
     kernel.Transform(rclMat);
@@ -218,6 +221,7 @@ void MeshObject::swapSegments(MeshObject& mesh)
 MeshObject& MeshObject::operator=(const MeshObject& mesh)
 {
     if (this != &mesh) {
+        _exports.check();
         // copy the mesh structure
         setTransform(mesh._Mtrx);
         this->_kernel = mesh._kernel;
@@ -230,6 +234,7 @@ MeshObject& MeshObject::operator=(const MeshObject& mesh)
 MeshObject& MeshObject::operator=(MeshObject&& mesh)
 {
     if (this != &mesh) {
+        _exports.check();
         // copy the mesh structure
         setTransform(mesh._Mtrx);
         this->_kernel = mesh._kernel;
@@ -241,12 +246,14 @@ MeshObject& MeshObject::operator=(MeshObject&& mesh)
 
 void MeshObject::setKernel(const MeshCore::MeshKernel& m)
 {
+    _exports.check();
     this->_kernel = m;
     this->_segments.clear();
 }
 
 void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 {
+    _exports.check();
     this->_kernel.Swap(Kernel);
     // clear the segments because we don't know how the new
     // topology looks like
@@ -255,6 +262,8 @@ void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 
 void MeshObject::swap(MeshObject& mesh)
 {
+    _exports.check();
+    mesh._exports.check();
     this->_kernel.Swap(mesh._kernel);
     swapSegments(mesh);
     Base::Matrix4D tmp = this->_Mtrx;
@@ -384,11 +393,13 @@ void MeshObject::SaveDocFile(Base::Writer& writer) const
 
 void MeshObject::Restore(Base::XMLReader& /*reader*/)
 {
+    _exports.check();
     // this is handled by the property class
 }
 
 void MeshObject::RestoreDocFile(Base::Reader& reader)
 {
+    _exports.check();
     load(reader);
 }
 
@@ -452,6 +463,7 @@ void MeshObject::save(std::ostream& str,
 
 bool MeshObject::load(const char* file, MeshCore::Material* mat)
 {
+    _exports.check();
     MeshCore::MeshKernel kernel;
     MeshCore::MeshInput aReader(kernel, mat);
     if (!aReader.LoadAny(file)) {
@@ -464,6 +476,7 @@ bool MeshObject::load(const char* file, MeshCore::Material* mat)
 
 bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::Material* mat)
 {
+    _exports.check();
     MeshCore::MeshKernel kernel;
     MeshCore::MeshInput aReader(kernel, mat);
     if (!aReader.LoadFormat(str, f)) {
@@ -476,6 +489,7 @@ bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::M
 
 void MeshObject::swapKernel(MeshCore::MeshKernel& kernel, const std::vector<std::string>& g)
 {
+    _exports.check();
     _kernel.Swap(kernel);
     // Some file formats define several objects per file (e.g. OBJ).
     // Now we mark each object as an own segment so that we can break
@@ -519,6 +533,7 @@ void MeshObject::save(std::ostream& out) const
 
 void MeshObject::load(std::istream& in)
 {
+    _exports.check();
     _kernel.Read(in);
     this->_segments.clear();
 
@@ -573,16 +588,19 @@ void MeshObject::writeInventor(std::ostream& str, float creaseangle) const
 
 void MeshObject::addFacet(const MeshCore::MeshGeomFacet& facet)
 {
+    _exports.check();
     _kernel.AddFacet(facet);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
+    _exports.check();
     _kernel.AddFacets(facets);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet>& facets, bool checkManifolds)
 {
+    _exports.check();
     _kernel.AddFacets(facets, checkManifolds);
 }
 
@@ -590,6 +608,7 @@ void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet>& facets,
                            const std::vector<Base::Vector3f>& points,
                            bool checkManifolds)
 {
+    _exports.check();
     _kernel.AddFacets(facets, points, checkManifolds);
 }
 
@@ -597,6 +616,7 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
                            const std::vector<Base::Vector3d>& points,
                            bool checkManifolds)
 {
+    _exports.check();
     std::vector<MeshCore::MeshFacet> facet_v;
     facet_v.reserve(facets.size());
     for (auto facet : facets) {
@@ -619,12 +639,14 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
 
 void MeshObject::setFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
+    _exports.check();
     _kernel = facets;
 }
 
 void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet>& facets,
                            const std::vector<Base::Vector3d>& points)
 {
+    _exports.check();
     MeshCore::MeshFacetArray facet_v;
     facet_v.reserve(facets.size());
     for (auto facet : facets) {
@@ -647,16 +669,19 @@ void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
 
 void MeshObject::addMesh(const MeshObject& mesh)
 {
+    _exports.check();
     _kernel.Merge(mesh._kernel);
 }
 
 void MeshObject::addMesh(const MeshCore::MeshKernel& kernel)
 {
+    _exports.check();
     _kernel.Merge(kernel);
 }
 
 void MeshObject::deleteFacets(const std::vector<FacetIndex>& removeIndices)
 {
+    _exports.check();
     if (removeIndices.empty()) {
         return;
     }
@@ -666,6 +691,7 @@ void MeshObject::deleteFacets(const std::vector<FacetIndex>& removeIndices)
 
 void MeshObject::deletePoints(const std::vector<PointIndex>& removeIndices)
 {
+    _exports.check();
     if (removeIndices.empty()) {
         return;
     }
@@ -716,6 +742,7 @@ void MeshObject::deletedFacets(const std::vector<FacetIndex>& remFacets)
 
 void MeshObject::deleteSelectedFacets()
 {
+    _exports.check();
     std::vector<FacetIndex> facets;
     MeshCore::MeshAlgorithm(this->_kernel).GetFacetsFlag(facets, MeshCore::MeshFacet::SELECTED);
     deleteFacets(facets);
@@ -723,6 +750,7 @@ void MeshObject::deleteSelectedFacets()
 
 void MeshObject::deleteSelectedPoints()
 {
+    _exports.check();
     std::vector<PointIndex> points;
     MeshCore::MeshAlgorithm(this->_kernel).GetPointsFlag(points, MeshCore::MeshPoint::SELECTED);
     deletePoints(points);
@@ -809,9 +837,9 @@ bool MeshObject::nearestFacetOnRay(const MeshObject::TRay& ray,
 
     FacetIndex index = 0;
     Base::Vector3f res;
-    MeshCore::MeshAlgorithm alg(getKernel());
+    const MeshCore::MeshFacetBVH& bvh = getFacetBVH();
 
-    if (alg.NearestFacetOnRay(pnt, dir, static_cast<float>(maxAngle), res, index)) {
+    if (bvh.NearestFacetOnRay(pnt, dir, static_cast<float>(maxAngle), res, index)) {
         plm.multVec(res, res);
         output.first = index;
         output.second = Base::toVector<double>(res);
@@ -821,6 +849,15 @@ bool MeshObject::nearestFacetOnRay(const MeshObject::TRay& ray,
     return false;
 }
 
+const MeshCore::MeshFacetBVH& MeshObject::getFacetBVH() const
+{
+    if (!_bvh || !_bvh->IsValid(_kernel)) {
+        _bvh = std::make_shared<MeshCore::MeshFacetBVH>(_kernel);
+    }
+
+    return *_bvh;
+}
+
 std::vector<MeshObject::TFaceSection> MeshObject::foraminate(const TRay& ray, double maxAngle) const
 {
     Base::Vector3f pnt = Base::toVector<float>(ray.first);
@@ -893,6 +930,7 @@ unsigned long MeshObject::countComponents() const
 
 void MeshObject::removeComponents(unsigned long count)
 {
+    _exports.check();
     std::vector<FacetIndex> removeIndices;
     MeshCore::MeshTopoAlgorithm(_kernel).FindComponents(count, removeIndices);
     _kernel.DeleteFacets(removeIndices);
@@ -930,6 +968,7 @@ void MeshObject::fillupHoles(unsigned long length,
                              int level,
                              MeshCore::AbstractPolygonTriangulator& cTria)
 {
+    _exports.check();
     std::list<std::vector<PointIndex>> aFailed;
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.FillupHoles(length, level, cTria, aFailed);
@@ -937,6 +976,7 @@ void MeshObject::fillupHoles(unsigned long length,
 
 void MeshObject::offset(float fSize)
 {
+    _exports.check();
     std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
 
     unsigned int i = 0;
@@ -951,6 +991,7 @@ void MeshObject::offset(float fSize)
 
 void MeshObject::offsetSpecial2(float fSize)
 {
+    _exports.check();
     Base::Builder3D builder;
     std::vector<Base::Vector3f> PointNormals = _kernel.CalcVertexNormals();
     std::vector<Base::Vector3f> FaceNormals;
@@ -1018,6 +1059,7 @@ void MeshObject::offsetSpecial2(float fSize)
 
 void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 {
+    _exports.check();
     std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
 
     unsigned int i = 0;
@@ -1038,6 +1080,7 @@ void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 
 void MeshObject::clear()
 {
+    _exports.check();
     _kernel.Clear();
     this->_segments.clear();
     setTransform(Base::Matrix4D());
@@ -1045,6 +1088,7 @@ void MeshObject::clear()
 
 void MeshObject::transformToEigenSystem()
 {
+    _exports.check();
     MeshCore::MeshEigensystem cMeshEval(_kernel);
     cMeshEval.Evaluate();
     this->setTransform(cMeshEval.Transform());
@@ -1061,6 +1105,7 @@ Base::Matrix4D MeshObject::getEigenSystem(Base::Vector3d& v) const
 
 void MeshObject::movePoint(PointIndex index, const Base::Vector3d& v)
 {
+    _exports.check();
     // v is a vector, hence we must not apply the translation part
     // of the transformation to the vector
     Base::Vector3d vec(v);
@@ -1072,23 +1117,39 @@ void MeshObject::movePoint(PointIndex index, const Base::Vector3d& v)
 
 void MeshObject::setPoint(PointIndex index, const Base::Vector3d& p)
 {
+    _exports.check();
     _kernel.SetPoint(index, transformPointToInside(p));
 }
 
 void MeshObject::smooth(int iterations, float d_max)
 {
+    _exports.check();
     _kernel.Smooth(iterations, d_max);
 }
 
+namespace
+{
+std::size_t decimationBlockSize()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Mesh");
+    return hGrp->GetUnsigned("DecimationBlockSize", 2000000);
+}
+}  // namespace
+
 void MeshObject::decimate(float fTolerance, float fReduction)
 {
+    _exports.check();
     MeshCore::MeshSimplify dm(this->_kernel);
+    dm.setBlockSize(decimationBlockSize());
     dm.simplify(fTolerance, fReduction);
 }
 
 void MeshObject::decimate(int targetSize)
 {
+    _exports.check();
     MeshCore::MeshSimplify dm(this->_kernel);
+    dm.setBlockSize(decimationBlockSize());
     dm.simplify(targetSize);
 }
 
@@ -1132,6 +1193,7 @@ void MeshObject::cut(const Base::Polygon2d& polygon2d,
                      const Base::ViewProjMethod& proj,
                      MeshObject::CutType type)
 {
+    _exports.check();
     MeshCore::MeshKernel kernel(this->_kernel);
     kernel.Transform(getTransform());
 
@@ -1162,6 +1224,7 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
                       const Base::ViewProjMethod& proj,
                       MeshObject::CutType type)
 {
+    _exports.check();
     MeshCore::MeshKernel kernel(this->_kernel);
     kernel.Transform(getTransform());
 
@@ -1198,6 +1261,7 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
 
 void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& normal)
 {
+    _exports.check();
     MeshCore::MeshTrimByPlane trim(this->_kernel);
     std::vector<FacetIndex> trimFacets, removeFacets;
     std::vector<MeshCore::MeshGeomFacet> triangle;
@@ -1342,6 +1406,7 @@ MeshObject::section(const MeshObject& mesh, bool connectLines, float fMinDist) c
 
 void MeshObject::refine()
 {
+    _exports.check();
     unsigned long cnt = _kernel.CountFacets();
     MeshCore::MeshFacetIterator cF(_kernel);
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
@@ -1361,6 +1426,7 @@ void MeshObject::refine()
 
 void MeshObject::removeNeedles(float length)
 {
+    _exports.check();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshRemoveNeedles eval(_kernel, length);
     eval.Fixup();
@@ -1371,12 +1437,14 @@ void MeshObject::removeNeedles(float length)
 
 void MeshObject::validateCaps(float fMaxAngle, float fSplitFactor)
 {
+    _exports.check();
     MeshCore::MeshFixCaps eval(_kernel, fMaxAngle, fSplitFactor);
     eval.Fixup();
 }
 
 void MeshObject::optimizeTopology(float fMaxAngle)
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     if (fMaxAngle > 0.0f) {
         topalg.OptimizeTopology(fMaxAngle);
@@ -1392,12 +1460,14 @@ void MeshObject::optimizeTopology(float fMaxAngle)
 
 void MeshObject::optimizeEdges()
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.AdjustEdgesToCurvatureDirection();
 }
 
 void MeshObject::splitEdges()
 {
+    _exports.check();
     std::vector<std::pair<FacetIndex, FacetIndex>> adjacentFacet;
     MeshCore::MeshAlgorithm alg(_kernel);
     alg.ResetFacetFlag(MeshCore::MeshFacet::VISIT);
@@ -1431,24 +1501,28 @@ void MeshObject::splitEdges()
 
 void MeshObject::splitEdge(FacetIndex facet, FacetIndex neighbour, const Base::Vector3f& v)
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SplitEdge(facet, neighbour, v);
 }
 
 void MeshObject::splitFacet(FacetIndex facet, const Base::Vector3f& v1, const Base::Vector3f& v2)
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SplitFacet(facet, v1, v2);
 }
 
 void MeshObject::swapEdge(FacetIndex facet, FacetIndex neighbour)
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SwapEdge(facet, neighbour);
 }
 
 void MeshObject::collapseEdge(FacetIndex facet, FacetIndex neighbour)
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.CollapseEdge(facet, neighbour);
 
@@ -1460,6 +1534,7 @@ void MeshObject::collapseEdge(FacetIndex facet, FacetIndex neighbour)
 
 void MeshObject::collapseFacet(FacetIndex facet)
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.CollapseFacet(facet);
 
@@ -1470,6 +1545,7 @@ void MeshObject::collapseFacet(FacetIndex facet)
 
 void MeshObject::collapseFacets(const std::vector<FacetIndex>& facets)
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     for (FacetIndex it : facets) {
         alg.CollapseFacet(it);
@@ -1480,12 +1556,14 @@ void MeshObject::collapseFacets(const std::vector<FacetIndex>& facets)
 
 void MeshObject::insertVertex(FacetIndex facet, const Base::Vector3f& v)
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.InsertVertex(facet, v);
 }
 
 void MeshObject::snapVertex(FacetIndex facet, const Base::Vector3f& v)
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SnapVertex(facet, v);
 }
@@ -1499,12 +1577,14 @@ unsigned long MeshObject::countNonUniformOrientedFacets() const
 
 void MeshObject::flipNormals()
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     alg.FlipNormals();
 }
 
 void MeshObject::harmonizeNormals()
 {
+    _exports.check();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     alg.HarmonizeNormals();
 }
@@ -1517,6 +1597,7 @@ bool MeshObject::hasNonManifolds() const
 
 void MeshObject::removeNonManifolds()
 {
+    _exports.check();
     MeshCore::MeshEvalTopology f_eval(_kernel);
     if (!f_eval.Evaluate()) {
         MeshCore::MeshFixTopology f_fix(_kernel, f_eval.GetFacets());
@@ -1527,6 +1608,7 @@ void MeshObject::removeNonManifolds()
 
 void MeshObject::removeNonManifoldPoints()
 {
+    _exports.check();
     MeshCore::MeshEvalPointManifolds p_eval(_kernel);
     if (!p_eval.Evaluate()) {
         std::vector<FacetIndex> faces;
@@ -1573,6 +1655,7 @@ MeshObject::getSelfIntersections(const MeshObject::TFacePairs& facets) const
 
 void MeshObject::removeSelfIntersections()
 {
+    _exports.check();
     std::vector<std::pair<FacetIndex, FacetIndex>> selfIntersections;
     MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
     cMeshEval.GetIntersections(selfIntersections);
@@ -1585,6 +1668,7 @@ void MeshObject::removeSelfIntersections()
 
 void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
 {
+    _exports.check();
     // make sure that the number of indices is even and are in range
     if (indices.size() % 2 != 0) {
         return;
@@ -1617,6 +1701,7 @@ void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
 
 void MeshObject::removeFoldsOnSurface()
 {
+    _exports.check();
     std::vector<FacetIndex> indices;
     MeshCore::MeshEvalFoldsOnSurface s_eval(_kernel);
     MeshCore::MeshEvalFoldOversOnSurface f_eval(_kernel);
@@ -1651,6 +1736,7 @@ void MeshObject::removeFoldsOnSurface()
 
 void MeshObject::removeFullBoundaryFacets()
 {
+    _exports.check();
     std::vector<FacetIndex> facets;
     if (!MeshCore::MeshEvalBorderFacet(_kernel, facets).Evaluate()) {
         deleteFacets(facets);
@@ -1665,6 +1751,7 @@ bool MeshObject::hasInvalidPoints() const
 
 void MeshObject::removeInvalidPoints()
 {
+    _exports.check();
     MeshCore::MeshEvalNaNPoints nan(_kernel);
     deletePoints(nan.GetIndices());
 }
@@ -1677,12 +1764,14 @@ bool MeshObject::hasPointsOnEdge() const
 
 void MeshObject::removePointsOnEdge(bool fillBoundary)
 {
+    _exports.check();
     MeshCore::MeshFixPointOnEdge nan(_kernel, fillBoundary);
     nan.Fixup();
 }
 
 void MeshObject::mergeFacets()
 {
+    _exports.check();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixMergeFacets merge(_kernel);
     merge.Fixup();
@@ -1693,6 +1782,7 @@ void MeshObject::mergeFacets()
 
 void MeshObject::validateIndices()
 {
+    _exports.check();
     unsigned long count = _kernel.CountFacets();
 
     // for invalid neighbour indices we don't need to check first
@@ -1749,6 +1839,7 @@ bool MeshObject::hasCorruptedFacets() const
 
 void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 {
+    _exports.check();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDeformedFacets eval(_kernel,
                                          Base::toRadians(15.0f),
@@ -1763,6 +1854,7 @@ void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 
 void MeshObject::validateDegenerations(float fEps)
 {
+    _exports.check();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDegeneratedFacets eval(_kernel, fEps);
     eval.Fixup();
@@ -1773,6 +1865,7 @@ void MeshObject::validateDegenerations(float fEps)
 
 void MeshObject::removeDuplicatedPoints()
 {
+    _exports.check();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDuplicatePoints eval(_kernel);
     eval.Fixup();
@@ -1783,6 +1876,7 @@ void MeshObject::removeDuplicatedPoints()
 
 void MeshObject::removeDuplicatedFacets()
 {
+    _exports.check();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDuplicateFacets eval(_kernel);
     eval.Fixup();
@@ -25,6 +25,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -32,6 +33,7 @@
 #include <App/ComplexGeoData.h>
 #include <App/PropertyGeo.h>
 
+#include <Base/BufferExports.h>
 #include <Base/Matrix.h>
 #include <Base/Tools3D.h>
 
@@ -58,6 +60,7 @@ class ViewProjMethod;
 namespace MeshCore
 {
 class AbstractPolygonTriangulator;
+class MeshFacetBVH;
 }
 
 namespace Mesh
@@ -173,6 +176,10 @@ public:
     std::vector<PointIndex> getPointsFromFacets(const std::vector<FacetIndex>& facets) const;
     bool nearestFacetOnRay(const TRay& ray, double maxAngle, TFaceSection& output) const;
     std::vector<TFaceSection> foraminate(const TRay& ray, double maxAngle) const;
+    /** Returns the bounding volume hierarchy of the facets. It's built on first use and
+     * rebuilt after the modification counter of the kernel has changed.
+     */
+    const MeshCore::MeshFacetBVH& getFacetBVH() const;
     //@}
 
     void setKernel(const MeshCore::MeshKernel& m);
@@ -184,6 +191,14 @@ public:
     {
         return _kernel;
     }
+    /** Counts the buffers exported from the points and facets of the kernel.
+     * The methods of this class that change the mesh throw as long as there is
+     * one, code that changes the kernel returned by getKernel() must call check().
+     */
+    const Base::BufferExports& getBufferExports() const
+    {
+        return _exports;
+    }
 
     Base::BoundBox3d getBoundBox() const override;
     bool getCenterOfGravity(Base::Vector3d& center) const override;
@@ -471,6 +486,8 @@ private:
     Base::Matrix4D _Mtrx;
     MeshCore::MeshKernel _kernel;
     std::vector<Segment> _segments;
+    mutable std::shared_ptr<MeshCore::MeshFacetBVH> _bvh;
+    Base::BufferExports _exports;
     static const float Epsilon;
 };
 
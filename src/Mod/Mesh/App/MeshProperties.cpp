@@ -148,9 +148,8 @@ void PropertyNormalList::SaveDocFile(Base::Writer& writer) const
     Base::OutputStream str(writer.Stream());
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
-    for (auto it : _lValueList) {
-        str << it.x << it.y << it.z;
-    }
+    static_assert(sizeof(Base::Vector3f) == 3 * sizeof(float), "Vector3f must not be padded");
+    str.write(reinterpret_cast<const float*>(_lValueList.data()), 3 * _lValueList.size());
 }
 
 void PropertyNormalList::RestoreDocFile(Base::Reader& reader)
@@ -159,9 +158,7 @@ void PropertyNormalList::RestoreDocFile(Base::Reader& reader)
     uint32_t uCt = 0;
     str >> uCt;
     std::vector<Base::Vector3f> values(uCt);
-    for (auto& it : values) {
-        str >> it.x >> it.y >> it.z;
-    }
+    str.read(reinterpret_cast<float*>(values.data()), 3 * values.size());
     setValues(values);
 }
 
@@ -339,11 +336,20 @@ void PropertyCurvatureList::SaveDocFile(Base::Writer& writer) const
     Base::OutputStream str(writer.Stream());
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
+    std::vector<float> data;
+    data.reserve(8 * _lValueList.size());
     for (const auto& it : _lValueList) {
-        str << it.fMaxCurvature << it.fMinCurvature;
-        str << it.cMaxCurvDir.x << it.cMaxCurvDir.y << it.cMaxCurvDir.z;
-        str << it.cMinCurvDir.x << it.cMinCurvDir.y << it.cMinCurvDir.z;
+        data.insert(data.end(),
+                    {it.fMaxCurvature,
+                     it.fMinCurvature,
+                     it.cMaxCurvDir.x,
+                     it.cMaxCurvDir.y,
+                     it.cMaxCurvDir.z,
+                     it.cMinCurvDir.x,
+                     it.cMinCurvDir.y,
+                     it.cMinCurvDir.z});
     }
+    str.write(data.data(), data.size());
 }
 
 void PropertyCurvatureList::RestoreDocFile(Base::Reader& reader)
@@ -351,11 +357,16 @@ void PropertyCurvatureList::RestoreDocFile(Base::Reader& reader)
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
+    std::vector<float> data(8 * std::size_t(uCt));
+    str.read(data.data(), data.size());
     std::vector<CurvatureInfo> values(uCt);
-    for (auto& it : values) {
-        str >> it.fMaxCurvature >> it.fMinCurvature;
-        str >> it.cMaxCurvDir.x >> it.cMaxCurvDir.y >> it.cMaxCurvDir.z;
-        str >> it.cMinCurvDir.x >> it.cMinCurvDir.y >> it.cMinCurvDir.z;
+    const float* it = data.data();
+    for (auto& value : values) {
+        value.fMaxCurvature = it[0];
+        value.fMinCurvature = it[1];
+        value.cMaxCurvDir.Set(it[2], it[3], it[4]);
+        value.cMinCurvDir.Set(it[5], it[6], it[7]);
+        it += 8;
     }
 
     setValues(values);
@@ -806,6 +817,7 @@ unsigned int PropertyMeshKernel::getMemSize() const
 
 MeshObject* PropertyMeshKernel::startEditing()
 {
+    _meshObject->getBufferExports().check();
     aboutToSetValue();
     return static_cast<MeshObject*>(_meshObject);
 }
@@ -825,6 +837,7 @@ void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 void PropertyMeshKernel::setPointIndices(
     const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
+    _meshObject->getBufferExports().check();
     aboutToSetValue();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
@@ -909,6 +922,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         MeshCore::MeshFacetArray facets;
         kernel.Adopt(points, facets);
 
+        _meshObject->getBufferExports().check();
         aboutToSetValue();
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
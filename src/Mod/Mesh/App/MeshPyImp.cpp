@@ -25,6 +25,7 @@
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
 #include <Base/MatrixPy.h>
+#include <Base/PyBufferView.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
@@ -147,6 +148,62 @@ PyObject* MeshPy::copy(PyObject* args)
     return new MeshPy(new MeshObject(*getMeshObjectPtr()));
 }
 
+namespace
+{
+// keeps the mesh alive and unchanged while a buffer of it is exported
+std::shared_ptr<void> lockMesh(MeshObject* mesh)
+{
+    using MeshLock = std::pair<Base::Reference<MeshObject>, std::shared_ptr<void>>;
+    return std::make_shared<MeshLock>(mesh, mesh->getBufferExports().lock());
+}
+}  // namespace
+
+PyObject* MeshPy::getPointBuffer(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    MeshPy* self = this;
+    return Base::PyBufferView::create(self, [self]() {
+        if (!self->isValid()) {
+            throw Base::RuntimeError("Mesh object is no longer valid");
+        }
+        MeshObject* mesh = self->getMeshObjectPtr();
+        const MeshCore::MeshPointArray& points = mesh->getKernel().GetPoints();
+        Base::BufferLayout layout =
+            Base::BufferLayout::rowsOf(points.empty() ? nullptr : &points.front().x,
+                                       points.size(),
+                                       3,
+                                       sizeof(MeshCore::MeshPoint));
+        layout.storage = lockMesh(mesh);
+        return layout;
+    });
+}
+
+PyObject* MeshPy::getFacetBuffer(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    MeshPy* self = this;
+    return Base::PyBufferView::create(self, [self]() {
+        if (!self->isValid()) {
+            throw Base::RuntimeError("Mesh object is no longer valid");
+        }
+        MeshObject* mesh = self->getMeshObjectPtr();
+        const MeshCore::MeshFacetArray& facets = mesh->getKernel().GetFacets();
+        Base::BufferLayout layout =
+            Base::BufferLayout::rowsOf(facets.empty() ? nullptr : facets.front()._aulPoints,
+                                       facets.size(),
+                                       3,
+                                       sizeof(MeshCore::MeshFacet));
+        layout.storage = lockMesh(mesh);
+        return layout;
+    });
+}
+
 PyObject* MeshPy::read(PyObject* args, PyObject* kwds)
 {
     char* Name {};
@@ -615,6 +672,7 @@ PyObject* MeshPy::translate(PyObject* args)
     {
         Base::Matrix4D m;
         m.move(x, y, z);
+        getMeshObjectPtr()->getBufferExports().check();
         getMeshObjectPtr()->getKernel().Transform(m);
     }
     PY_CATCH;
@@ -637,6 +695,7 @@ PyObject* MeshPy::rotate(PyObject* args)
         m.rotX(x);
         m.rotY(y);
         m.rotZ(z);
+        getMeshObjectPtr()->getBufferExports().check();
         getMeshObjectPtr()->getKernel().Transform(m);
     }
     PY_CATCH;
@@ -653,6 +712,7 @@ PyObject* MeshPy::transform(PyObject* args)
 
     PY_TRY
     {
+        getMeshObjectPtr()->getBufferExports().check();
         getMeshObjectPtr()->getKernel().Transform(static_cast<Base::MatrixPy*>(mat)->value());
     }
     PY_CATCH;
@@ -2027,6 +2087,7 @@ PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds)
 
     PY_TRY
     {
+        getMeshObjectPtr()->getBufferExports().check();
         MeshPropertyLock lock(this->parentProperty);
         MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
         if (strcmp(method, "Laplace") == 0) {
@@ -747,3 +747,64 @@ class MeshProperty(unittest.TestCase):
         self.assertEqual(len(material2["emissiveColor"]), len1 + len2)
         self.assertEqual(len(material2["shininess"]), len1 + len2)
         self.assertEqual(len(material2["transparency"]), len1 + len2)
+
+
+class MeshBufferCases(unittest.TestCase):
+    def setUp(self):
+        self.mesh = Mesh.createBox(1.0, 2.0, 3.0)
+
+    def testPointBuffer(self):
+        view = memoryview(self.mesh.getPointBuffer())
+        self.assertEqual(view.shape, (self.mesh.CountPoints, 3))
+        self.assertEqual(view.format, "f")
+        self.assertTrue(view.readonly)
+        for pnt, row in zip(self.mesh.Points, view.tolist()):
+            self.assertAlmostEqual(pnt.x, row[0], 6)
+            self.assertAlmostEqual(pnt.y, row[1], 6)
+            self.assertAlmostEqual(pnt.z, row[2], 6)
+
+    def testFacetBuffer(self):
+        view = memoryview(self.mesh.getFacetBuffer())
+        self.assertEqual(view.shape, (self.mesh.CountFacets, 3))
+        self.assertIn(view.format, ("I", "Q"))
+        self.assertEqual(view.tolist(), [list(f) for f in self.mesh.Topology[1]])
+
+    def testModifiedMesh(self):
+        points = memoryview(self.mesh.getPointBuffer())
+        facets = memoryview(self.mesh.getFacetBuffer())
+        expected = (points.tolist(), facets.tolist())
+        # the mesh cannot be modified while its arrays are exported
+        with self.assertRaises(RuntimeError):
+            self.mesh.addMesh(Mesh.createSphere(1.0, 50))
+        with self.assertRaises(RuntimeError):
+            self.mesh.translate(1.0, 0.0, 0.0)
+        self.assertEqual((points.tolist(), facets.tolist()), expected)
+        points.release()
+        with self.assertRaises(RuntimeError):
+            self.mesh.addMesh(Mesh.createSphere(1.0, 50))
+        facets.release()
+        self.mesh.addMesh(Mesh.createSphere(1.0, 50))
+        self.assertEqual(memoryview(self.mesh.getPointBuffer()).shape, (self.mesh.CountPoints, 3))
+
+    def testLiveBuffer(self):
+        view = self.mesh.getPointBuffer()
+        self.mesh.translate(1.0, 0.0, 0.0)
+        # a buffer requested after a change shows the current coordinates
+        points = memoryview(view)
+        self.assertAlmostEqual(points[0, 0], self.mesh.Points[0].x, 6)
+        points.release()
+
+    def testDeletedMesh(self):
+        mesh = Mesh.createSphere(1.0, 20)
+        expected = [[p.x, p.y, p.z] for p in mesh.Points]
+        points = memoryview(mesh.getPointBuffer())
+        # the buffer keeps the mesh alive
+        del mesh
+        self.assertEqual(len(points.tolist()), len(expected))
+        for pnt, row in zip(expected, points.tolist()):
+            self.assertAlmostEqual(pnt[0], row[0], 6)
+        points.release()
+
+    def testReadOnly(self):
+        with self.assertRaises(TypeError):
+            memoryview(self.mesh.getPointBuffer())[0, 0] = 1.0
@@ -0,0 +1,79 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+import time
+import unittest
+
+import FreeCAD
+import FreeCADGui
+import Mesh
+
+# ---------------------------------------------------------------------------
+# The simplified meshes drawn for huge meshes while navigating. The tests
+# render with whatever OpenGL is available, e.g. a software renderer under a
+# virtual display, which also covers the fallback without vertex buffers.
+# ---------------------------------------------------------------------------
+
+
+class MeshLevelOfDetailCases(unittest.TestCase):
+    def setUp(self):
+        self.param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Mesh")
+        self.limit = self.param.GetInt("RenderTriangleLimit", -1)
+        # meshes with more than 1000 triangles are simplified while navigating
+        self.param.SetInt("RenderTriangleLimit", 3)
+
+        self.doc = FreeCAD.newDocument("MeshLevelOfDetail")
+        self.obj = self.doc.addObject("Mesh::Feature", "Sphere")
+        self.obj.Mesh = Mesh.createSphere(10.0, 200)
+        self.doc.recompute()
+        self.view = FreeCADGui.getDocument(self.doc.Name).ActiveView
+        self.view.viewIsometric()
+        self.view.fitAll()
+
+    def tearDown(self):
+        self.view.stopAnimating()
+        FreeCAD.closeDocument(self.doc.Name)
+        if self.limit > 0:
+            self.param.SetInt("RenderTriangleLimit", self.limit)
+        else:
+            self.param.RemInt("RenderTriangleLimit")
+
+    def render(self, count=10):
+        for _ in range(count):
+            self.view.redraw()
+            FreeCADGui.updateGui()
+            time.sleep(0.02)
+
+    def testNavigate(self):
+        self.view.startAnimating(0, 0, 1, 1.0)
+        self.render(50)
+        self.view.stopAnimating()
+        self.render()
+
+    def testColorWhileNavigating(self):
+        self.view.startAnimating(0, 0, 1, 1.0)
+        self.render()
+        for color in ((1.0, 0.0, 0.0), (0.0, 1.0, 0.0), (0.0, 0.0, 1.0)):
+            self.obj.ViewObject.ShapeColor = color
+            self.render()
+        self.view.stopAnimating()
+        self.render()
+
+    def testModifyWhileNavigating(self):
+        self.view.startAnimating(0, 0, 1, 1.0)
+        self.render(2)
+        self.obj.Mesh = Mesh.createSphere(5.0, 150)
+        self.render(2)
+        mesh = self.obj.Mesh.copy()
+        mesh.translate(1.0, 0.0, 0.0)
+        self.obj.Mesh = mesh
+        self.render(50)
+        self.view.stopAnimating()
+        self.render()
+
+    def testDeleteWhileNavigating(self):
+        self.view.startAnimating(0, 0, 1, 1.0)
+        self.render(2)
+        self.doc.removeObject(self.obj.Name)
+        self.render()
+        self.view.stopAnimating()
+        self.render()
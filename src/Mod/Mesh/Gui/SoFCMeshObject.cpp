@@ -48,13 +48,20 @@
 #include <Inventor/details/SoFaceDetail.h>
 #include <Inventor/details/SoLineDetail.h>
 #include <Inventor/misc/SoState.h>
+#include <Inventor/sensors/SoOneShotSensor.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <QtConcurrentRun>
 #endif
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Gui/GLBuffer.h>
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/SoFCSelectionAction.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/Decimation.h>
 #include <Mod/Mesh/App/Core/Elements.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -598,6 +605,287 @@ inline SbVec3f sbvec3f(const Base::Vector3f& _v)
     return {_v.x, _v.y, _v.z};
 }
 
+namespace
+{
+
+/**
+ * Fills up the interleaved normal/vertex array of a mesh for flat shading.
+ */
+void fillFlatShadingArrays(const MeshCore::MeshKernel& kernel,
+                           std::vector<float>& vertex,
+                           std::vector<int32_t>& index)
+{
+    const MeshCore::MeshPointArray& cP = kernel.GetPoints();
+    const MeshCore::MeshFacetArray& cF = kernel.GetFacets();
+
+    vertex.clear();
+    vertex.reserve(3 * cF.size() * 6);  // duplicate each vertex
+    index.resize(3 * cF.size());
+
+    int indexed = 0;
+    for (const auto& it : cF) {
+        Base::Vector3f n = kernel.GetFacet(it).GetNormal();
+        for (Mesh::PointIndex ptIndex : it._aulPoints) {
+            vertex.push_back(n.x);
+            vertex.push_back(n.y);
+            vertex.push_back(n.z);
+            const Base::Vector3f& v = cP[ptIndex];
+            vertex.push_back(v.x);
+            vertex.push_back(v.y);
+            vertex.push_back(v.z);
+
+            index[indexed] = indexed;
+            indexed++;
+        }
+    }
+}
+
+}  // namespace
+
+class SoFCMeshObjectShape::Private
+{
+public:
+    /**
+     * The arrays of a mesh and their vertex buffer objects.
+     */
+    struct Level
+    {
+        std::vector<float> vertex_array;
+        std::vector<int32_t> index_array;
+        std::unique_ptr<Gui::OpenGLMultiBuffer> vertices;
+        std::unique_ptr<Gui::OpenGLMultiBuffer> indices;
+        std::size_t numFacets {0};
+
+        // The buffers are deleted in their GL context the next time it is current
+        void destroyBuffers()
+        {
+            if (vertices) {
+                vertices->destroy();
+            }
+            if (indices) {
+                indices->destroy();
+            }
+        }
+        void render(SoGLRenderAction* action, GLenum mode);
+    };
+
+    /**
+     * The state shared with the worker thread that computes the simplified meshes.
+     * A canceled job is not waited for, it just drops its result.
+     */
+    struct LevelOfDetailJob
+    {
+        std::atomic<bool> canceled {false};
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Level>> result;
+        bool finished {false};
+    };
+
+    Level full;
+    // The simplified meshes, sorted from fine to coarse
+    std::vector<std::unique_ptr<Level>> lods;
+    std::shared_ptr<LevelOfDetailJob> lodJob;
+    // The job is started by a sensor so that the mesh isn't copied while rendering
+    SoOneShotSensor lodSensor;
+    Base::Reference<const Mesh::MeshObject> lodMesh;
+    unsigned int lodLimit {0};
+    // The mesh the simplified meshes are computed for
+    struct Source
+    {
+        const Mesh::MeshObject* mesh {nullptr};
+        unsigned long modCount {0};
+        std::size_t numPoints {0};
+        std::size_t numFacets {0};
+
+        explicit Source(const Mesh::MeshObject* meshObject = nullptr)
+            : mesh(meshObject)
+        {
+            if (mesh) {
+                modCount = mesh->getKernel().GetModificationCount();
+                numPoints = mesh->countPoints();
+                numFacets = mesh->countFacets();
+            }
+        }
+        bool operator!=(const Source& other) const
+        {
+            return mesh != other.mesh || modCount != other.modCount
+                || numPoints != other.numPoints || numFacets != other.numFacets;
+        }
+    };
+    Source lodSource;
+
+    Private()
+        : lodSensor(runLevelOfDetail, this)
+    {}
+    ~Private()
+    {
+        cancelLevelOfDetail();
+    }
+
+    void checkLevelOfDetail(const Mesh::MeshObject* mesh);
+    void startLevelOfDetail(const Mesh::MeshObject* mesh, unsigned int limit);
+    static void runLevelOfDetail(void* data, SoSensor* sensor);
+    void cancelLevelOfDetail();
+    Level* findLevelOfDetail(unsigned int limit);
+};
+
+void SoFCMeshObjectShape::Private::Level::render(SoGLRenderAction* action, GLenum mode)
+{
+    if (index_array.empty()) {
+        return;
+    }
+
+    uint32_t context = action->getCacheContext();
+    bool useVBO = Gui::OpenGLBuffer::isVBOSupported(context);
+
+    // upload the arrays only once per context
+    if (useVBO) {
+        if (!vertices) {
+            vertices = std::make_unique<Gui::OpenGLMultiBuffer>(GL_ARRAY_BUFFER);
+            indices = std::make_unique<Gui::OpenGLMultiBuffer>(GL_ELEMENT_ARRAY_BUFFER);
+        }
+
+        vertices->setCurrentContext(context);
+        indices->setCurrentContext(context);
+        if (!vertices->isCreated(context) || !indices->isCreated(context)) {
+            vertices->create();
+            indices->create();
+
+            vertices->bind();
+            vertices->allocate(vertex_array.data(),
+                               static_cast<int>(vertex_array.size() * sizeof(float)));
+            vertices->release();
+
+            indices->bind();
+            indices->allocate(index_array.data(),
+                              static_cast<int>(index_array.size() * sizeof(int32_t)));
+            indices->release();
+        }
+    }
+
+    GLsizei cnt = static_cast<GLsizei>(index_array.size());
+
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_VERTEX_ARRAY);
+
+    if (useVBO) {
+        vertices->bind();
+        indices->bind();
+        glInterleavedArrays(GL_N3F_V3F, 0, nullptr);
+        glDrawElements(mode, cnt, GL_UNSIGNED_INT, nullptr);
+        vertices->release();
+        indices->release();
+    }
+    else {
+        glInterleavedArrays(GL_N3F_V3F, 0, vertex_array.data());
+        glDrawElements(mode, cnt, GL_UNSIGNED_INT, index_array.data());
+    }
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+}
+
+/**
+ * Drops the simplified meshes if they have been computed for another mesh or
+ * before the mesh was modified.
+ */
+void SoFCMeshObjectShape::Private::checkLevelOfDetail(const Mesh::MeshObject* mesh)
+{
+    if (lodSource != Source(mesh)) {
+        cancelLevelOfDetail();
+    }
+}
+
+/**
+ * Computes a hierarchy of simplified meshes in a worker thread. Each level has
+ * about a quarter of the triangles of its predecessor and the coarsest level is
+ * below \a limit. The mesh is copied once by a sensor after the current rendering.
+ */
+void SoFCMeshObjectShape::Private::startLevelOfDetail(const Mesh::MeshObject* mesh,
+                                                      unsigned int limit)
+{
+    if (lodJob || lodSensor.isScheduled()) {
+        return;
+    }
+
+    lodMesh = mesh;
+    lodLimit = limit;
+    lodSource = Source(mesh);
+    lodSensor.schedule();
+}
+
+void SoFCMeshObjectShape::Private::runLevelOfDetail(void* data, SoSensor* /*sensor*/)
+{
+    auto self = static_cast<Private*>(data);
+    if (!self->lodMesh) {
+        return;
+    }
+
+    // work on a copy because the mesh may be changed in the meantime. The worker owns it.
+    auto kernel = std::make_shared<MeshCore::MeshKernel>(self->lodMesh->getKernel());
+    self->lodSource = Source(self->lodMesh);
+    unsigned int limit = self->lodLimit;
+    self->lodMesh = nullptr;
+    auto job = std::make_shared<LevelOfDetailJob>();
+    self->lodJob = job;
+    QtConcurrent::run([job, kernel, limit]() {
+        std::vector<std::unique_ptr<Level>> levels;
+        while (kernel->CountFacets() > limit && !job->canceled) {
+            std::size_t numFacets = kernel->CountFacets();
+            int targetSize = static_cast<int>(std::max<std::size_t>(numFacets / 4, 1));
+            MeshCore::MeshSimplify(*kernel).simplify(targetSize);
+            if (kernel->CountFacets() >= numFacets) {
+                break;
+            }
+
+            auto level = std::make_unique<Level>();
+            level->numFacets = kernel->CountFacets();
+            fillFlatShadingArrays(*kernel, level->vertex_array, level->index_array);
+            levels.push_back(std::move(level));
+        }
+
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->result = std::move(levels);
+        job->finished = true;
+    });
+}
+
+void SoFCMeshObjectShape::Private::cancelLevelOfDetail()
+{
+    lodSensor.unschedule();
+    lodMesh = nullptr;
+    lodSource = Source();
+    if (lodJob) {
+        lodJob->canceled = true;
+        lodJob.reset();
+    }
+    lods.clear();
+}
+
+/**
+ * Returns the finest level with at most \a limit triangles if it has been computed.
+ */
+SoFCMeshObjectShape::Private::Level* SoFCMeshObjectShape::Private::findLevelOfDetail(
+    unsigned int limit)
+{
+    if (lodJob && lods.empty()) {
+        std::lock_guard<std::mutex> lock(lodJob->mutex);
+        if (lodJob->finished) {
+            lods = std::move(lodJob->result);
+        }
+    }
+
+    for (const auto& level : lods) {
+        if (level->numFacets <= limit) {
+            return level.get();
+        }
+    }
+
+    return nullptr;
+}
+
+// ----------------------------------------------------------------------------
+
 SO_NODE_SOURCE(SoFCMeshObjectShape)
 
 void SoFCMeshObjectShape::initClass()
@@ -607,12 +895,16 @@ void SoFCMeshObjectShape::initClass()
 
 SoFCMeshObjectShape::SoFCMeshObjectShape()
     : renderTriangleLimit(UINT_MAX)
+    , p(new Private)
 {
     SO_NODE_CONSTRUCTOR(SoFCMeshObjectShape);
     setName(SoFCMeshObjectShape::getClassTypeId().getName());
 }
 
-SoFCMeshObjectShape::~SoFCMeshObjectShape() = default;
+SoFCMeshObjectShape::~SoFCMeshObjectShape()
+{
+    delete p;
+}
 
 void SoFCMeshObjectShape::notify(SoNotList* node)
 {
@@ -674,7 +966,9 @@ void SoFCMeshObjectShape::GLRender(SoGLRenderAction* action)
 #if 0 && defined(RENDER_GLARRAYS)
             renderCoordsGLArray(action);
 #else
-            drawPoints(mesh, needNormals, ccw);
+            if (mbind != OVERALL || !renderLevelOfDetail(action, mesh)) {
+                drawPoints(mesh, needNormals, ccw);
+            }
 #endif
         }
     }
@@ -890,68 +1184,40 @@ void SoFCMeshObjectShape::generateGLArrays(SoState* state)
 {
     const Mesh::MeshObject* mesh = SoFCMeshObjectElement::get(state);
 
-    this->index_array.resize(0);
-    this->vertex_array.resize(0);
-
-    std::vector<float> face_vertices;
-    std::vector<int32_t> face_indices;
-
-    const MeshCore::MeshKernel& kernel = mesh->getKernel();
-    const MeshCore::MeshPointArray& cP = kernel.GetPoints();
-    const MeshCore::MeshFacetArray& cF = kernel.GetFacets();
-
     // Flat shading
-    face_vertices.reserve(3 * cF.size() * 6);  // duplicate each vertex
-    face_indices.resize(3 * cF.size());
-
-    int indexed = 0;
-    for (const auto& it : cF) {
-        Base::Vector3f n = kernel.GetFacet(it).GetNormal();
-        for (Mesh::PointIndex ptIndex : it._aulPoints) {
-            face_vertices.push_back(n.x);
-            face_vertices.push_back(n.y);
-            face_vertices.push_back(n.z);
-            const Base::Vector3f& v = cP[ptIndex];
-            face_vertices.push_back(v.x);
-            face_vertices.push_back(v.y);
-            face_vertices.push_back(v.z);
-
-            face_indices[indexed] = indexed;
-            indexed++;
-        }
-    }
-    this->index_array.swap(face_indices);
-    this->vertex_array.swap(face_vertices);
+    Private::Level& level = p->full;
+    level.destroyBuffers();
+    level.numFacets = mesh->countFacets();
+    fillFlatShadingArrays(mesh->getKernel(), level.vertex_array, level.index_array);
 }
 
 void SoFCMeshObjectShape::renderFacesGLArray(SoGLRenderAction* action)
 {
-    (void)action;
-    GLsizei cnt = static_cast<GLsizei>(index_array.size());
-
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-    glInterleavedArrays(GL_N3F_V3F, 0, &(vertex_array[0]));
-    glDrawElements(GL_TRIANGLES, cnt, GL_UNSIGNED_INT, &(index_array[0]));
-
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
+    p->full.render(action, GL_TRIANGLES);
 }
 
 void SoFCMeshObjectShape::renderCoordsGLArray(SoGLRenderAction* action)
 {
-    (void)action;
-    int cnt = index_array.size();
-
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
+    p->full.render(action, GL_POINTS);
+}
 
-    glInterleavedArrays(GL_N3F_V3F, 0, &(vertex_array[0]));
-    glDrawElements(GL_POINTS, cnt, GL_UNSIGNED_INT, &(index_array[0]));
+/**
+ * Renders a simplified mesh with at most \a renderTriangleLimit triangles.
+ * Returns false if it's not available yet.
+ */
+bool SoFCMeshObjectShape::renderLevelOfDetail(SoGLRenderAction* action,
+                                              const Mesh::MeshObject* mesh)
+{
+    // only a change of the mesh itself invalidates the simplified meshes
+    p->checkLevelOfDetail(mesh);
+    p->startLevelOfDetail(mesh, this->renderTriangleLimit);
+    Private::Level* level = p->findLevelOfDetail(this->renderTriangleLimit);
+    if (!level) {
+        return false;
+    }
 
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
+    level->render(action, GL_TRIANGLES);
+    return true;
 }
 
 void SoFCMeshObjectShape::doAction(SoAction* action)
@@ -161,11 +161,16 @@ protected:
  * The SoFCMeshObjectShape is an Inventor shape node that is designed to render huge meshes.
  * If the mesh exceeds a certain number of triangles and the user does some intersections
  * (e.g. moving, rotating, zooming, spinning, etc.) with the mesh then the GLRender() method
- * renders only the gravity points of a subset of the triangles.
+ * renders a simplified version of the mesh. The simplified meshes are computed once in a
+ * worker thread with MeshCore::MeshSimplify and until they are available only the gravity
+ * points of a subset of the triangles are rendered.
  * If there is no user interaction with the mesh then all triangles are rendered.
  * The limit of maximum allowed triangles can be specified in \a renderTriangleLimit, the
  * default value is set to 100.000.
  *
+ * The triangles are uploaded once into vertex buffer objects if supported by the OpenGL
+ * driver, otherwise client-side vertex arrays are used.
+ *
  * The GLRender() method checks the status of the SoFCInteractiveElement to decide to be in
  * interactive mode or not.
  * To take advantage of this facility the client programmer must set the status of the
@@ -229,14 +234,15 @@ private:
     void generateGLArrays(SoState* state);
     void renderFacesGLArray(SoGLRenderAction* action);
     void renderCoordsGLArray(SoGLRenderAction* action);
+    bool renderLevelOfDetail(SoGLRenderAction* action, const Mesh::MeshObject*);
 
 private:
     GLuint* selectBuf {nullptr};
     GLfloat modelview[16] {};
     GLfloat projection[16] {};
-    // Vertex array handling
-    std::vector<int32_t> index_array;
-    std::vector<float> vertex_array;
+    // Vertex array and level of detail handling
+    class Private;
+    Private* p;
     SbBool updateGLArray {false};
 };
 
@@ -77,6 +77,7 @@
 #include <Gui/WaitCursor.h>
 #include <Gui/Window.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshIO.h>
@@ -1354,8 +1355,7 @@ void ViewProviderMesh::getFacetsFromPolygon(const std::vector<SbVec2f>& picked,
 
     // Get the attached mesh property
     Mesh::PropertyMeshKernel& meshProp = static_cast<Mesh::Feature*>(pcObject)->Mesh;
-    MeshCore::MeshAlgorithm cAlg(meshProp.getValue().getKernel());
-    cAlg.CheckFacets(&proj, polygon, true, indices);
+    meshProp.getValue().getFacetBVH().FacetsInPolygon(&proj, polygon, true, indices);
 
     if (!inner) {
         // get the indices that are completely outside
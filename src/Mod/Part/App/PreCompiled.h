@@ -48,6 +48,7 @@
 #include <array>
 #include <fcntl.h>
 #include <fstream>
+#include <future>
 #include <list>
 #include <iostream>
 #include <map>
@@ -55,6 +56,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Qt
@@ -450,11 +450,21 @@ void PropertyPartShape::afterRestore()
 }
 #endif
 
+// Returns true if the triangulation of the faces should be stored together
+// with the shape. This allows the view providers to reuse it after loading
+// the document instead of re-meshing the geometry.
+static bool saveTessellation()
+{
+    return App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("SaveTessellation", false);
+}
+
 // The following function is copied from OCCT BRepTools.cxx and modified
-// to disable saving of triangulation
+// to optionally disable saving of triangulation
 //
 
-static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, const Standard_CString File)
+static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, const Standard_CString File,
+                                         Standard_Boolean withTriangles)
 {
   std::ofstream os;
   OSD_OpenStream(os, File, std::ios::out);
@@ -473,7 +483,7 @@ static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, const Standard_
       VERSION_3 = 3
   };
 
-  BRepTools_ShapeSet SS(Standard_False);
+  BRepTools_ShapeSet SS(withTriangles);
   SS.SetFormatNb(VERSION_1);
   // SS.SetProgress(PR);
   SS.Add(Sh);
@@ -501,7 +511,8 @@ void PropertyPartShape::saveToFile(Base::Writer &writer) const
     static Base::FileInfo fi(App::Application::getTempFileName());
 
     TopoDS_Shape myShape = _Shape.getShape();
-    if (!BRepTools_Write(myShape,static_cast<Standard_CString>(fi.filePath().c_str()))) {
+    if (!BRepTools_Write(myShape,static_cast<Standard_CString>(fi.filePath().c_str()),
+                         saveTessellation() ? Standard_True : Standard_False)) {
         // Note: Do NOT throw an exception here because if the tmp. file could
         // not be created we should not abort.
         // We only print an error message but continue writing the next files to the
@@ -600,7 +611,7 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
     if (writer.getMode("BinaryBrep")) {
         TopoShape shape;
         shape.setShape(myShape);
-        shape.exportBinary(writer.Stream());
+        shape.exportBinary(writer.Stream(), saveTessellation());
     }
     else {
         bool direct = App::GetApplication().GetParameterGroupByPath
@@ -611,7 +622,7 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
         else {
             TopoShape shape;
             shape.setShape(myShape);
-            shape.exportBrep(writer.Stream());
+            shape.exportBrep(writer.Stream(), saveTessellation());
         }
     }
 }
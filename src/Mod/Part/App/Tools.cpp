@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 # include <cassert>
+# include <BRep_Builder.hxx>
 # include <BRep_Tool.hxx>
 # include <BRepAdaptor_Curve.hxx>
 # include <BRepAdaptor_Surface.hxx>
@@ -49,6 +50,7 @@
 # include <gp_Pln.hxx>
 # include <gp_Quaternion.hxx>
 # include <Poly_Connect.hxx>
+# include <Poly_PolygonOnTriangulation.hxx>
 # include <Poly_Triangulation.hxx>
 # include <Precision.hxx>
 # include <Standard_Mutex.hxx>
@@ -58,7 +60,10 @@
 # include <TColStd_ListOfTransient.hxx>
 # include <TColgp_SequenceOfXY.hxx>
 # include <TColgp_SequenceOfXYZ.hxx>
+# include <TopExp.hxx>
+# include <TopExp_Explorer.hxx>
 # include <TopoDS.hxx>
+# include <TopTools_IndexedMapOfShape.hxx>
 # if OCC_VERSION_HEX < 0x070600
 # include <Adaptor3d_HCurveOnSurface.hxx>
 # include <GeomAdaptor_HCurve.hxx>
@@ -679,6 +684,51 @@ Handle(Poly_Polygon3D) Part::Tools::polygonOfEdge(const TopoDS_Edge& edge, TopLo
     return BRep_Tool::Polygon3D(TopoDS::Edge(shape), tmp);
 }
 
+bool Part::Tools::copyTriangulation(const TopoDS_Shape& source, const TopoDS_Shape& target)
+{
+    TopTools_IndexedMapOfShape sourceFaces, targetFaces;
+    TopExp::MapShapes(source, TopAbs_FACE, sourceFaces);
+    TopExp::MapShapes(target, TopAbs_FACE, targetFaces);
+    if (sourceFaces.Extent() != targetFaces.Extent())
+        return false;
+
+    BRep_Builder builder;
+    for (int i = 1; i <= sourceFaces.Extent(); i++) {
+        const TopoDS_Face& sourceFace = TopoDS::Face(sourceFaces(i));
+        const TopoDS_Face& targetFace = TopoDS::Face(targetFaces(i));
+        TopLoc_Location loc, targetLoc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(sourceFace, loc);
+        if (mesh.IsNull() || mesh == BRep_Tool::Triangulation(targetFace, targetLoc))
+            continue;
+
+        builder.UpdateFace(targetFace, mesh);
+
+        // the polygons of the edges refer to the nodes of the triangulation
+        TopExp_Explorer xs(sourceFace, TopAbs_EDGE);
+        TopExp_Explorer xt(targetFace, TopAbs_EDGE);
+        for (; xs.More() && xt.More(); xs.Next(), xt.Next()) {
+            TopoDS_Edge sourceEdge = TopoDS::Edge(xs.Current().Oriented(TopAbs_FORWARD));
+            TopoDS_Edge targetEdge = TopoDS::Edge(xt.Current().Oriented(TopAbs_FORWARD));
+            Handle(Poly_PolygonOnTriangulation) poly =
+                BRep_Tool::PolygonOnTriangulation(sourceEdge, mesh, loc);
+            if (poly.IsNull())
+                continue;
+
+            // a seam edge has a polygon for each side
+            if (BRep_Tool::IsClosed(sourceEdge, mesh, loc)) {
+                Handle(Poly_PolygonOnTriangulation) poly2 =
+                    BRep_Tool::PolygonOnTriangulation(TopoDS::Edge(sourceEdge.Reversed()), mesh, loc);
+                builder.UpdateEdge(targetEdge, poly, poly2, mesh, loc);
+            }
+            else {
+                builder.UpdateEdge(targetEdge, poly, mesh, loc);
+            }
+        }
+    }
+
+    return true;
+}
+
 // helper function to use in getNormal, here we pass the local properties
 // of the surface given by the #LProp_SLProps objects
 template <typename T>
@@ -40,6 +40,7 @@
 #include <TopLoc_Location.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
 #include <vector>
 
 
@@ -197,6 +198,16 @@ public:
      * \param loc
      */
     static Handle(Poly_Polygon3D) polygonOfEdge(const TopoDS_Edge& edge, TopLoc_Location& loc);
+    /*!
+     * \brief copyTriangulation
+     * Sets the triangulations of the faces of \a source and the polygons of their edges to the
+     * faces and edges of \a target. Both shapes must have the same structure, e.g. \a source
+     * is a copy of \a target made with BRepBuilderAPI_Copy.
+     * \param source
+     * \param target
+     * \return false if the shapes have a different number of faces
+     */
+    static bool copyTriangulation(const TopoDS_Shape& source, const TopoDS_Shape& target);
     /*!
      * \brief getNormal
      * Returns the normal at the given parameters on the surface and the state of the calculation
@@ -124,7 +124,13 @@ TopoDS_Shape TopoShapeCache::Ancestry::stripLocation(const TopoDS_Shape& parent,
         owner->location = parent.Location();
         owner->locationInverse = parent.Location().Inverted();
     }
-    return TopoShape::located(child, owner->locationInverse * child.Location());
+    return stripLocation(owner->locationInverse, child);
+}
+
+TopoDS_Shape TopoShapeCache::Ancestry::stripLocation(const TopLoc_Location& parentInverse,
+                                                     const TopoDS_Shape& child)
+{
+    return TopoShape::located(child, parentInverse * child.Location());
 }
 
 int TopoShapeCache::Ancestry::find(const TopoDS_Shape& parent, const TopoDS_Shape& subShape)
@@ -135,6 +141,15 @@ int TopoShapeCache::Ancestry::find(const TopoDS_Shape& parent, const TopoDS_Shap
     return shapes.FindIndex(stripLocation(parent, subShape));
 }
 
+int TopoShapeCache::Ancestry::find(const TopLoc_Location& parentInverse,
+                                   const TopoDS_Shape& subShape) const
+{
+    if (parentInverse.IsIdentity()) {
+        return shapes.FindIndex(subShape);
+    }
+    return shapes.FindIndex(stripLocation(parentInverse, subShape));
+}
+
 TopoDS_Shape TopoShapeCache::Ancestry::find(const TopoDS_Shape& parent, int index)
 {
     if (index <= 0 || index > shapes.Extent()) {
@@ -111,7 +111,13 @@ public:
         TopoShape getTopoShape(const TopoShape& parent, int index);
         std::vector<TopoShape> getTopoShapes(const TopoShape& parent);
         TopoDS_Shape stripLocation(const TopoDS_Shape& parent, const TopoDS_Shape& child);
+        /// Removes the location of a parent from child, given the inverse of that location
+        static TopoDS_Shape stripLocation(const TopLoc_Location& parentInverse,
+                                          const TopoDS_Shape& child);
         int find(const TopoDS_Shape& parent, const TopoDS_Shape& subShape);
+        /// Same as above, but does not cache the inverse of the parent location, so that it
+        /// can be called from several threads at once
+        int find(const TopLoc_Location& parentInverse, const TopoDS_Shape& subShape) const;
         TopoDS_Shape find(const TopoDS_Shape& parent, int index);
         int count() const;
 
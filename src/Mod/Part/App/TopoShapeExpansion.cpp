@@ -26,6 +26,8 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <cmath>
+#include <future>
+#include <thread>
 
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_CompCurve.hxx>
@@ -1029,12 +1031,16 @@ struct ShapeInfo
     TopoShapeCache::Ancestry& cache;
     TopAbs_ShapeEnum type;
     const char* shapetype;
+    // computed once, so that find() does not modify the shared cache and can be called from
+    // several threads at once
+    TopLoc_Location locationInverse;
 
     ShapeInfo(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, TopoShapeCache::Ancestry& cache)
         : shape(shape)
         , cache(cache)
         , type(type)
         , shapetype(TopoShape::shapeName(type).c_str())
+        , locationInverse(shape.Location().Inverted())
     {}
 
     [[nodiscard]] int count() const
@@ -1047,9 +1053,9 @@ struct ShapeInfo
         return cache.find(shape, index);
     }
 
-    int find(const TopoDS_Shape& subshape)
+    int find(const TopoDS_Shape& subshape) const
     {
-        return cache.find(shape, subshape);
+        return cache.find(locationInverse, subshape);
     }
 };
 
@@ -1111,6 +1117,23 @@ struct NameInfo
     const char* shapetype {};
 };
 
+// The shapes an element of an input shape was modified into or generated
+struct ElementHistory
+{
+    const TopoShape* source {};
+    int index {};
+    TopoDS_Shape element;
+    std::vector<TopoDS_Shape> modified;
+    std::vector<TopoDS_Shape> generated;
+};
+
+struct NewName
+{
+    Data::IndexedName element;
+    NameKey key;
+    NameInfo info;
+};
+
 
 const std::string& modPostfix()
 {
@@ -1253,12 +1276,13 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     std::string postfix;
     Data::MappedName newName;
 
-    std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
-
-    // First, collect names from other shapes that generates or modifies the
-    // new shape
-    for (auto& pinfo : infos) {  // Walk Vertexes, then Edges, then Faces
-        auto& info = *pinfo;
+    // First, query the history of every element of the other shapes that
+    // generates or modifies the new shape. The mappers and the OCC makers
+    // behind them reuse their storage for the result, so this stays in one
+    // thread.
+    std::array<std::vector<ElementHistory>, 3> histories;
+    for (std::size_t t = 0; t < infos.size(); ++t) {  // Walk Vertexes, then Edges, then Faces
+        auto& info = *infos[t];
         for (const auto& incomingShape : shapes) {
             if (!canMapElement(incomingShape)) {
                 continue;
@@ -1267,158 +1291,226 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
             if (otherMap.count() == 0) {
                 continue;
             }
+            // make sure the name lookups below don't modify the shape
+            incomingShape.flushElementMap();
 
             for (int i = 1; i <= otherMap.count(); i++) {
-                const auto& otherElement = otherMap.find(incomingShape._Shape, i);
-                // Find all new objects that are a modification of the old object
-                Data::ElementIDRefs sids;
-                NameKey key(
-                    info.type,
-                    incomingShape.getMappedName(Data::IndexedName::fromConst(info.shapetype, i),
-                                                true,
-                                                &sids));
-
-                int newShapeCounter = 0;
-                for (auto& newShape : mapper.modified(otherElement)) {
-                    ++newShapeCounter;
+                ElementHistory history;
+                history.source = &incomingShape;
+                history.index = i;
+                history.element = otherMap.find(incomingShape._Shape, i);
+                history.modified = mapper.modified(history.element);
+                for (auto& newShape : history.modified) {
                     if (newShape.ShapeType() >= TopAbs_SHAPE) {
                         // NOLINTNEXTLINE
                         FC_ERR("unknown modified shape type " << newShape.ShapeType() << " from "
                                                               << info.shapetype << i);
-                        continue;
                     }
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    if (newInfo.type != newShape.ShapeType()) {
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // TODO: it seems modified shape may report higher
-                            // level shape type just like generated shape below.
-                            // Maybe we shall do the same for name construction.
-                            // NOLINTNEXTLINE
-                            FC_WARN("modified shape type " << shapeName(newShape.ShapeType())
-                                                           << " mismatch with " << info.shapetype
-                                                           << i);
+                }
+                history.generated = mapper.generated(history.element);
+                for (auto& newShape : history.generated) {
+                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
+                        // NOLINTNEXTLINE
+                        FC_ERR("unknown generated shape type " << newShape.ShapeType() << " from "
+                                                               << info.shapetype << i);
+                    }
+                }
+                histories[t].push_back(std::move(history));
+            }
+        }
+    }
+    flushElementMap();
+
+    // Then collect the names of the new elements from the history. This only
+    // reads the shapes and their element maps, and is done for each shape type
+    // in a thread of its own for large shapes.
+    auto collectNames = [&](const ShapeInfo& info,
+                            const std::vector<ElementHistory>& elementHistories,
+                            std::vector<NewName>& collected) {
+        for (const auto& history : elementHistories) {
+            const auto& incomingShape = *history.source;
+            const auto& otherElement = history.element;
+            int i = history.index;
+            // Find all new objects that are a modification of the old object
+            Data::ElementIDRefs sids;
+            NameKey key(info.type,
+                        incomingShape.getMappedName(Data::IndexedName::fromConst(info.shapetype, i),
+                                                    true,
+                                                    &sids));
+
+            int newShapeCounter = 0;
+            for (auto& newShape : history.modified) {
+                ++newShapeCounter;
+                if (newShape.ShapeType() >= TopAbs_SHAPE) {
+                    continue;
+                }
+                auto& newInfo = *infoMap.at(newShape.ShapeType());
+                if (newInfo.type != newShape.ShapeType()) {
+                    if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+                        // TODO: it seems modified shape may report higher
+                        // level shape type just like generated shape below.
+                        // Maybe we shall do the same for name construction.
+                        // NOLINTNEXTLINE
+                        FC_WARN("modified shape type " << shapeName(newShape.ShapeType())
+                                                       << " mismatch with " << info.shapetype
+                                                       << i);
+                    }
+                    continue;
+                }
+                int newShapeIndex = newInfo.find(newShape);
+                if (newShapeIndex == 0) {
+                    // This warning occurs in makeElementRevolve. It generates
+                    // some shape from a vertex that never made into the
+                    // final shape. There may be incomingShape cases there.
+                    if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+                        // NOLINTNEXTLINE
+                        FC_WARN("Cannot find " << op << " modified " << newInfo.shapetype
+                                               << " from " << info.shapetype << i);
+                    }
+                    continue;
+                }
+
+                Data::IndexedName element =
+                    Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
+                if (getMappedName(element)) {
+                    continue;
+                }
+
+                key.tag = incomingShape.Tag;
+                NewName collectedName {element, key};
+                collectedName.info.sids = sids;
+                collectedName.info.index = newShapeCounter;
+                collectedName.info.shapetype = info.shapetype;
+                collected.push_back(std::move(collectedName));
+            }
+
+            int checkParallel = -1;
+            gp_Pln pln;
+
+            // Find all new objects that were generated from an old object
+            // (e.g. a face generated from an edge)
+            newShapeCounter = 0;
+            for (auto& newShape : history.generated) {
+                if (newShape.ShapeType() >= TopAbs_SHAPE) {
+                    continue;
+                }
+
+                int parallelFace = -1;
+                int coplanarFace = -1;
+                auto& newInfo = *infoMap.at(newShape.ShapeType());
+                std::vector<TopoDS_Shape> newShapes;
+                int shapeOffset = 0;
+                if (newInfo.type == newShape.ShapeType()) {
+                    newShapes.push_back(newShape);
+                }
+                else {
+                    // It is possible for the maker to report generating a
+                    // higher level shape, such as shell or solid. For
+                    // example, when extruding, OCC will report the
+                    // extruding face generating the entire solid. However,
+                    // it will also report the edges of the extruding face
+                    // generating the side faces. In this case, too much
+                    // information is bad for us. We don't want the name of
+                    // the side face (and its edges) to be coupled with
+                    // incomingShape (unrelated) edges in the extruding face.
+                    //
+                    // shapeOffset below is used to make sure the higher
+                    // level mapped names comes late after sorting. We'll
+                    // ignore those names if there are more precise mapping
+                    // available.
+                    shapeOffset = 3;
+
+                    if (info.type == TopAbs_FACE && checkParallel < 0) {
+                        if (!TopoShape(otherElement).findPlane(pln)) {
+                            checkParallel = 0;
+                        }
+                        else {
+                            checkParallel = 1;
                         }
-                        continue;
                     }
-                    int newShapeIndex = newInfo.find(newShape);
-                    if (newShapeIndex == 0) {
-                        // This warning occurs in makeElementRevolve. It generates
-                        // some shape from a vertex that never made into the
-                        // final shape. There may be incomingShape cases there.
+                    checkForParallelOrCoplanar(newShape,
+                                               newInfo,
+                                               newShapes,
+                                               pln,
+                                               parallelFace,
+                                               coplanarFace,
+                                               checkParallel);
+                }
+                key.shapetype += shapeOffset;
+                for (auto& workingShape : newShapes) {
+                    ++newShapeCounter;
+                    int workingShapeIndex = newInfo.find(workingShape);
+                    if (workingShapeIndex == 0) {
                         if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
                             // NOLINTNEXTLINE
-                            FC_WARN("Cannot find " << op << " modified " << newInfo.shapetype
+                            FC_WARN("Cannot find " << op << " generated " << newInfo.shapetype
                                                    << " from " << info.shapetype << i);
                         }
                         continue;
                     }
 
                     Data::IndexedName element =
-                        Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
-                    if (getMappedName(element)) {
+                        Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
+                    auto mapped = getMappedName(element);
+                    if (mapped) {
                         continue;
                     }
 
                     key.tag = incomingShape.Tag;
-                    auto& name_info = newNames[element][key];
-                    name_info.sids = sids;
-                    name_info.index = newShapeCounter;
-                    name_info.shapetype = info.shapetype;
-                }
-
-                int checkParallel = -1;
-                gp_Pln pln;
-
-                // Find all new objects that were generated from an old object
-                // (e.g. a face generated from an edge)
-                newShapeCounter = 0;
-                for (auto& newShape : mapper.generated(otherElement)) {
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR("unknown generated shape type " << newShape.ShapeType() << " from "
-                                                               << info.shapetype << i);
-                        continue;
+                    NewName collectedName {element, key};
+                    collectedName.info.sids = sids;
+                    if (newShapeCounter == parallelFace) {
+                        collectedName.info.index = std::numeric_limits<int>::min();
                     }
-
-                    int parallelFace = -1;
-                    int coplanarFace = -1;
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    std::vector<TopoDS_Shape> newShapes;
-                    int shapeOffset = 0;
-                    if (newInfo.type == newShape.ShapeType()) {
-                        newShapes.push_back(newShape);
+                    else if (newShapeCounter == coplanarFace) {
+                        collectedName.info.index = std::numeric_limits<int>::min() + 1;
                     }
                     else {
-                        // It is possible for the maker to report generating a
-                        // higher level shape, such as shell or solid. For
-                        // example, when extruding, OCC will report the
-                        // extruding face generating the entire solid. However,
-                        // it will also report the edges of the extruding face
-                        // generating the side faces. In this case, too much
-                        // information is bad for us. We don't want the name of
-                        // the side face (and its edges) to be coupled with
-                        // incomingShape (unrelated) edges in the extruding face.
-                        //
-                        // shapeOffset below is used to make sure the higher
-                        // level mapped names comes late after sorting. We'll
-                        // ignore those names if there are more precise mapping
-                        // available.
-                        shapeOffset = 3;
-
-                        if (info.type == TopAbs_FACE && checkParallel < 0) {
-                            if (!TopoShape(otherElement).findPlane(pln)) {
-                                checkParallel = 0;
-                            }
-                            else {
-                                checkParallel = 1;
-                            }
-                        }
-                        checkForParallelOrCoplanar(newShape,
-                                                   newInfo,
-                                                   newShapes,
-                                                   pln,
-                                                   parallelFace,
-                                                   coplanarFace,
-                                                   checkParallel);
-                    }
-                    key.shapetype += shapeOffset;
-                    for (auto& workingShape : newShapes) {
-                        ++newShapeCounter;
-                        int workingShapeIndex = newInfo.find(workingShape);
-                        if (workingShapeIndex == 0) {
-                            if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                                // NOLINTNEXTLINE
-                                FC_WARN("Cannot find " << op << " generated " << newInfo.shapetype
-                                                       << " from " << info.shapetype << i);
-                            }
-                            continue;
-                        }
-
-                        Data::IndexedName element =
-                            Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
-                        auto mapped = getMappedName(element);
-                        if (mapped) {
-                            continue;
-                        }
-
-                        key.tag = incomingShape.Tag;
-                        auto& name_info = newNames[element][key];
-                        name_info.sids = sids;
-                        if (newShapeCounter == parallelFace) {
-                            name_info.index = std::numeric_limits<int>::min();
-                        }
-                        else if (newShapeCounter == coplanarFace) {
-                            name_info.index = std::numeric_limits<int>::min() + 1;
-                        }
-                        else {
-                            name_info.index = -newShapeCounter;
-                        }
-                        name_info.shapetype = info.shapetype;
+                        collectedName.info.index = -newShapeCounter;
                     }
-                    key.shapetype -= shapeOffset;
+                    collectedName.info.shapetype = info.shapetype;
+                    collected.push_back(std::move(collectedName));
                 }
+                key.shapetype -= shapeOffset;
             }
         }
+    };
+
+    std::array<std::vector<NewName>, 3> collectedNames;
+    std::size_t historyCount = 0;
+    for (auto& elementHistories : histories) {
+        historyCount += elementHistories.size();
+    }
+    // The warnings above go directly to the console, so stay in this thread
+    // when they are enabled
+    constexpr std::size_t minParallelHistoryCount = 1000;
+    if (historyCount < minParallelHistoryCount || std::thread::hardware_concurrency() < 2
+        || FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+        for (std::size_t t = 0; t < infos.size(); ++t) {
+            collectNames(*infos[t], histories[t], collectedNames[t]);
+        }
+    }
+    else {
+        std::vector<std::future<void>> futures;
+        for (std::size_t t = 0; t < infos.size(); ++t) {
+            futures.push_back(std::async(std::launch::async,
+                                         collectNames,
+                                         std::cref(*infos[t]),
+                                         std::cref(histories[t]),
+                                         std::ref(collectedNames[t])));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+    }
+
+    // Merge in the order of the history, so that the names don't depend on
+    // the threads
+    std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
+    for (auto& collected : collectedNames) {
+        for (auto& entry : collected) {
+            newNames[entry.element][entry.key] = std::move(entry.info);
+        }
     }
 
     // We shall first exclude those names generated from high level mapping. If
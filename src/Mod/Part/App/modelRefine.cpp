@@ -24,7 +24,9 @@
 
 #ifndef _PreComp_
 # include <algorithm>
+# include <future>
 # include <iterator>
+# include <thread>
 # include <Bnd_Box.hxx>
 # include <BRep_Builder.hxx>
 # include <BRep_Tool.hxx>
@@ -63,6 +65,8 @@
 # include <TopExp_Explorer.hxx>
 # include <TopTools_DataMapIteratorOfDataMapOfIntegerListOfShape.hxx>
 # include <TopTools_DataMapIteratorOfDataMapOfShapeShape.hxx>
+# include <TopTools_DataMapOfShapeInteger.hxx>
+# include <TopTools_IndexedMapOfShape.hxx>
 # include <TopTools_ListIteratorOfListOfShape.hxx>
 # include <TopTools_ListOfShape.hxx>
 #endif // _PreComp_
@@ -85,7 +89,11 @@ void ModelRefine::getFaceEdges(const TopoDS_Face &face, EdgeVectorType &edges)
 void ModelRefine::boundaryEdges(const FaceVectorType &faces, EdgeVectorType &edgesOut)
 {
     //this finds all the boundary edges. Maybe more than one boundary.
-    std::list<TopoDS_Edge> edges;
+    //an edge shared by two faces of the group is an inner edge. The map gives the index
+    //of an edge in constant time instead of searching a list.
+    TopTools_IndexedMapOfShape edgeMap;
+    std::vector<TopoDS_Edge> edges;
+    std::vector<int> edgeCount;
     FaceVectorType::const_iterator faceIt;
     for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt)
     {
@@ -94,24 +102,72 @@ void ModelRefine::boundaryEdges(const FaceVectorType &faces, EdgeVectorType &edg
         getFaceEdges(*faceIt, faceEdges);
         for (faceEdgesIt = faceEdges.begin(); faceEdgesIt != faceEdges.end(); ++faceEdgesIt)
         {
-            bool foundSignal(false);
-            std::list<TopoDS_Edge>::iterator edgesIt;
-            for (edgesIt = edges.begin(); edgesIt != edges.end(); ++edgesIt)
+            int index = edgeMap.Add(*faceEdgesIt);
+            if (index > static_cast<int>(edges.size()))
             {
-                if ((*edgesIt).IsSame(*faceEdgesIt))
-                {
-                    edgesIt = edges.erase(edgesIt);
-                    foundSignal = true;
-                    break;
-                }
-            }
-            if (!foundSignal)
                 edges.push_back(*faceEdgesIt);
+                edgeCount.push_back(0);
+            }
+            edgeCount[index - 1]++;
         }
     }
 
     edgesOut.reserve(edges.size());
-    std::copy(edges.begin(), edges.end(), back_inserter(edgesOut));
+    for (std::size_t index = 0; index < edges.size(); ++index)
+    {
+        if (edgeCount[index] % 2 == 1)
+            edgesOut.push_back(edges[index]);
+    }
+}
+
+namespace
+{
+    // Finds the edges of a boundary that start at a given vertex
+    class EdgeConnectivity
+    {
+    public:
+        explicit EdgeConnectivity(const EdgeVectorType &edgesIn) : edges(edgesIn), usedEdges(edgesIn.size(), false)
+        {
+            for (std::size_t index = 0; index < edges.size(); ++index)
+            {
+                int vertex = vertexMap.Add(TopExp::FirstVertex(edges[index], Standard_True));
+                if (vertex > static_cast<int>(edgesOfVertex.size()))
+                    edgesOfVertex.resize(vertex);
+                edgesOfVertex[vertex - 1].push_back(index);
+            }
+        }
+        bool isUsed(std::size_t index) const
+        {
+            return usedEdges[index];
+        }
+        void use(std::size_t index)
+        {
+            usedEdges[index] = true;
+        }
+        // returns the first unused edge starting at the vertex that is not the same as 'skip'
+        bool findNext(const TopoDS_Vertex &vertex, const TopoDS_Edge *skip, std::size_t &index) const
+        {
+            int vertexIndex = vertexMap.FindIndex(vertex);
+            if (vertexIndex == 0)
+                return false;
+            for (std::size_t edge : edgesOfVertex[vertexIndex - 1])
+            {
+                if (usedEdges[edge])
+                    continue;
+                if (skip && edges[edge].IsSame(*skip))
+                    continue;
+                index = edge;
+                return true;
+            }
+            return false;
+        }
+
+    private:
+        const EdgeVectorType &edges;
+        std::vector<bool> usedEdges;
+        TopTools_IndexedMapOfShape vertexMap;
+        std::vector<std::vector<std::size_t>> edgesOfVertex;
+    };
 }
 
 TopoDS_Shell ModelRefine::removeFaces(const TopoDS_Shell &shell, const FaceVectorType &faces)
@@ -255,27 +311,61 @@ void FaceAdjacencySplitter::recursiveFind(const TopoDS_Face &face, FaceVectorTyp
 
 void FaceEqualitySplitter::split(const FaceVectorType &faces, FaceTypedBase *object)
 {
+    // With surface keys a face only needs to be compared with the groups whose key is
+    // close to its own key instead of with all groups.
+    std::vector<double> keys(faces.size());
+    double tolerance = 0.0;
+    bool useKeys = true;
+    for (std::size_t index = 0; index < faces.size(); ++index)
+    {
+        double faceTolerance;
+        if (!object->getSurfaceKey(faces[index], keys[index], faceTolerance))
+        {
+            useKeys = false;
+            break;
+        }
+        tolerance = std::max(tolerance, 2.0 * faceTolerance);
+    }
+
     std::vector<FaceVectorType> tempVector;
-    tempVector.reserve(faces.size());
-    FaceVectorType::const_iterator faceIt;
-    for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt)
+    std::multimap<double, std::size_t> groupKeys;
+    for (std::size_t index = 0; index < faces.size(); ++index)
     {
-        bool foundMatch(false);
-        std::vector<FaceVectorType>::iterator tempIt;
-        for (tempIt = tempVector.begin(); tempIt != tempVector.end(); ++tempIt)
+        const TopoDS_Face &face = faces[index];
+        // the face is added to the first matching group
+        std::size_t match = tempVector.size();
+        if (useKeys)
         {
-            if (object->isEqual((*tempIt).front(), *faceIt))
+            auto it = groupKeys.lower_bound(keys[index] - tolerance);
+            auto end = groupKeys.upper_bound(keys[index] + tolerance);
+            for (; it != end; ++it)
             {
-                (*tempIt).push_back(*faceIt);
-                foundMatch = true;
-                break;
+                if (it->second < match && object->isEqual(tempVector[it->second].front(), face))
+                    match = it->second;
             }
         }
-        if (!foundMatch)
+        else
         {
+            for (std::size_t group = 0; group < tempVector.size(); ++group)
+            {
+                if (object->isEqual(tempVector[group].front(), face))
+                {
+                    match = group;
+                    break;
+                }
+            }
+        }
+
+        if (match < tempVector.size())
+        {
+            tempVector[match].push_back(face);
+        }
+        else
+        {
+            if (useKeys)
+                groupKeys.emplace(keys[index], tempVector.size());
             FaceVectorType another;
-            another.reserve(faces.size());
-            another.push_back(*faceIt);
+            another.push_back(face);
             tempVector.push_back(another);
         }
     }
@@ -302,15 +392,16 @@ void FaceTypedBase::boundarySplit(const FaceVectorType &facesIn, std::vector<Edg
     EdgeVectorType bEdges;
     boundaryEdges(facesIn, bEdges);
 
-    std::list<TopoDS_Edge> edges;
-    std::copy(bEdges.begin(), bEdges.end(), back_inserter(edges));
-    while(!edges.empty())
+    EdgeConnectivity edges(bEdges);
+    for (std::size_t start = 0; start < bEdges.size(); ++start)
     {
-        TopoDS_Vertex destination = TopExp::FirstVertex(edges.front(), Standard_True);
-        TopoDS_Vertex lastVertex = TopExp::LastVertex(edges.front(), Standard_True);
+        if (edges.isUsed(start))
+            continue;
+        edges.use(start);
+        TopoDS_Vertex destination = TopExp::FirstVertex(bEdges[start], Standard_True);
+        TopoDS_Vertex lastVertex = TopExp::LastVertex(bEdges[start], Standard_True);
         EdgeVectorType boundary;
-        boundary.push_back(edges.front());
-        edges.pop_front();
+        boundary.push_back(bEdges[start]);
         //single edge closed check.
         if (destination.IsSame(lastVertex))
         {
@@ -319,30 +410,28 @@ void FaceTypedBase::boundarySplit(const FaceVectorType &facesIn, std::vector<Edg
         }
 
         bool closedSignal(false);
-        std::list<TopoDS_Edge>::iterator it;
-        for (it = edges.begin(); it != edges.end();)
+        std::size_t next;
+        while (edges.findNext(lastVertex, nullptr, next))
         {
-            TopoDS_Vertex currentVertex = TopExp::FirstVertex(*it, Standard_True);
-            if (lastVertex.IsSame(currentVertex))
+            edges.use(next);
+            boundary.push_back(bEdges[next]);
+            lastVertex = TopExp::LastVertex(bEdges[next], Standard_True);
+            if (lastVertex.IsSame(destination))
             {
-                boundary.push_back(*it);
-                lastVertex = TopExp::LastVertex(*it, Standard_True);
-                edges.erase(it);
-                it = edges.begin();
-                if (lastVertex.IsSame(destination))
-                {
-                    closedSignal = true;
-                    break;
-                }
-                continue;
+                closedSignal = true;
+                break;
             }
-            ++it;
         }
         if (closedSignal)
             boundariesOut.push_back(boundary);
     }
 }
 
+bool FaceTypedBase::getSurfaceKey(const TopoDS_Face &, double &, double &) const
+{
+    return false;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -381,6 +470,24 @@ bool FaceTypedPlane::isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &face
             planeOne.Distance(planeTwo.Position().Location()) < Precision::Confusion());
 }
 
+bool FaceTypedPlane::getSurfaceKey(const TopoDS_Face &face, double &key, double &tolerance) const
+{
+    Handle(Geom_Plane) planeSurface = getGeomPlane(face);
+    if (planeSurface.IsNull())
+        return false;
+
+    // The foot of the perpendicular from the origin and the absolute values of the normal
+    // do not depend on the orientation and position of the plane
+    gp_Pln plane(planeSurface->Pln());
+    const gp_XYZ &normal = plane.Position().Direction().XYZ();
+    const gp_XYZ &location = plane.Location().XYZ();
+    gp_XYZ foot = normal * normal.Dot(location);
+    key = foot.X() + foot.Y() + foot.Z() +
+          fabs(normal.X()) + 2.0 * fabs(normal.Y()) + 3.0 * fabs(normal.Z());
+    tolerance = 10.0 * Precision::Confusion() * (1.0 + location.Modulus());
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedPlane::getType() const
 {
     return GeomAbs_Plane;
@@ -477,6 +584,24 @@ bool FaceTypedCylinder::isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &f
     return true;
 }
 
+bool FaceTypedCylinder::getSurfaceKey(const TopoDS_Face &face, double &key, double &tolerance) const
+{
+    Handle(Geom_CylindricalSurface) surface = getGeomCylinder(face);
+    if (surface.IsNull())
+        return false;
+
+    // The point of the axis closest to the origin and the absolute values of the axis
+    // direction do not depend on the orientation and location of the axis
+    gp_Cylinder cylinder = surface->Cylinder();
+    const gp_XYZ &direction = cylinder.Axis().Direction().XYZ();
+    const gp_XYZ &location = cylinder.Axis().Location().XYZ();
+    gp_XYZ foot = location - direction * direction.Dot(location);
+    key = cylinder.Radius() + foot.X() + foot.Y() + foot.Z() +
+          fabs(direction.X()) + 2.0 * fabs(direction.Y()) + 3.0 * fabs(direction.Z());
+    tolerance = 10.0 * Precision::Confusion() * (1.0 + location.Modulus());
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedCylinder::getType() const
 {
     return GeomAbs_Cylinder;
@@ -722,57 +847,39 @@ void FaceTypedCylinder::boundarySplit(const FaceVectorType &facesIn, std::vector
     EdgeVectorType normalEdges;
     ModelRefine::boundaryEdges(facesIn, normalEdges);
 
-    std::list<TopoDS_Edge> sortedEdges;
-    std::copy(normalEdges.begin(), normalEdges.end(), back_inserter(sortedEdges));
-
-    while (!sortedEdges.empty())
+    EdgeConnectivity sortedEdges(normalEdges);
+    for (std::size_t start = normalEdges.size(); start-- > 0;)
     {
-        TopoDS_Vertex destination = TopExp::FirstVertex(sortedEdges.back(), Standard_True);
-        TopoDS_Vertex lastVertex = TopExp::LastVertex(sortedEdges.back(), Standard_True);
+        if (sortedEdges.isUsed(start))
+            continue;
+        sortedEdges.use(start);
+        TopoDS_Vertex destination = TopExp::FirstVertex(normalEdges[start], Standard_True);
+        TopoDS_Vertex lastVertex = TopExp::LastVertex(normalEdges[start], Standard_True);
         bool closedSignal(false);
-        std::list<TopoDS_Edge> boundary;
-        boundary.push_back(sortedEdges.back());
-        sortedEdges.pop_back();
+        EdgeVectorType boundary;
+        boundary.push_back(normalEdges[start]);
 
         if (destination.IsSame(lastVertex)) {
             // Single circular edge
             closedSignal = true;
         } else {
-            std::list<TopoDS_Edge>::iterator sortedIt;
-            for (sortedIt = sortedEdges.begin(); sortedIt != sortedEdges.end();)
+            //Seam edges lie on top of each other. i.e. same. and we remove every match from the list
+            //so we don't actually ever compare the same edge.
+            std::size_t next;
+            while (sortedEdges.findNext(lastVertex, &boundary.back(), next))
             {
-                TopoDS_Vertex currentVertex = TopExp::FirstVertex(*sortedIt, Standard_True);
-
-                //Seam edges lie on top of each other. i.e. same. and we remove every match from the list
-                //so we don't actually ever compare the same edge.
-                if ((*sortedIt).IsSame(boundary.back()))
-                {
-                    ++sortedIt;
-                    continue;
-                }
-                if (lastVertex.IsSame(currentVertex))
+                sortedEdges.use(next);
+                boundary.push_back(normalEdges[next]);
+                lastVertex = TopExp::LastVertex(normalEdges[next], Standard_True);
+                if (lastVertex.IsSame(destination))
                 {
-                    boundary.push_back(*sortedIt);
-                    lastVertex = TopExp::LastVertex(*sortedIt, Standard_True);
-                    if (lastVertex.IsSame(destination))
-                    {
-                        closedSignal = true;
-                        sortedEdges.erase(sortedIt);
-                        break;
-                    }
-                    sortedEdges.erase(sortedIt);
-                    sortedIt = sortedEdges.begin();
-                    continue;
+                    closedSignal = true;
+                    break;
                 }
-                ++sortedIt;
             }
         }
         if (closedSignal)
-        {
-            EdgeVectorType temp;
-            std::copy(boundary.begin(), boundary.end(), std::back_inserter(temp));
-            boundariesOut.push_back(temp);
-        }
+            boundariesOut.push_back(boundary);
     }
 }
 
@@ -1021,6 +1128,84 @@ FaceTypedBSpline& ModelRefine::getBSplineObject()
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    struct FaceGroup
+    {
+        FaceTypedBase *type;
+        FaceVectorType faces;
+        TopoDS_Face newFace;
+    };
+
+    // Splits the groups into waves of groups that don't share any vertex. Building a face
+    // may update the edges and vertices of its boundary so that groups sharing a vertex
+    // must not be built at the same time.
+    std::vector<std::vector<std::size_t>> scheduleGroups(const std::vector<FaceGroup> &groups)
+    {
+        std::vector<std::vector<std::size_t>> waves;
+        TopTools_DataMapOfShapeInteger vertexWave;
+        for (std::size_t index = 0; index < groups.size(); ++index)
+        {
+            TopTools_IndexedMapOfShape vertices;
+            for (const auto &face : groups[index].faces)
+                TopExp::MapShapes(face, TopAbs_VERTEX, vertices);
+
+            int wave = 0;
+            for (int i = 1; i <= vertices.Extent(); ++i)
+            {
+                if (vertexWave.IsBound(vertices(i)))
+                    wave = std::max(wave, vertexWave(vertices(i)) + 1);
+            }
+            for (int i = 1; i <= vertices.Extent(); ++i)
+                vertexWave.Bind(vertices(i), wave);
+
+            if (wave >= static_cast<int>(waves.size()))
+                waves.resize(wave + 1);
+            waves[wave].push_back(index);
+        }
+        return waves;
+    }
+
+    void buildFaces(std::vector<FaceGroup> &groups)
+    {
+        auto build = [&groups](const std::vector<std::size_t> &indices, std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                FaceGroup &group = groups[indices[i]];
+                group.newFace = group.type->buildFace(group.faces);
+            }
+        };
+
+        std::size_t numThreads = std::thread::hardware_concurrency();
+        if (numThreads < 2 || groups.size() < 2)
+        {
+            for (auto &group : groups)
+                group.newFace = group.type->buildFace(group.faces);
+            return;
+        }
+
+        for (const auto &wave : scheduleGroups(groups))
+        {
+            if (wave.size() < 2)
+            {
+                build(wave, 0, wave.size());
+                continue;
+            }
+
+            std::size_t chunkSize = (wave.size() + numThreads - 1) / numThreads;
+            std::vector<std::future<void>> futures;
+            for (std::size_t first = 0; first < wave.size(); first += chunkSize)
+            {
+                std::size_t last = std::min(first + chunkSize, wave.size());
+                futures.push_back(std::async(std::launch::async, build, std::cref(wave), first, last));
+            }
+            for (auto &future : futures)
+                future.get();
+        }
+    }
+}
+
 FaceUniter::FaceUniter(const TopoDS_Shell &shellIn) : modifiedSignal(false)
 {
     workShell = shellIn;
@@ -1048,8 +1233,10 @@ bool FaceUniter::process()
     ModelRefine::FaceVectorType facesToRemove;
     ModelRefine::FaceVectorType facesToSew;
 
+    // the adjacency maps are built once for the whole shell
     ModelRefine::FaceAdjacencySplitter adjacencySplitter(workShell);
 
+    std::vector<FaceGroup> groups;
     for(typeIt = typeObjects.begin(); typeIt != typeObjects.end(); ++typeIt)
     {
         ModelRefine::FaceVectorType typedFaces = splitter.getTypedFaceVector((*typeIt)->getType());
@@ -1058,35 +1245,33 @@ bool FaceUniter::process()
         for (std::size_t indexEquality(0); indexEquality < equalitySplitter.getGroupCount(); ++indexEquality)
         {
             adjacencySplitter.split(equalitySplitter.getGroup(indexEquality));
-//            std::cout << "      adjacency group count: " << adjacencySplitter.getGroupCount() << std::endl;
             for (std::size_t adjacentIndex(0); adjacentIndex < adjacencySplitter.getGroupCount(); ++adjacentIndex)
-            {
-//                    std::cout << "         face count is: " << adjacencySplitter.getGroup(adjacentIndex).size() << std::endl;
-                TopoDS_Face newFace = (*typeIt)->buildFace(adjacencySplitter.getGroup(adjacentIndex));
-                if (!newFace.IsNull())
-                {
-                    // the created face should have the same orientation as the input faces
-                    const FaceVectorType& faces = adjacencySplitter.getGroup(adjacentIndex);
-                    if (!faces.empty() && newFace.Orientation() != faces[0].Orientation()) {
-                        checkFinalShell = true;
-                    }
-                    facesToSew.push_back(newFace);
-                    if (facesToRemove.capacity() <= facesToRemove.size() + adjacencySplitter.getGroup(adjacentIndex).size())
-                        facesToRemove.reserve(facesToRemove.size() + adjacencySplitter.getGroup(adjacentIndex).size());
-                    FaceVectorType temp = adjacencySplitter.getGroup(adjacentIndex);
-                    facesToRemove.insert(facesToRemove.end(), temp.begin(), temp.end());
-                    // the first shape will be marked as modified, i.e. replaced by newFace, all others are marked as deleted
-                    // jrheinlaender: IMHO this is not correct because references to the deleted faces will be broken, whereas they should
-                    // be replaced by references to the new face. To achieve this all shapes should be marked as
-                    // modified, producing one single new face. This is the inverse behaviour to faces that are split e.g.
-                    // by a boolean cut, where one old shape is marked as modified, producing multiple new shapes
-                    if (!temp.empty())
-                    {
-                        for (const auto & f : temp)
-                              modifiedShapes.emplace_back(f, newFace);
-                    }
-                }
+                groups.push_back({*typeIt, adjacencySplitter.getGroup(adjacentIndex), TopoDS_Face()});
+        }
+    }
+
+    // the groups are independent of each other and can be united in parallel
+    buildFaces(groups);
+
+    for (const auto &group : groups)
+    {
+        const TopoDS_Face &newFace = group.newFace;
+        if (!newFace.IsNull())
+        {
+            // the created face should have the same orientation as the input faces
+            const FaceVectorType& temp = group.faces;
+            if (!temp.empty() && newFace.Orientation() != temp[0].Orientation()) {
+                checkFinalShell = true;
             }
+            facesToSew.push_back(newFace);
+            facesToRemove.insert(facesToRemove.end(), temp.begin(), temp.end());
+            // the first shape will be marked as modified, i.e. replaced by newFace, all others are marked as deleted
+            // jrheinlaender: IMHO this is not correct because references to the deleted faces will be broken, whereas they should
+            // be replaced by references to the new face. To achieve this all shapes should be marked as
+            // modified, producing one single new face. This is the inverse behaviour to faces that are split e.g.
+            // by a boolean cut, where one old shape is marked as modified, producing multiple new shapes
+            for (const auto & f : temp)
+                modifiedShapes.emplace_back(f, newFace);
         }
     }
     if (!facesToSew.empty())
@@ -1166,16 +1351,26 @@ bool FaceUniter::process()
         // update the list of modifications
         TopTools_DataMapOfShapeShape faceMap;
         edgeFuse.Faces(faceMap);
+        // index the new faces to find their entries without searching the whole list
+        // Note: the map uses IsSame(). IsEqual() for some reason does not work
+        TopTools_IndexedMapOfShape newFaceMap;
+        std::vector<std::vector<std::size_t>> newFaceEntries;
+        for (std::size_t index = 0; index < modifiedShapes.size(); ++index)
+        {
+            int faceIndex = newFaceMap.Add(modifiedShapes[index].second);
+            if (faceIndex > static_cast<int>(newFaceEntries.size()))
+                newFaceEntries.resize(faceIndex);
+            newFaceEntries[faceIndex - 1].push_back(index);
+        }
         for (mapIt.Initialize(faceMap); mapIt.More(); mapIt.Next())
         {
             bool isModifiedFace = false;
-            for (auto & it : modifiedShapes)
+            int faceIndex = newFaceMap.FindIndex(mapIt.Key());
+            if (faceIndex > 0)
             {
-                if (mapIt.Key().IsSame(it.second)) {
-                    // Note: IsEqual() for some reason does not work
-                    it.second = mapIt.Value();
-                    isModifiedFace = true;
-                }
+                for (std::size_t index : newFaceEntries[faceIndex - 1])
+                    modifiedShapes[index].second = mapIt.Value();
+                isModifiedFace = true;
             }
             if (!isModifiedFace)
             {
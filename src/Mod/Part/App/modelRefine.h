@@ -63,6 +63,13 @@ namespace ModelRefine
         virtual bool isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &faceTwo) const = 0;
         virtual GeomAbs_SurfaceType getType() const = 0;
         virtual TopoDS_Face buildFace(const FaceVectorType &faces) const = 0;
+        /**
+         * Computes a key from the canonical parameters of the surface of \a face. If two
+         * faces are equal their keys differ by at most the sum of their tolerances. This
+         * allows to only compare faces with similar keys. Returns false if the surface type
+         * doesn't support keys.
+         */
+        virtual bool getSurfaceKey(const TopoDS_Face &face, double &key, double &tolerance) const;
 
         static GeomAbs_SurfaceType getFaceType(const TopoDS_Face &faceIn);
 
@@ -79,6 +86,7 @@ namespace ModelRefine
         bool isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &faceTwo) const override;
         GeomAbs_SurfaceType getType() const override;
         TopoDS_Face buildFace(const FaceVectorType &faces) const override;
+        bool getSurfaceKey(const TopoDS_Face &face, double &key, double &tolerance) const override;
         friend FaceTypedPlane& getPlaneObject();
     };
     FaceTypedPlane& getPlaneObject();
@@ -91,6 +99,7 @@ namespace ModelRefine
         bool isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &faceTwo) const override;
         GeomAbs_SurfaceType getType() const override;
         TopoDS_Face buildFace(const FaceVectorType &faces) const override;
+        bool getSurfaceKey(const TopoDS_Face &face, double &key, double &tolerance) const override;
         friend FaceTypedCylinder& getCylinderObject();
 
     protected:
@@ -50,7 +50,9 @@
 
 // STL
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -86,6 +88,8 @@
 #ifndef __QtAll__
 # include <Gui/QtAll.h>
 #endif
+#include <QFutureWatcher>
+#include <QtConcurrentRun>
 
 // Inventor includes OpenGL
 #ifndef __InventorAll__
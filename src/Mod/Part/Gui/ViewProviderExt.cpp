@@ -26,6 +26,7 @@
 # include <Bnd_Box.hxx>
 # include <BRep_Tool.hxx>
 # include <BRepBndLib.hxx>
+# include <BRepBuilderAPI_Copy.hxx>
 # include <BRepBuilderAPI_MakeVertex.hxx>
 # include <BRepExtrema_DistShapeShape.hxx>
 # include <BRepMesh_IncrementalMesh.hxx>
@@ -48,8 +49,12 @@
 # include <TopoDS_Vertex.hxx>
 # include <TopTools_IndexedMapOfShape.hxx>
 
+# include <atomic>
+# include <memory>
 # include <QAction>
+# include <QFutureWatcher>
 # include <QMenu>
+# include <QtConcurrentRun>
 # include <sstream>
 
 # include <Inventor/SoPickedPoint.h>
@@ -234,6 +239,7 @@ ViewProviderPartExt::ViewProviderPartExt()
 
 ViewProviderPartExt::~ViewProviderPartExt()
 {
+    cancelTessellation();
     pcFaceBind->unref();
     pcLineBind->unref();
     pcPointBind->unref();
@@ -486,7 +492,9 @@ std::vector<std::string> ViewProviderPartExt::getDisplayModes() const
 std::string ViewProviderPartExt::getElement(const SoDetail* detail) const
 {
     std::stringstream str;
-    if (detail) {
+    // The nodes still show the old shape while it's tessellated in the background,
+    // so a detail cannot be mapped to an element of the new shape
+    if (detail && !isTessellationPending()) {
         if (detail->getTypeId() == SoFaceDetail::getClassTypeId()) {
             const SoFaceDetail* face_detail = static_cast<const SoFaceDetail*>(detail);
             int face = face_detail->getPartIndex() + 1;
@@ -509,6 +517,9 @@ std::string ViewProviderPartExt::getElement(const SoDetail* detail) const
 
 SoDetail* ViewProviderPartExt::getDetail(const char* subelement) const
 {
+    if (isTessellationPending())
+        return nullptr;
+
     auto type = Part::TopoShape::getElementTypeAndIndex(subelement);
     std::string element = type.first;
     int index = type.second;
@@ -587,6 +598,10 @@ void ViewProviderPartExt::setHighlightedFaces(const std::vector<App::Color>& col
     if (getObject() && getObject()->testStatus(App::ObjectStatus::TouchOnColorChange))
         getObject()->touch(true);
 
+    // applied with the new tessellation, see applyVisual()
+    if (isTessellationPending())
+        return;
+
     Gui::SoUpdateVBOAction action;
     action.apply(this->faceset);
 
@@ -613,6 +628,9 @@ void ViewProviderPartExt::setHighlightedFaces(const std::vector<App::Color>& col
 
 void ViewProviderPartExt::setHighlightedFaces(const std::vector<App::Material>& colors)
 {
+    if (isTessellationPending())
+        return;
+
     int size = static_cast<int>(colors.size());
     if (size > 1 && size == this->faceset->partIndex.getNum()) {
         pcFaceBind->value = SoMaterialBinding::PER_PART;
@@ -744,6 +762,8 @@ void ViewProviderPartExt::setHighlightedEdges(const std::vector<App::Color>& col
 {
     if (getObject() && getObject()->testStatus(App::ObjectStatus::TouchOnColorChange))
         getObject()->touch(true);
+    if (isTessellationPending())
+        return;
     int size = static_cast<int>(colors.size());
     if (size > 1) {
         // Although indexed lineset is used the material binding must be PER_FACE!
@@ -781,6 +801,8 @@ void ViewProviderPartExt::setHighlightedPoints(const std::vector<App::Color>& co
 {
     if (getObject() && getObject()->testStatus(App::ObjectStatus::TouchOnColorChange))
         getObject()->touch(true);
+    if (isTessellationPending())
+        return;
     int size = static_cast<int>(colors.size());
     if (size > 1) {
         pcPointBind->value = SoMaterialBinding::PER_VERTEX;
@@ -837,16 +859,22 @@ void ViewProviderPartExt::updateData(const App::Property* prop)
         else
             VisualTouched = true;
 
-        if (!VisualTouched) {
-            if (this->faceset->partIndex.getNum() >
-                this->pcShapeMaterial->diffuseColor.getNum()) {
-                this->pcFaceBind->value = SoMaterialBinding::OVERALL;
-            }
+        // with a background tessellation this is done once it has finished
+        if (!VisualTouched && !isTessellationPending()) {
+            checkFaceBinding();
         }
     }
     Gui::ViewProviderGeometryObject::updateData(prop);
 }
 
+void ViewProviderPartExt::checkFaceBinding()
+{
+    if (this->faceset->partIndex.getNum() >
+        this->pcShapeMaterial->diffuseColor.getNum()) {
+        this->pcFaceBind->value = SoMaterialBinding::OVERALL;
+    }
+}
+
 void ViewProviderPartExt::setupContextMenu(QMenu* menu, QObject* receiver, const char* member)
 {
     QIcon iconObject = mergeGreyableOverlayIcons(Gui::BitmapFactory().pixmap("Part_ColorFace.svg"));
@@ -891,401 +919,498 @@ void ViewProviderPartExt::unsetEdit(int ModNum)
     }
 }
 
-void ViewProviderPartExt::updateVisual()
+namespace PartGui {
+
+/// Settings of a tessellation run
+struct TessellationParams
 {
-    Gui::SoUpdateVBOAction action;
-    action.apply(this->faceset);
+    double deviation = 0.5;
+    double angularDeflection = 28.5;
+    bool normalsFromUV = true;
+};
 
-    // Clear selection
-    Gui::SoSelectionElementAction saction(Gui::SoSelectionElementAction::None);
-    saction.apply(this->faceset);
-    saction.apply(this->lineset);
-    saction.apply(this->nodeset);
+/// Holds the arrays of the Inventor nodes of a tessellated shape
+struct VisualData
+{
+    std::vector<SbVec3f> verts;
+    std::vector<SbVec3f> norms;
+    std::vector<int32_t> faceIndex;
+    std::vector<int32_t> partIndex;
+    std::vector<int32_t> lineIndex;
+    int nodeStartIndex = 0;
+    bool valid = false;
+    std::string error;
+};
+
+/// A tessellation running in a worker thread
+class TessellationJob
+{
+public:
+    ~TessellationJob()
+    {
+        delete watcher;
+    }
 
-    // Clear highlighting
-    Gui::SoHighlightElementAction haction;
-    haction.apply(this->faceset);
-    haction.apply(this->lineset);
-    haction.apply(this->nodeset);
+    TopoDS_Shape shape;
+    // the shape of the object, it takes over the triangulation of the meshed copy
+    TopoDS_Shape source;
+    TessellationParams params;
+    VisualData data;
+    std::atomic<bool> canceled{false};
+    QFutureWatcher<void>* watcher = nullptr;
+};
 
-    TopoDS_Shape cShape = Part::Feature::getShape(getObject());
-    if (cShape.IsNull()) {
-        coords  ->point      .setNum(0);
-        norm    ->vector     .setNum(0);
-        faceset ->coordIndex .setNum(0);
-        faceset ->partIndex  .setNum(0);
-        lineset ->coordIndex .setNum(0);
-        nodeset ->startIndex .setValue(0);
-        VisualTouched = false;
-        return;
-    }
+}
 
-    // time measurement and book keeping
-    Base::TimeElapsed start_time;
-    int numTriangles=0,numNodes=0,numNorms=0,numFaces=0,numEdges=0,numLines=0;
+namespace {
+
+// Tessellates the shape and fills up the arrays of the Inventor nodes. This function
+// doesn't access any Coin nodes and thus can be run in a worker thread.
+void buildVisual(TopoDS_Shape cShape, const TessellationParams& params,
+                 VisualData& data, const std::atomic<bool>* canceled)
+{
+    auto isCanceled = [canceled]() {
+        return canceled && canceled->load();
+    };
+
+    int numTriangles=0,numNodes=0,numNorms=0,numFaces=0;
     std::set<int> faceEdges;
 
-    try {
-        // calculating the deflection value
-        Bnd_Box bounds;
-        BRepBndLib::Add(cShape, bounds);
-        bounds.SetGap(0.0);
-        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
-        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
-        Standard_Real deflection = ((xMax-xMin)+(yMax-yMin)+(zMax-zMin))/300.0 * Deviation.getValue();
-
-        // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single vertex
-        // should be displayed.
-        if (deflection < gp::Resolution()) {
-            deflection = Precision::Confusion();
-        }
+    // calculating the deflection value
+    Bnd_Box bounds;
+    BRepBndLib::Add(cShape, bounds);
+    bounds.SetGap(0.0);
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    Standard_Real deflection = ((xMax-xMin)+(yMax-yMin)+(zMax-zMin))/300.0 * params.deviation;
+
+    // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single vertex
+    // should be displayed.
+    if (deflection < gp::Resolution()) {
+        deflection = Precision::Confusion();
+    }
 
-        // For very big objects the computed deflection can become very high and thus leads to a useless
-        // tessellation. To avoid this the upper limit is set to 20.0
-        // See also forum: https://forum.freecad.org/viewtopic.php?t=77521
-        deflection = std::min(deflection, 20.0);
+    // For very big objects the computed deflection can become very high and thus leads to a useless
+    // tessellation. To avoid this the upper limit is set to 20.0
+    // See also forum: https://forum.freecad.org/viewtopic.php?t=77521
+    deflection = std::min(deflection, 20.0);
 
-        // create or use the mesh on the data structure
-        Standard_Real AngDeflectionRads = AngularDeflection.getValue() / 180.0 * M_PI;
+    // create or use the mesh on the data structure
+    Standard_Real AngDeflectionRads = params.angularDeflection / 180.0 * M_PI;
 
+    // BRepMesh keeps a triangulation, e.g. one restored from the document, whose
+    // deflection is close enough to the requested value
 #if OCC_VERSION_HEX >= 0x070500
-        IMeshTools_Parameters meshParams;
-        meshParams.Deflection = deflection;
-        meshParams.Relative = Standard_False;
-        meshParams.Angle = AngDeflectionRads;
-        meshParams.InParallel = Standard_True;
-        meshParams.AllowQualityDecrease = Standard_True;
-
-        BRepMesh_IncrementalMesh(cShape, meshParams);
+    IMeshTools_Parameters meshParams;
+    meshParams.Deflection = deflection;
+    meshParams.Relative = Standard_False;
+    meshParams.Angle = AngDeflectionRads;
+    meshParams.InParallel = Standard_True;
+    meshParams.AllowQualityDecrease = Standard_True;
+
+    BRepMesh_IncrementalMesh(cShape, meshParams);
 #else
-        BRepMesh_IncrementalMesh(cShape, deflection, Standard_False, AngDeflectionRads, Standard_True);
+    BRepMesh_IncrementalMesh(cShape, deflection, Standard_False, AngDeflectionRads, Standard_True);
 #endif
 
-        // We must reset the location here because the transformation data
-        // are set in the placement property
+    if (isCanceled()) {
+        return;
+    }
+
+    // We must reset the location here because the transformation data
+    // are set in the placement property
+    TopLoc_Location aLoc;
+    cShape.Location(aLoc);
+
+    // count triangles and nodes in the mesh
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(cShape, TopAbs_FACE, faceMap);
+    for (int i=1; i <= faceMap.Extent(); i++) {
+        Handle (Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(faceMap(i)), aLoc);
+        if (mesh.IsNull()) {
+            mesh = Part::Tools::triangulationOfFace(TopoDS::Face(faceMap(i)));
+        }
+        // Note: we must also count empty faces
+        if (!mesh.IsNull()) {
+            numTriangles += mesh->NbTriangles();
+            numNodes     += mesh->NbNodes();
+            numNorms     += mesh->NbNodes();
+        }
+
+        TopExp_Explorer xp;
+        for (xp.Init(faceMap(i),TopAbs_EDGE);xp.More();xp.Next()) {
+            faceEdges.insert(Part::ShapeMapHasher{}(xp.Current()));
+        }
+        numFaces++;
+    }
+
+    // get an indexed map of edges
+    TopTools_IndexedMapOfShape edgeMap;
+    TopExp::MapShapes(cShape, TopAbs_EDGE, edgeMap);
+
+     // key is the edge number, value the coord indexes. This is needed to keep the same order as the edges.
+    std::map<int, std::vector<int32_t> > lineSetMap;
+    std::set<int>          edgeIdxSet;
+    std::vector<int32_t>   edgeVector;
+
+    // count and index the edges
+    for (int i=1; i <= edgeMap.Extent(); i++) {
+        edgeIdxSet.insert(i);
+
+        const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
         TopLoc_Location aLoc;
-        cShape.Location(aLoc);
-
-        // count triangles and nodes in the mesh
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(cShape, TopAbs_FACE, faceMap);
-        for (int i=1; i <= faceMap.Extent(); i++) {
-            Handle (Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(faceMap(i)), aLoc);
-            if (mesh.IsNull()) {
-                mesh = Part::Tools::triangulationOfFace(TopoDS::Face(faceMap(i)));
-            }
-            // Note: we must also count empty faces
-            if (!mesh.IsNull()) {
-                numTriangles += mesh->NbTriangles();
-                numNodes     += mesh->NbNodes();
-                numNorms     += mesh->NbNodes();
-            }
 
-            TopExp_Explorer xp;
-            for (xp.Init(faceMap(i),TopAbs_EDGE);xp.More();xp.Next()) {
-                faceEdges.insert(Part::ShapeMapHasher{}(xp.Current()));
+        // handling of the free edge that are not associated to a face
+        // Note: The assumption that if for an edge BRep_Tool::Polygon3D
+        // returns a valid object is wrong. This e.g. happens for ruled
+        // surfaces which gets created by two edges or wires.
+        // So, we have to store the hashes of the edges associated to a face.
+        // If the hash of a given edge is not in this list we know it's really
+        // a free edge.
+        int hash = Part::ShapeMapHasher{}(aEdge);
+        if (faceEdges.find(hash) == faceEdges.end()) {
+            Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(aEdge, aLoc);
+            if (!aPoly.IsNull()) {
+                int nbNodesInEdge = aPoly->NbNodes();
+                numNodes += nbNodesInEdge;
             }
-            numFaces++;
         }
+    }
 
-        // get an indexed map of edges
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(cShape, TopAbs_EDGE, edgeMap);
-
-         // key is the edge number, value the coord indexes. This is needed to keep the same order as the edges.
-        std::map<int, std::vector<int32_t> > lineSetMap;
-        std::set<int>          edgeIdxSet;
-        std::vector<int32_t>   edgeVector;
-
-        // count and index the edges
-        for (int i=1; i <= edgeMap.Extent(); i++) {
-            edgeIdxSet.insert(i);
-            numEdges++;
-
-            const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
-            TopLoc_Location aLoc;
-
-            // handling of the free edge that are not associated to a face
-            // Note: The assumption that if for an edge BRep_Tool::Polygon3D
-            // returns a valid object is wrong. This e.g. happens for ruled
-            // surfaces which gets created by two edges or wires.
-            // So, we have to store the hashes of the edges associated to a face.
-            // If the hash of a given edge is not in this list we know it's really
-            // a free edge.
-            int hash = Part::ShapeMapHasher{}(aEdge);
-            if (faceEdges.find(hash) == faceEdges.end()) {
-                Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(aEdge, aLoc);
-                if (!aPoly.IsNull()) {
-                    int nbNodesInEdge = aPoly->NbNodes();
-                    numNodes += nbNodesInEdge;
-                }
-            }
+    // handling of the vertices
+    TopTools_IndexedMapOfShape vertexMap;
+    TopExp::MapShapes(cShape, TopAbs_VERTEX, vertexMap);
+    numNodes += vertexMap.Extent();
+
+    // create memory for the nodes and indexes
+    // preset the normal vector with null vector
+    data.verts.resize(numNodes);
+    data.norms.assign(numNorms, SbVec3f(0.0,0.0,0.0));
+    data.faceIndex.resize(numTriangles*4);
+    data.partIndex.resize(numFaces);
+    SbVec3f* verts = data.verts.data();
+    SbVec3f* norms = data.norms.data();
+    int32_t* index = data.faceIndex.data();
+    int32_t* parts = data.partIndex.data();
+
+    int ii = 0,faceNodeOffset=0,faceTriaOffset=0;
+    for (int i=1; i <= faceMap.Extent(); i++, ii++) {
+        if (isCanceled()) {
+            return;
         }
 
-        // handling of the vertices
-        TopTools_IndexedMapOfShape vertexMap;
-        TopExp::MapShapes(cShape, TopAbs_VERTEX, vertexMap);
-        numNodes += vertexMap.Extent();
-
-        // create memory for the nodes and indexes
-        coords  ->point      .setNum(numNodes);
-        norm    ->vector     .setNum(numNorms);
-        faceset ->coordIndex .setNum(numTriangles*4);
-        faceset ->partIndex  .setNum(numFaces);
-        // get the raw memory for fast fill up
-        SbVec3f* verts = coords  ->point       .startEditing();
-        SbVec3f* norms = norm    ->vector      .startEditing();
-        int32_t* index = faceset ->coordIndex  .startEditing();
-        int32_t* parts = faceset ->partIndex   .startEditing();
-
-        // preset the normal vector with null vector
-        for (int i=0;i < numNorms;i++)
-            norms[i]= SbVec3f(0.0,0.0,0.0);
-
-        int ii = 0,faceNodeOffset=0,faceTriaOffset=0;
-        for (int i=1; i <= faceMap.Extent(); i++, ii++) {
-            TopLoc_Location aLoc;
-            const TopoDS_Face &actFace = TopoDS::Face(faceMap(i));
-            // get the mesh of the shape
-            Handle (Poly_Triangulation) mesh = BRep_Tool::Triangulation(actFace,aLoc);
-            if (mesh.IsNull()) {
-                mesh = Part::Tools::triangulationOfFace(actFace);
-            }
-            if (mesh.IsNull()) {
-                parts[ii] = 0;
-                continue;
-            }
+        TopLoc_Location aLoc;
+        const TopoDS_Face &actFace = TopoDS::Face(faceMap(i));
+        // get the mesh of the shape
+        Handle (Poly_Triangulation) mesh = BRep_Tool::Triangulation(actFace,aLoc);
+        if (mesh.IsNull()) {
+            mesh = Part::Tools::triangulationOfFace(actFace);
+        }
+        if (mesh.IsNull()) {
+            parts[ii] = 0;
+            continue;
+        }
 
-            // getting the transformation of the shape/face
-            gp_Trsf myTransf;
-            Standard_Boolean identity = true;
-            if (!aLoc.IsIdentity()) {
-                identity = false;
-                myTransf = aLoc.Transformation();
-            }
+        // getting the transformation of the shape/face
+        gp_Trsf myTransf;
+        Standard_Boolean identity = true;
+        if (!aLoc.IsIdentity()) {
+            identity = false;
+            myTransf = aLoc.Transformation();
+        }
 
-            // getting size of node and triangle array of this face
-            int nbNodesInFace = mesh->NbNodes();
-            int nbTriInFace   = mesh->NbTriangles();
-            // check orientation
-            TopAbs_Orientation orient = actFace.Orientation();
+        // getting size of node and triangle array of this face
+        int nbNodesInFace = mesh->NbNodes();
+        int nbTriInFace   = mesh->NbTriangles();
+        // check orientation
+        TopAbs_Orientation orient = actFace.Orientation();
 
 
-            // cycling through the poly mesh
+        // cycling through the poly mesh
 #if OCC_VERSION_HEX < 0x070600
-            const Poly_Array1OfTriangle& Triangles = mesh->Triangles();
-            const TColgp_Array1OfPnt& Nodes = mesh->Nodes();
-            TColgp_Array1OfDir Normals (Nodes.Lower(), Nodes.Upper());
+        const Poly_Array1OfTriangle& Triangles = mesh->Triangles();
+        const TColgp_Array1OfPnt& Nodes = mesh->Nodes();
+        TColgp_Array1OfDir Normals (Nodes.Lower(), Nodes.Upper());
 #else
-            int numNodes =  mesh->NbNodes();
-            TColgp_Array1OfDir Normals (1, numNodes);
+        int numNodes =  mesh->NbNodes();
+        TColgp_Array1OfDir Normals (1, numNodes);
 #endif
-            if (NormalsFromUV)
-                Part::Tools::getPointNormals(actFace, mesh, Normals);
+        if (params.normalsFromUV)
+            Part::Tools::getPointNormals(actFace, mesh, Normals);
 
-            for (int g=1;g<=nbTriInFace;g++) {
-                // Get the triangle
-                Standard_Integer N1,N2,N3;
+        for (int g=1;g<=nbTriInFace;g++) {
+            // Get the triangle
+            Standard_Integer N1,N2,N3;
 #if OCC_VERSION_HEX < 0x070600
-                Triangles(g).Get(N1,N2,N3);
+            Triangles(g).Get(N1,N2,N3);
 #else
-                mesh->Triangle(g).Get(N1,N2,N3);
+            mesh->Triangle(g).Get(N1,N2,N3);
 #endif
 
-                // change orientation of the triangle if the face is reversed
-                if ( orient != TopAbs_FORWARD ) {
-                    Standard_Integer tmp = N1;
-                    N1 = N2;
-                    N2 = tmp;
-                }
+            // change orientation of the triangle if the face is reversed
+            if ( orient != TopAbs_FORWARD ) {
+                Standard_Integer tmp = N1;
+                N1 = N2;
+                N2 = tmp;
+            }
 
-                // get the 3 points of this triangle
+            // get the 3 points of this triangle
 #if OCC_VERSION_HEX < 0x070600
-                gp_Pnt V1(Nodes(N1)), V2(Nodes(N2)), V3(Nodes(N3));
+            gp_Pnt V1(Nodes(N1)), V2(Nodes(N2)), V3(Nodes(N3));
 #else
-                gp_Pnt V1(mesh->Node(N1)), V2(mesh->Node(N2)), V3(mesh->Node(N3));
+            gp_Pnt V1(mesh->Node(N1)), V2(mesh->Node(N2)), V3(mesh->Node(N3));
 #endif
 
-                // get the 3 normals of this triangle
-                gp_Vec NV1, NV2, NV3;
-                if (NormalsFromUV) {
-                    NV1.SetXYZ(Normals(N1).XYZ());
-                    NV2.SetXYZ(Normals(N2).XYZ());
-                    NV3.SetXYZ(Normals(N3).XYZ());
-                }
-                else {
-                    gp_Vec v1(V1.X(),V1.Y(),V1.Z()),
-                           v2(V2.X(),V2.Y(),V2.Z()),
-                           v3(V3.X(),V3.Y(),V3.Z());
-                    gp_Vec normal = (v2-v1)^(v3-v1);
-                    NV1 = normal;
-                    NV2 = normal;
-                    NV3 = normal;
-                }
+            // get the 3 normals of this triangle
+            gp_Vec NV1, NV2, NV3;
+            if (params.normalsFromUV) {
+                NV1.SetXYZ(Normals(N1).XYZ());
+                NV2.SetXYZ(Normals(N2).XYZ());
+                NV3.SetXYZ(Normals(N3).XYZ());
+            }
+            else {
+                gp_Vec v1(V1.X(),V1.Y(),V1.Z()),
+                       v2(V2.X(),V2.Y(),V2.Z()),
+                       v3(V3.X(),V3.Y(),V3.Z());
+                gp_Vec normal = (v2-v1)^(v3-v1);
+                NV1 = normal;
+                NV2 = normal;
+                NV3 = normal;
+            }
 
-                // transform the vertices and normals to the place of the face
-                if (!identity) {
-                    V1.Transform(myTransf);
-                    V2.Transform(myTransf);
-                    V3.Transform(myTransf);
-                    if (NormalsFromUV) {
-                        NV1.Transform(myTransf);
-                        NV2.Transform(myTransf);
-                        NV3.Transform(myTransf);
-                    }
+            // transform the vertices and normals to the place of the face
+            if (!identity) {
+                V1.Transform(myTransf);
+                V2.Transform(myTransf);
+                V3.Transform(myTransf);
+                if (params.normalsFromUV) {
+                    NV1.Transform(myTransf);
+                    NV2.Transform(myTransf);
+                    NV3.Transform(myTransf);
                 }
-
-                // add the normals for all points of this triangle
-                norms[faceNodeOffset+N1-1] += SbVec3f(NV1.X(),NV1.Y(),NV1.Z());
-                norms[faceNodeOffset+N2-1] += SbVec3f(NV2.X(),NV2.Y(),NV2.Z());
-                norms[faceNodeOffset+N3-1] += SbVec3f(NV3.X(),NV3.Y(),NV3.Z());
-
-                // set the vertices
-                verts[faceNodeOffset+N1-1].setValue((float)(V1.X()),(float)(V1.Y()),(float)(V1.Z()));
-                verts[faceNodeOffset+N2-1].setValue((float)(V2.X()),(float)(V2.Y()),(float)(V2.Z()));
-                verts[faceNodeOffset+N3-1].setValue((float)(V3.X()),(float)(V3.Y()),(float)(V3.Z()));
-
-                // set the index vector with the 3 point indexes and the end delimiter
-                index[faceTriaOffset*4+4*(g-1)]   = faceNodeOffset+N1-1;
-                index[faceTriaOffset*4+4*(g-1)+1] = faceNodeOffset+N2-1;
-                index[faceTriaOffset*4+4*(g-1)+2] = faceNodeOffset+N3-1;
-                index[faceTriaOffset*4+4*(g-1)+3] = SO_END_FACE_INDEX;
             }
 
-            parts[ii] = nbTriInFace; // new part
-
-            // handling the edges lying on this face
-            TopExp_Explorer Exp;
-            for(Exp.Init(actFace,TopAbs_EDGE);Exp.More();Exp.Next()) {
-                const TopoDS_Edge &curEdge = TopoDS::Edge(Exp.Current());
-                // get the overall index of this edge
-                int edgeIndex = edgeMap.FindIndex(curEdge);
-                edgeVector.push_back((int32_t)edgeIndex-1);
-                // already processed this index ?
-                if (edgeIdxSet.find(edgeIndex)!=edgeIdxSet.end()) {
-
-                    // this holds the indices of the edge's triangulation to the current polygon
-                    Handle(Poly_PolygonOnTriangulation) aPoly = BRep_Tool::PolygonOnTriangulation(curEdge, mesh, aLoc);
-                    if (aPoly.IsNull())
-                        continue; // polygon does not exist
-
-                    // getting the indexes of the edge polygon
-                    const TColStd_Array1OfInteger& indices = aPoly->Nodes();
-                    for (Standard_Integer i=indices.Lower();i <= indices.Upper();i++) {
-                        int nodeIndex = indices(i);
-                        int index = faceNodeOffset+nodeIndex-1;
-                        lineSetMap[edgeIndex].push_back(index);
-
-                        // usually the coordinates for this edge are already set by the
-                        // triangles of the face this edge belongs to. However, there are
-                        // rare cases where some points are only referenced by the polygon
-                        // but not by any triangle. Thus, we must apply the coordinates to
-                        // make sure that everything is properly set.
+            // add the normals for all points of this triangle
+            norms[faceNodeOffset+N1-1] += SbVec3f(NV1.X(),NV1.Y(),NV1.Z());
+            norms[faceNodeOffset+N2-1] += SbVec3f(NV2.X(),NV2.Y(),NV2.Z());
+            norms[faceNodeOffset+N3-1] += SbVec3f(NV3.X(),NV3.Y(),NV3.Z());
+
+            // set the vertices
+            verts[faceNodeOffset+N1-1].setValue((float)(V1.X()),(float)(V1.Y()),(float)(V1.Z()));
+            verts[faceNodeOffset+N2-1].setValue((float)(V2.X()),(float)(V2.Y()),(float)(V2.Z()));
+            verts[faceNodeOffset+N3-1].setValue((float)(V3.X()),(float)(V3.Y()),(float)(V3.Z()));
+
+            // set the index vector with the 3 point indexes and the end delimiter
+            index[faceTriaOffset*4+4*(g-1)]   = faceNodeOffset+N1-1;
+            index[faceTriaOffset*4+4*(g-1)+1] = faceNodeOffset+N2-1;
+            index[faceTriaOffset*4+4*(g-1)+2] = faceNodeOffset+N3-1;
+            index[faceTriaOffset*4+4*(g-1)+3] = SO_END_FACE_INDEX;
+        }
+
+        parts[ii] = nbTriInFace; // new part
+
+        // handling the edges lying on this face
+        TopExp_Explorer Exp;
+        for(Exp.Init(actFace,TopAbs_EDGE);Exp.More();Exp.Next()) {
+            const TopoDS_Edge &curEdge = TopoDS::Edge(Exp.Current());
+            // get the overall index of this edge
+            int edgeIndex = edgeMap.FindIndex(curEdge);
+            edgeVector.push_back((int32_t)edgeIndex-1);
+            // already processed this index ?
+            if (edgeIdxSet.find(edgeIndex)!=edgeIdxSet.end()) {
+
+                // this holds the indices of the edge's triangulation to the current polygon
+                Handle(Poly_PolygonOnTriangulation) aPoly = BRep_Tool::PolygonOnTriangulation(curEdge, mesh, aLoc);
+                if (aPoly.IsNull())
+                    continue; // polygon does not exist
+
+                // getting the indexes of the edge polygon
+                const TColStd_Array1OfInteger& indices = aPoly->Nodes();
+                for (Standard_Integer i=indices.Lower();i <= indices.Upper();i++) {
+                    int nodeIndex = indices(i);
+                    int index = faceNodeOffset+nodeIndex-1;
+                    lineSetMap[edgeIndex].push_back(index);
+
+                    // usually the coordinates for this edge are already set by the
+                    // triangles of the face this edge belongs to. However, there are
+                    // rare cases where some points are only referenced by the polygon
+                    // but not by any triangle. Thus, we must apply the coordinates to
+                    // make sure that everything is properly set.
 #if OCC_VERSION_HEX < 0x070600
-                        gp_Pnt p(Nodes(nodeIndex));
+                    gp_Pnt p(Nodes(nodeIndex));
 #else
-                        gp_Pnt p(mesh->Node(nodeIndex));
+                    gp_Pnt p(mesh->Node(nodeIndex));
 #endif
-                        if (!identity)
-                            p.Transform(myTransf);
-                        verts[index].setValue((float)(p.X()),(float)(p.Y()),(float)(p.Z()));
-                    }
-
-                    // remove the handled edge index from the set
-                    edgeIdxSet.erase(edgeIndex);
+                    if (!identity)
+                        p.Transform(myTransf);
+                    verts[index].setValue((float)(p.X()),(float)(p.Y()),(float)(p.Z()));
                 }
+
+                // remove the handled edge index from the set
+                edgeIdxSet.erase(edgeIndex);
             }
+        }
 
-            edgeVector.push_back(-1);
+        edgeVector.push_back(-1);
 
-            // counting up the per Face offsets
-            faceNodeOffset += nbNodesInFace;
-            faceTriaOffset += nbTriInFace;
-        }
+        // counting up the per Face offsets
+        faceNodeOffset += nbNodesInFace;
+        faceTriaOffset += nbTriInFace;
+    }
 
-        // handling of the free edges
-        for (int i=1; i <= edgeMap.Extent(); i++) {
-            const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
-            Standard_Boolean identity = true;
-            gp_Trsf myTransf;
-            TopLoc_Location aLoc;
-
-            // handling of the free edge that are not associated to a face
-            int hash = Part::ShapeMapHasher{}(aEdge);
-            if (faceEdges.find(hash) == faceEdges.end()) {
-                Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(aEdge, aLoc);
-                if (!aPoly.IsNull()) {
-                    if (!aLoc.IsIdentity()) {
-                        identity = false;
-                        myTransf = aLoc.Transformation();
-                    }
-
-                    const TColgp_Array1OfPnt& aNodes = aPoly->Nodes();
-                    int nbNodesInEdge = aPoly->NbNodes();
-
-                    gp_Pnt pnt;
-                    for (Standard_Integer j=1;j <= nbNodesInEdge;j++) {
-                        pnt = aNodes(j);
-                        if (!identity)
-                            pnt.Transform(myTransf);
-                        int index = faceNodeOffset+j-1;
-                        verts[index].setValue((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
-                        lineSetMap[i].push_back(index);
-                    }
-
-                    faceNodeOffset += nbNodesInEdge;
+    // handling of the free edges
+    for (int i=1; i <= edgeMap.Extent(); i++) {
+        const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
+        Standard_Boolean identity = true;
+        gp_Trsf myTransf;
+        TopLoc_Location aLoc;
+
+        // handling of the free edge that are not associated to a face
+        int hash = Part::ShapeMapHasher{}(aEdge);
+        if (faceEdges.find(hash) == faceEdges.end()) {
+            Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(aEdge, aLoc);
+            if (!aPoly.IsNull()) {
+                if (!aLoc.IsIdentity()) {
+                    identity = false;
+                    myTransf = aLoc.Transformation();
+                }
+
+                const TColgp_Array1OfPnt& aNodes = aPoly->Nodes();
+                int nbNodesInEdge = aPoly->NbNodes();
+
+                gp_Pnt pnt;
+                for (Standard_Integer j=1;j <= nbNodesInEdge;j++) {
+                    pnt = aNodes(j);
+                    if (!identity)
+                        pnt.Transform(myTransf);
+                    int index = faceNodeOffset+j-1;
+                    verts[index].setValue((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
+                    lineSetMap[i].push_back(index);
                 }
+
+                faceNodeOffset += nbNodesInEdge;
             }
         }
+    }
 
-        nodeset->startIndex.setValue(faceNodeOffset);
-        for (int i=0; i<vertexMap.Extent(); i++) {
-            const TopoDS_Vertex& aVertex = TopoDS::Vertex(vertexMap(i+1));
-            gp_Pnt pnt = BRep_Tool::Pnt(aVertex);
-            verts[faceNodeOffset+i].setValue((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
-        }
+    data.nodeStartIndex = faceNodeOffset;
+    for (int i=0; i<vertexMap.Extent(); i++) {
+        const TopoDS_Vertex& aVertex = TopoDS::Vertex(vertexMap(i+1));
+        gp_Pnt pnt = BRep_Tool::Pnt(aVertex);
+        verts[faceNodeOffset+i].setValue((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
+    }
 
-        // normalize all normals
-        for (int i = 0; i< numNorms ;i++)
-            norms[i].normalize();
+    // normalize all normals
+    for (int i = 0; i< numNorms ;i++)
+        norms[i].normalize();
 
-        std::vector<int32_t> lineSetCoords;
-        for (const auto & it : lineSetMap) {
-            lineSetCoords.insert(lineSetCoords.end(), it.second.begin(), it.second.end());
-            lineSetCoords.push_back(-1);
-        }
+    for (const auto & it : lineSetMap) {
+        data.lineIndex.insert(data.lineIndex.end(), it.second.begin(), it.second.end());
+        data.lineIndex.push_back(-1);
+    }
+
+    data.valid = true;
+}
+
+}
+
+void ViewProviderPartExt::updateVisual()
+{
+    Gui::SoUpdateVBOAction action;
+    action.apply(this->faceset);
+
+    // Clear selection
+    Gui::SoSelectionElementAction saction(Gui::SoSelectionElementAction::None);
+    saction.apply(this->faceset);
+    saction.apply(this->lineset);
+    saction.apply(this->nodeset);
 
-        // preset the index vector size
-        numLines =  lineSetCoords.size();
-        lineset ->coordIndex .setNum(numLines);
-        int32_t* lines = lineset ->coordIndex  .startEditing();
-
-        int l=0;
-        for (std::vector<int32_t>::const_iterator it=lineSetCoords.begin();it!=lineSetCoords.end();++it,l++)
-            lines[l] = *it;
-
-        // end the editing of the nodes
-        coords  ->point       .finishEditing();
-        norm    ->vector      .finishEditing();
-        faceset ->coordIndex  .finishEditing();
-        faceset ->partIndex   .finishEditing();
-        lineset ->coordIndex  .finishEditing();
+    // Clear highlighting
+    Gui::SoHighlightElementAction haction;
+    haction.apply(this->faceset);
+    haction.apply(this->lineset);
+    haction.apply(this->nodeset);
+
+    // a running or pending tessellation is outdated now
+    pendingJob.reset();
+    if (tessJob) {
+        tessJob->canceled = true;
+    }
+
+    TopoDS_Shape cShape = Part::Feature::getShape(getObject());
+    if (cShape.IsNull()) {
+        coords  ->point      .setNum(0);
+        norm    ->vector     .setNum(0);
+        faceset ->coordIndex .setNum(0);
+        faceset ->partIndex  .setNum(0);
+        lineset ->coordIndex .setNum(0);
+        nodeset ->startIndex .setValue(0);
+        VisualTouched = false;
+        return;
+    }
+
+    TessellationParams params;
+    params.deviation = Deviation.getValue();
+    params.angularDeflection = AngularDeflection.getValue();
+    params.normalsFromUV = NormalsFromUV;
+
+    // Forced updates are expected to be done immediately
+    if (!isUpdateForced() && isTessellationInBackground()) {
+        startTessellation(cShape, params);
+        return;
+    }
+
+    // a running job is outdated now
+    cancelTessellation();
+
+    // time measurement and book keeping
+    Base::TimeElapsed start_time;
+    VisualData data;
+    try {
+        buildVisual(cShape, params, data, nullptr);
     }
     catch (const Standard_Failure& e) {
-        FC_ERR("Cannot compute Inventor representation for the shape of "
-               << pcObject->getFullName() << ": " << e.GetMessageString());
+        data.error = e.GetMessageString();
     }
     catch (...) {
-        FC_ERR("Cannot compute Inventor representation for the shape of " << pcObject->getFullName());
+        data.error = "Unknown exception";
     }
 
 #   ifdef FC_DEBUG
         // printing some information
         Base::Console().Log("ViewProvider update time: %f s\n",Base::TimeElapsed::diffTimeF(start_time,Base::TimeElapsed()));
-        Base::Console().Log("Shape tria info: Faces:%d Edges:%d Nodes:%d Triangles:%d IdxVec:%d\n",numFaces,numEdges,numNodes,numTriangles,numLines);
+        Base::Console().Log("Shape tria info: Nodes:%d Triangles:%d IdxVec:%d\n",
+                            static_cast<int>(data.verts.size()),
+                            static_cast<int>(data.faceIndex.size() / 4),
+                            static_cast<int>(data.lineIndex.size()));
 #   else
-    (void)numEdges;
+    (void)start_time;
 #   endif
+
+    applyVisual(data);
+}
+
+void ViewProviderPartExt::applyVisual(const VisualData& data)
+{
+    if (!data.error.empty()) {
+        FC_ERR("Cannot compute Inventor representation for the shape of "
+               << pcObject->getFullName() << ": " << data.error);
+    }
+
+    if (data.valid) {
+        coords  ->point      .setValues(0, static_cast<int>(data.verts.size()), data.verts.data());
+        coords  ->point      .setNum(static_cast<int>(data.verts.size()));
+        norm    ->vector     .setValues(0, static_cast<int>(data.norms.size()), data.norms.data());
+        norm    ->vector     .setNum(static_cast<int>(data.norms.size()));
+        faceset ->coordIndex .setValues(0, static_cast<int>(data.faceIndex.size()), data.faceIndex.data());
+        faceset ->coordIndex .setNum(static_cast<int>(data.faceIndex.size()));
+        faceset ->partIndex  .setValues(0, static_cast<int>(data.partIndex.size()), data.partIndex.data());
+        faceset ->partIndex  .setNum(static_cast<int>(data.partIndex.size()));
+        lineset ->coordIndex .setValues(0, static_cast<int>(data.lineIndex.size()), data.lineIndex.data());
+        lineset ->coordIndex .setNum(static_cast<int>(data.lineIndex.size()));
+        nodeset ->startIndex .setValue(data.nodeStartIndex);
+    }
+
     VisualTouched = false;
 
     // The material has to be checked again
@@ -1294,6 +1419,109 @@ void ViewProviderPartExt::updateVisual()
     setHighlightedPoints(PointColorArray.getValue());
 }
 
+bool ViewProviderPartExt::isTessellationInBackground() const
+{
+    ParameterGrp::handle hPart = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part");
+    return hPart->GetBool("TessellationInBackground", false);
+}
+
+void ViewProviderPartExt::startTessellation(const TopoDS_Shape& shape, const TessellationParams& params)
+{
+    auto job = std::make_unique<TessellationJob>();
+    // The meshing stores the triangulation in the faces, which are shared with the document
+    // object, other view providers and the shape tessellated in the main thread. So, the worker
+    // meshes a copy of the topology. It is made here because the main thread may mesh the
+    // shape in the meantime. The geometry itself is only read and needn't be copied, an
+    // existing triangulation is kept so that it can be reused.
+    job->shape = BRepBuilderAPI_Copy(shape, Standard_False, Standard_True).Shape();
+    job->source = shape;
+    job->params = params;
+
+    // Only one job per view provider runs at a time. The pending job is
+    // started once the running (and already canceled) job has finished.
+    if (tessJob && tessJob->watcher->isRunning()) {
+        pendingJob = std::move(job);
+        return;
+    }
+
+    tessJob = std::move(job);
+    runTessellation();
+}
+
+void ViewProviderPartExt::runTessellation()
+{
+    TessellationJob* job = tessJob.get();
+    job->watcher = new QFutureWatcher<void>();
+    QObject::connect(job->watcher, &QFutureWatcherBase::finished, job->watcher, [this, job]() {
+        onTessellationFinished(job);
+    });
+
+    job->watcher->setFuture(QtConcurrent::run([job]() {
+        try {
+            buildVisual(job->shape, job->params, job->data, &job->canceled);
+        }
+        catch (const Standard_Failure& e) {
+            job->data.error = e.GetMessageString();
+        }
+        catch (...) {
+            job->data.error = "Unknown exception";
+        }
+    }));
+}
+
+void ViewProviderPartExt::onTessellationFinished(TessellationJob* job)
+{
+    if (job != tessJob.get()) {
+        return;
+    }
+
+    // The watcher must not be destroyed within its own signal
+    std::unique_ptr<TessellationJob> done = std::move(tessJob);
+    done->watcher->disconnect();
+    done->watcher->deleteLater();
+    done->watcher = nullptr;
+
+    // The scene graph is only modified in the main thread. The colors that were
+    // changed in the meantime are applied together with the new nodes.
+    if (!done->canceled && !pendingJob) {
+        applyVisual(done->data);
+        checkFaceBinding();
+
+        // Like a tessellation in the main thread leave the triangulation on the
+        // shape, so that it's reused and saved with the document
+        if (done->data.valid) {
+            try {
+                Part::Tools::copyTriangulation(done->shape, done->source);
+            }
+            catch (const Standard_Failure& e) {
+                FC_WARN("Cannot keep the triangulation of " << pcObject->getFullName()
+                        << ": " << e.GetMessageString());
+            }
+        }
+    }
+
+    if (pendingJob) {
+        tessJob = std::move(pendingJob);
+        runTessellation();
+    }
+}
+
+bool ViewProviderPartExt::isTessellationPending() const
+{
+    return tessJob || pendingJob;
+}
+
+void ViewProviderPartExt::cancelTessellation()
+{
+    pendingJob.reset();
+    if (tessJob) {
+        tessJob->canceled = true;
+        tessJob->watcher->waitForFinished();
+        tessJob.reset();
+    }
+}
+
 void ViewProviderPartExt::forceUpdate(bool enable) {
     if(enable) {
         if(++forceUpdateCount == 1) {
@@ -24,6 +24,7 @@
 #define PARTGUI_VIEWPROVIDERPARTEXT_H
 
 #include <map>
+#include <memory>
 
 #include <App/PropertyUnits.h>
 #include <Gui/ViewProviderGeometryObject.h>
@@ -58,6 +59,9 @@ namespace PartGui {
 class SoBrepFaceSet;
 class SoBrepEdgeSet;
 class SoBrepPointSet;
+class TessellationJob;
+struct TessellationParams;
+struct VisualData;
 
 class PartGuiExport ViewProviderPartExt : public Gui::ViewProviderGeometryObject
 {
@@ -155,6 +159,8 @@ protected:
     void onChanged(const App::Property* prop) override;
     bool loadParameter();
     void updateVisual();
+    /// Fill up the Inventor nodes with the tessellation data
+    void applyVisual(const VisualData&);
 
     // nodes for the data representation
     SoMaterialBinding * pcFaceBind;
@@ -177,6 +183,22 @@ protected:
     bool NormalsFromUV;
 
 private:
+    /** @name Background tessellation */
+    //@{
+    bool isTessellationInBackground() const;
+    void startTessellation(const TopoDS_Shape&, const TessellationParams&);
+    void runTessellation();
+    void onTessellationFinished(TessellationJob*);
+    void cancelTessellation();
+    /// The nodes don't show the current shape until the running job has finished
+    bool isTessellationPending() const;
+    /// Fall back to one color if there are fewer colors than faces
+    void checkFaceBinding();
+    //@}
+
+private:
+    std::unique_ptr<TessellationJob> tessJob;
+    std::unique_ptr<TessellationJob> pendingJob;
     // settings stuff
     int forceUpdateCount;
     static App::PropertyFloatConstraint::Constraints sizeRange;
@@ -45,6 +45,7 @@ def findDockWidget(name):
 """
 from parttests.ColorPerFaceTest import ColorPerFaceTest
 from parttests.ColorTransparencyTest import ColorTransparencyTest
+from parttests.TessellationInBackgroundTest import TessellationInBackgroundTest
 
 
 #class PartGuiTestCases(unittest.TestCase):
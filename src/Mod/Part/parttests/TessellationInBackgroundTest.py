@@ -0,0 +1,98 @@
+import time
+import unittest
+
+import FreeCAD as App
+import FreeCADGui as Gui
+from pivy import coin
+
+
+class TessellationInBackgroundTest(unittest.TestCase):
+
+    def setUp(self):
+        self._doc = App.newDocument()
+        self._pg = App.ParamGet('User parameter:BaseApp/Preferences/Mod/Part')
+        self._backup_background = self._pg.GetBool('TessellationInBackground', False)
+        self._pg.SetBool('TessellationInBackground', True)
+
+    def tearDown(self):
+        App.closeDocument(self._doc.Name)
+        self._pg.SetBool('TessellationInBackground', self._backup_background)
+
+    def getCoordinates(self, obj):
+        sa = coin.SoSearchAction()
+        sa.setType(coin.SoCoordinate3.getClassTypeId())
+        sa.setInterest(coin.SoSearchAction.FIRST)
+        sa.apply(obj.ViewObject.RootNode)
+        return sa.getPath().getTail()
+
+    def getMaterial(self, obj):
+        sa = coin.SoSearchAction()
+        sa.setType(coin.SoMaterial.getClassTypeId())
+        sa.setInterest(coin.SoSearchAction.ALL)
+        sa.apply(obj.ViewObject.RootNode)
+        return sa.getPaths().get(2).getTail()
+
+    def maxX(self, obj):
+        points = self.getCoordinates(obj).point.getValues()
+        return max([p[0] for p in points]) if points else None
+
+    def waitFor(self, condition, timeout=10.0):
+        end = time.time() + timeout
+        while not condition():
+            if time.time() > end:
+                return False
+            Gui.updateGui()
+            time.sleep(0.01)
+        return True
+
+    def testNewShapeWhileRunning(self):
+        box = self._doc.addObject('Part::Box', 'Box')
+        self._doc.recompute()
+        # the first job is still running or queued when the shape changes again
+        box.Length = 20
+        self._doc.recompute()
+        self.assertTrue(self.waitFor(lambda: self.maxX(box) is not None
+                                     and abs(self.maxX(box) - 20.0) < 1e-5))
+
+        # no older result overwrites the nodes afterwards
+        for i in range(20):
+            Gui.updateGui()
+        self.assertAlmostEqual(self.maxX(box), 20.0, places=5)
+
+    def testColorsWhileRunning(self):
+        box = self._doc.addObject('Part::Box', 'Box')
+        self._doc.recompute()
+        self.assertTrue(self.waitFor(lambda: self.maxX(box) is not None))
+
+        # the colors refer to the new shape and are applied once it's tessellated
+        cyl = self._doc.addObject('Part::Cylinder', 'Cylinder')
+        self._doc.recompute()
+        box.Shape = cyl.Shape
+        box.ViewObject.DiffuseColor = [(1., 0., 0., 0.), (0., 1., 0., 0.), (0., 0., 1., 0.)]
+        self.assertTrue(self.waitFor(lambda: self.getMaterial(box).diffuseColor.getNum() == 3))
+        self.assertEqual(len(box.ViewObject.DiffuseColor), 3)
+
+    def testCancelBySynchronousUpdate(self):
+        box = self._doc.addObject('Part::Box', 'Box')
+        self._doc.recompute()
+        box.Length = 20
+        self._doc.recompute()
+
+        # a synchronous update cancels the job in the background
+        self._pg.SetBool('TessellationInBackground', False)
+        box.Length = 30
+        self._doc.recompute()
+        self.assertAlmostEqual(self.maxX(box), 30.0, places=5)
+        for i in range(20):
+            Gui.updateGui()
+        self.assertAlmostEqual(self.maxX(box), 30.0, places=5)
+
+    def testDeleteWhileRunning(self):
+        sphere = self._doc.addObject('Part::Sphere', 'Sphere')
+        sphere.ViewObject.Deviation = 0.01
+        self._doc.recompute()
+        # the view provider waits for its job when it's destroyed
+        self._doc.removeObject(sphere.Name)
+        for i in range(20):
+            Gui.updateGui()
+        self.assertEqual(len(self._doc.Objects), 0)
@@ -31,6 +31,7 @@
 # include <BRepBuilderAPI_Transform.hxx>
 # include <Precision.hxx>
 # include <TopExp_Explorer.hxx>
+# include <TopoDS_Iterator.hxx>
 #endif
 
 #include <App/Application.h>
@@ -243,11 +244,65 @@ App::DocumentObjectExecReturn *Transformed::execute()
         return shapeTools;
     };
 
-    // NOTE: It would be possible to build a compound from all original addShapes/subShapes and then
-    // transform the compounds as a whole. But we choose to apply the transformations to each
-    // Original separately. This way it is easier to discover what feature causes a fuse/cut
-    // to fail. The downside is that performance suffers when there are many originals. But it seems
-    // safe to assume that in most cases there are few originals and many transformations
+    // In single pass mode consecutive operations of the same kind are merged into one boolean
+    // with all transformed instances as tools. This gives the same result because fusing
+    // (cutting) the tools one after another is the same as fusing (cutting) all of them at once.
+    bool singlePass = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/PartDesign")->GetBool("SinglePassPatterns", true);
+
+    // The tools of each original are kept apart so that the original causing a failed
+    // boolean can be reported
+    struct BooleanStep
+    {
+        bool fuse;
+        TopTools_ListOfShape tools;
+        std::vector<std::pair<App::DocumentObject*, TopTools_ListOfShape>> originalTools;
+    };
+    std::vector<BooleanStep> steps;
+    auto addStep = [&](bool fuse, App::DocumentObject* original, const TopTools_ListOfShape& tools)
+    {
+        if (tools.IsEmpty())
+            return;
+        if (!singlePass || steps.empty() || steps.back().fuse != fuse)
+            steps.push_back({fuse, {}, {}});
+        for (const auto& tool : tools)
+            steps.back().tools.Append(tool);
+        steps.back().originalTools.emplace_back(original, tools);
+    };
+
+    auto runBoolean = [](const TopoDS_Shape& argument, bool fuse, const TopTools_ListOfShape& tools,
+                         bool parallel, TopoDS_Shape& result)
+    {
+        TopTools_ListOfShape shapeArguments;
+        shapeArguments.Append(argument);
+        std::unique_ptr<BRepAlgoAPI_BooleanOperation> mkBool;
+        if (fuse)
+            mkBool = std::make_unique<BRepAlgoAPI_Fuse>();
+        else
+            mkBool = std::make_unique<BRepAlgoAPI_Cut>();
+        mkBool->SetArguments(shapeArguments);
+        mkBool->SetTools(tools);
+        mkBool->SetRunParallel(parallel);
+        mkBool->Build();
+        if (!mkBool->IsDone())
+            return false;
+        result = mkBool->Shape();
+        return true;
+    };
+
+    auto booleanFailed = [this](App::DocumentObject* original)
+    {
+        if (original && original->isAttachedToDocument())
+            Base::Console().Warning("%s: Boolean operation failed on original '%s'\n",
+                                    getFullLabel().c_str(), original->Label.getValue());
+        return new App::DocumentObjectExecReturn(
+            QT_TRANSLATE_NOOP("Exception", "Boolean operation failed"), original);
+    };
+
+    // NOTE: The transformations are applied to each Original separately. In single pass mode the
+    // transformed instances of consecutive originals of the same kind are then fused or cut in one
+    // boolean. If that boolean fails, the originals are applied one after another to find out
+    // which one causes the failure.
     for (auto original : originals)
     {
         // Extract the original shape and determine whether to cut or to fuse
@@ -269,39 +324,62 @@ App::DocumentObjectExecReturn *Transformed::execute()
             return new App::DocumentObjectExecReturn(QT_TRANSLATE_NOOP("Exception", "Only additive and subtractive features can be transformed"));
         }
 
-        TopoDS_Shape current = support;
-        if (!fuseShape.isNull()) {
-            TopTools_ListOfShape shapeArguments;
-            shapeArguments.Append(current);
-            TopTools_ListOfShape shapeTools = getTransformedCompShape(fuseShape.getShape());
-            if (!shapeTools.IsEmpty()) {
-                std::unique_ptr<BRepAlgoAPI_BooleanOperation> mkBool(new BRepAlgoAPI_Fuse());
-                mkBool->SetArguments(shapeArguments);
-                mkBool->SetTools(shapeTools);
-                mkBool->Build();
-                if (!mkBool->IsDone()) {
-                    return new App::DocumentObjectExecReturn(QT_TRANSLATE_NOOP("Exception", "Boolean operation failed"));
-                }
-                current = mkBool->Shape();
+        if (!fuseShape.isNull())
+            addStep(true, original, getTransformedCompShape(fuseShape.getShape()));
+        if (!cutShape.isNull())
+            addStep(false, original, getTransformedCompShape(cutShape.getShape()));
+    }
+
+    for (const auto& step : steps)
+    {
+        TopTools_ListOfShape shapeTools;
+        if (singlePass) {
+            std::vector<TopoDS_Shape> tools;
+            if (step.fuse) {
+                tools.assign(step.tools.cbegin(), step.tools.cend());
             }
-        }
-        if (!cutShape.isNull()) {
-            TopTools_ListOfShape shapeArguments;
-            shapeArguments.Append(current);
-            TopTools_ListOfShape shapeTools = getTransformedCompShape(cutShape.getShape());
-            if (!shapeTools.IsEmpty()) {
-                std::unique_ptr<BRepAlgoAPI_BooleanOperation> mkBool(new BRepAlgoAPI_Cut());
-                mkBool->SetArguments(shapeArguments);
-                mkBool->SetTools(shapeTools);
-                mkBool->Build();
-                if (!mkBool->IsDone()) {
-                    return new App::DocumentObjectExecReturn(QT_TRANSLATE_NOOP("Exception", "Boolean operation failed"));
+            else {
+                // instances that don't overlap the support cannot change the result of a cut
+                Bnd_Box supportBound;
+                BRepBndLib::Add(support, supportBound);
+                for (const auto& tool : step.tools) {
+                    Bnd_Box bound;
+                    BRepBndLib::Add(tool, bound);
+                    if (!bound.IsOut(supportBound))
+                        tools.push_back(tool);
                 }
-                current = mkBool->Shape();
             }
+
+            // Non-overlapping instances are passed as one compound because the boolean
+            // doesn't intersect the sub-shapes of an argument with each other
+            std::vector<TopoDS_Shape> individuals;
+            TopoDS_Compound compound;
+            divideTools(tools, individuals, compound);
+            for (const auto& tool : individuals)
+                shapeTools.Append(tool);
+            if (TopoDS_Iterator(compound).More())
+                shapeTools.Append(compound);
         }
+        else {
+            shapeTools = step.tools;
+        }
+        if (shapeTools.IsEmpty())
+            continue;
 
-        support = current; // Use result of this operation for fuse/cut of next original
+        TopoDS_Shape result;
+        if (runBoolean(support, step.fuse, shapeTools, singlePass, result)) {
+            support = result; // Use result of this operation for the next fuse/cut
+            continue;
+        }
+        if (step.originalTools.size() == 1)
+            return booleanFailed(step.originalTools.front().first);
+
+        // Apply the originals of the merged step one by one to find the failing one
+        for (const auto& originalTools : step.originalTools) {
+            if (!runBoolean(support, step.fuse, originalTools.second, false, result))
+                return booleanFailed(originalTools.first);
+            support = result;
+        }
     }
 
     support = refineShapeIfActive(support);
@@ -339,55 +417,62 @@ TopoDS_Shape Transformed::refineShapeIfActive(const TopoDS_Shape& oldShape) cons
 void Transformed::divideTools(const std::vector<TopoDS_Shape> &toolsIn, std::vector<TopoDS_Shape> &individualsOut,
                               TopoDS_Compound &compoundOut) const
 {
-    using ShapeBoundPair = std::pair<TopoDS_Shape, Bnd_Box>;
-    using PairList = std::list<ShapeBoundPair>;
-    using PairVector = std::vector<ShapeBoundPair>;
-
-    PairList pairList;
-
-    std::vector<TopoDS_Shape>::const_iterator it;
-    for (it = toolsIn.begin(); it != toolsIn.end(); ++it) {
-        Bnd_Box bound;
-        BRepBndLib::Add(*it, bound);
-        bound.SetGap(0.0);
-        ShapeBoundPair temp = std::make_pair(*it, bound);
-        pairList.push_back(temp);
+    std::size_t count = toolsIn.size();
+    std::vector<Bnd_Box> bounds(count);
+    std::vector<std::size_t> order;
+    order.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        BRepBndLib::Add(toolsIn[i], bounds[i]);
+        bounds[i].SetGap(0.0);
+        if (!bounds[i].IsVoid())
+            order.push_back(i);
     }
 
-    BRep_Builder builder;
-    builder.MakeCompound(compoundOut);
+    // Sweep over the boxes sorted by their minimum x value so that only boxes that overlap
+    // in x must be checked against each other. Overlapping shapes are joined to groups.
+    std::sort(order.begin(), order.end(), [&bounds](std::size_t a, std::size_t b) {
+        return bounds[a].CornerMin().X() < bounds[b].CornerMin().X();
+    });
+
+    std::vector<std::size_t> group(count);
+    for (std::size_t i = 0; i < count; ++i)
+        group[i] = i;
+    auto findGroup = [&group](std::size_t i) {
+        while (group[i] != i) {
+            group[i] = group[group[i]];
+            i = group[i];
+        }
+        return i;
+    };
 
-    while(!pairList.empty()) {
-        PairVector currentGroup;
-        currentGroup.push_back(pairList.front());
-        pairList.pop_front();
-        PairList::iterator it = pairList.begin();
-        while(it != pairList.end()) {
-            PairVector::const_iterator groupIt;
-            bool found(false);
-            for (groupIt = currentGroup.begin(); groupIt != currentGroup.end(); ++groupIt) {
-                if (!(*it).second.IsOut((*groupIt).second)) {//touching means is out.
-                    found = true;
-                    break;
-                }
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        const Bnd_Box& bound = bounds[order[k]];
+        double maxX = bound.CornerMax().X();
+        for (std::size_t m = k + 1; m < order.size(); ++m) {
+            const Bnd_Box& other = bounds[order[m]];
+            if (other.CornerMin().X() > maxX)
+                break;
+            if (!bound.IsOut(other)) {//touching means is out.
+                std::size_t groupA = findGroup(order[k]);
+                std::size_t groupB = findGroup(order[m]);
+                if (groupA != groupB)
+                    group[std::max(groupA, groupB)] = std::min(groupA, groupB);
             }
-            if (found) {
-                currentGroup.push_back(*it);
-                pairList.erase(it);
-                it=pairList.begin();
-                continue;
-            }
-            ++it;
         }
+    }
 
-        if (currentGroup.size() == 1) {
-            builder.Add(compoundOut, currentGroup.front().first);
-        }
-        else {
-            PairVector::const_iterator groupIt;
-            for (groupIt = currentGroup.begin(); groupIt != currentGroup.end(); ++groupIt)
-                individualsOut.push_back((*groupIt).first);
-        }
+    std::vector<std::size_t> groupSize(count, 0);
+    for (std::size_t i = 0; i < count; ++i)
+        groupSize[findGroup(i)]++;
+
+    BRep_Builder builder;
+    builder.MakeCompound(compoundOut);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if (groupSize[findGroup(i)] == 1)
+            builder.Add(compoundOut, toolsIn[i]);
+        else
+            individualsOut.push_back(toolsIn[i]);
     }
 }
 
@@ -19,6 +19,7 @@
 #*                                                                         *
 #***************************************************************************
 
+import math
 import unittest
 
 import FreeCAD
@@ -139,6 +140,48 @@ class TestPolarPattern(unittest.TestCase):
         self.Doc.recompute()
         self.assertAlmostEqual(self.PolarPattern.Shape.Volume, 4000)
 
+    def testSinglePassMatchesPerOriginal(self):
+        # fuse and cut the instances of several originals in one boolean and one after another
+        self.Body = self.Doc.addObject('PartDesign::Body','Body')
+        self.Box = self.Doc.addObject('PartDesign::AdditiveBox','Box')
+        self.Body.addObject(self.Box)
+        self.Box.Length=10.00
+        self.Box.Width=10.00
+        self.Box.Height=10.00
+        self.Box.Placement.Base = FreeCAD.Vector(-5, -5, 0)
+        self.Pin = self.Doc.addObject('PartDesign::AdditiveCylinder','Pin')
+        self.Body.addObject(self.Pin)
+        self.Pin.Radius = 2
+        self.Pin.Height = 10
+        self.Pin.Placement.Base = FreeCAD.Vector(15, 0, 0)
+        self.Hole = self.Doc.addObject('PartDesign::SubtractiveCylinder','Hole')
+        self.Body.addObject(self.Hole)
+        self.Hole.Radius = 1
+        self.Hole.Height = 10
+        self.Hole.Placement.Base = FreeCAD.Vector(3, 0, 0)
+        self.Doc.recompute()
+        self.PolarPattern = self.Doc.addObject("PartDesign::PolarPattern","PolarPattern")
+        self.PolarPattern.Originals = [self.Pin, self.Hole]
+        self.PolarPattern.Axis = (self.Doc.Z_Axis,[""])
+        self.PolarPattern.Angle = 360
+        self.PolarPattern.Occurrences = 4
+        self.Body.addObject(self.PolarPattern)
+
+        params = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/PartDesign")
+        singlePass = params.GetBool("SinglePassPatterns", True)
+        volumes = []
+        try:
+            for mode in (True, False):
+                params.SetBool("SinglePassPatterns", mode)
+                self.PolarPattern.touch()
+                self.Doc.recompute()
+                self.assertTrue(self.PolarPattern.isValid())
+                volumes.append(self.PolarPattern.Shape.Volume)
+        finally:
+            params.SetBool("SinglePassPatterns", singlePass)
+        self.assertAlmostEqual(volumes[0], volumes[1], places=3)
+        self.assertAlmostEqual(volumes[0], 1000 + 4 * math.pi * 40 - 4 * math.pi * 10, places=3)
+
     def tearDown(self):
         #closing doc
         FreeCAD.closeDocument("PartDesignTestPolarPattern")
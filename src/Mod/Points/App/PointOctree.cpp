@@ -0,0 +1,234 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#endif
+
+#include "PointOctree.h"
+
+
+using namespace Points;
+
+namespace
+{
+// Limits the depth for clouds with many coincident points
+constexpr int maxLevel = 21;
+
+bool isValid(const Base::Vector3f& pnt)
+{
+    return !(std::isnan(pnt.x) || std::isnan(pnt.y) || std::isnan(pnt.z));
+}
+}  // namespace
+
+bool PointOctree::Node::isLeaf() const
+{
+    return std::all_of(children.begin(), children.end(), [](int child) {
+        return child < 0;
+    });
+}
+
+PointOctree::PointOctree(std::size_t sampleSize)
+    : sampleSize(std::max<std::size_t>(sampleSize, 1))
+{}
+
+void PointOctree::clear()
+{
+    numValid = 0;
+    nodes.clear();
+    order.clear();
+}
+
+bool PointOctree::empty() const
+{
+    return nodes.empty();
+}
+
+std::size_t PointOctree::getSampleSize() const
+{
+    return sampleSize;
+}
+
+const std::vector<PointOctree::Node>& PointOctree::getNodes() const
+{
+    return nodes;
+}
+
+const std::vector<std::size_t>& PointOctree::getOrder() const
+{
+    return order;
+}
+
+std::size_t PointOctree::countValidPoints() const
+{
+    return numValid;
+}
+
+void PointOctree::build(const PointKernel& kernel)
+{
+    clear();
+
+    const std::vector<PointKernel::value_type>& points = kernel.getBasicPoints();
+    std::vector<std::size_t> work;
+    std::vector<std::size_t> invalid;
+    work.reserve(points.size());
+    order.reserve(points.size());
+
+    Base::BoundBox3f bbox;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (isValid(points[i])) {
+            work.push_back(i);
+            bbox.Add(points[i]);
+        }
+        else {
+            invalid.push_back(i);
+        }
+    }
+
+    numValid = work.size();
+    if (!work.empty()) {
+        // the octants are cubes, the root is slightly enlarged to be safe against round-off
+        float length = std::max({bbox.LengthX(), bbox.LengthY(), bbox.LengthZ()});
+        if (length <= 0.0F) {
+            length = 1.0F;
+        }
+        length *= 1.0F + 1e-5F;
+
+        Node root;
+        root.box = Base::BoundBox3f(bbox.MinX,
+                                    bbox.MinY,
+                                    bbox.MinZ,
+                                    bbox.MinX + length,
+                                    bbox.MinY + length,
+                                    bbox.MinZ + length);
+        nodes.push_back(root);
+
+        // A node samples the first point of each cell of a regular grid over its octant
+        int grid = 1;
+        while (std::size_t(grid) * std::size_t(grid) * std::size_t(grid) < sampleSize) {
+            grid++;
+        }
+        std::vector<char> occupied(std::size_t(grid) * std::size_t(grid) * std::size_t(grid));
+        std::vector<std::size_t> scratch(work.size());
+
+        struct Task
+        {
+            int node;
+            std::size_t begin;
+            std::size_t end;
+        };
+        std::vector<Task> tasks;
+        tasks.push_back({0, 0, work.size()});
+
+        while (!tasks.empty()) {
+            Task task = tasks.back();
+            tasks.pop_back();
+
+            const Base::BoundBox3f box = nodes[task.node].box;
+            const int level = nodes[task.node].level;
+            nodes[task.node].first = order.size();
+
+            std::size_t numPoints = task.end - task.begin;
+            if (numPoints <= sampleSize || level >= maxLevel) {
+                order.insert(order.end(),
+                             work.begin() + std::ptrdiff_t(task.begin),
+                             work.begin() + std::ptrdiff_t(task.end));
+                nodes[task.node].count = numPoints;
+                continue;
+            }
+
+            // take the sample and move the remaining points to the front of the range
+            std::fill(occupied.begin(), occupied.end(), 0);
+            float scale = float(grid) / box.LengthX();
+            auto toCell = [grid, scale](float value, float minimum) {
+                return std::clamp(int((value - minimum) * scale), 0, grid - 1);
+            };
+
+            std::size_t rest = task.begin;
+            for (std::size_t i = task.begin; i < task.end; i++) {
+                const Base::Vector3f& pnt = points[work[i]];
+                std::size_t cell = (std::size_t(toCell(pnt.x, box.MinX)) * grid
+                                    + std::size_t(toCell(pnt.y, box.MinY)))
+                        * grid
+                    + std::size_t(toCell(pnt.z, box.MinZ));
+                if (!occupied[cell]) {
+                    occupied[cell] = 1;
+                    order.push_back(work[i]);
+                }
+                else {
+                    work[rest++] = work[i];
+                }
+            }
+            nodes[task.node].count = order.size() - nodes[task.node].first;
+
+            // distribute the remaining points over the octants
+            Base::Vector3f mid = box.GetCenter();
+            auto octant = [&mid](const Base::Vector3f& pnt) {
+                return (pnt.x >= mid.x ? 1 : 0) | (pnt.y >= mid.y ? 2 : 0)
+                    | (pnt.z >= mid.z ? 4 : 0);
+            };
+
+            std::array<std::size_t, 9> offset {};
+            for (std::size_t i = task.begin; i < rest; i++) {
+                offset[octant(points[work[i]]) + 1]++;
+            }
+            for (std::size_t i = 1; i < offset.size(); i++) {
+                offset[i] += offset[i - 1];
+            }
+
+            std::array<std::size_t, 8> pos {};
+            std::copy(offset.begin(), offset.begin() + 8, pos.begin());
+            for (std::size_t i = task.begin; i < rest; i++) {
+                scratch[task.begin + pos[octant(points[work[i]])]++] = work[i];
+            }
+            std::copy(scratch.begin() + std::ptrdiff_t(task.begin),
+                      scratch.begin() + std::ptrdiff_t(rest),
+                      work.begin() + std::ptrdiff_t(task.begin));
+
+            for (int i = 0; i < 8; i++) {
+                if (offset[i] == offset[i + 1]) {
+                    continue;
+                }
+
+                Node child;
+                child.level = level + 1;
+                child.box.MinX = (i & 1) ? mid.x : box.MinX;
+                child.box.MaxX = (i & 1) ? box.MaxX : mid.x;
+                child.box.MinY = (i & 2) ? mid.y : box.MinY;
+                child.box.MaxY = (i & 2) ? box.MaxY : mid.y;
+                child.box.MinZ = (i & 4) ? mid.z : box.MinZ;
+                child.box.MaxZ = (i & 4) ? box.MaxZ : mid.z;
+
+                int index = int(nodes.size());
+                nodes.push_back(child);
+                nodes[task.node].children[i] = index;
+                tasks.push_back({index, task.begin + offset[i], task.begin + offset[i + 1]});
+            }
+        }
+    }
+
+    order.insert(order.end(), invalid.begin(), invalid.end());
+}
@@ -0,0 +1,93 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef POINTS_POINTOCTREE_H
+#define POINTS_POINTOCTREE_H
+
+#include <array>
+#include <vector>
+
+#include <Base/BoundBox.h>
+
+#include "Points.h"
+
+
+namespace Points
+{
+
+/**
+ * The PointOctree class is a level-of-detail structure for large point clouds.
+ * Every node keeps a sample of at most getSampleSize() points that are evenly spread
+ * over its octant, the remaining points are passed on to the child nodes. So, drawing
+ * a node together with its ancestors gives a thinned-out version of the cloud inside
+ * the octant and a viewer only has to descend into the nodes that are large on screen.
+ *
+ * The points are not copied. Instead, getOrder() returns the point indices sorted node
+ * by node so that the sample of each node is a contiguous range.
+ */
+class PointsExport PointOctree
+{
+public:
+    struct Node
+    {
+        /// the cubic octant of the node
+        Base::BoundBox3f box;
+        /// first entry of the node's sample in getOrder()
+        std::size_t first {0};
+        /// number of sampled points
+        std::size_t count {0};
+        /// depth of the node, the root has level 0
+        int level {0};
+        /// indices of the child nodes or -1
+        std::array<int, 8> children {-1, -1, -1, -1, -1, -1, -1, -1};
+
+        bool isLeaf() const;
+    };
+
+    explicit PointOctree(std::size_t sampleSize = 4096);
+
+    /** Builds the octree for the points of \a kernel. Points with NaN coordinates
+     * are not part of any node and are moved to the end of getOrder(). */
+    void build(const PointKernel& kernel);
+    void clear();
+    bool empty() const;
+
+    std::size_t getSampleSize() const;
+    /// The nodes of the tree, the first node is the root
+    const std::vector<Node>& getNodes() const;
+    /// The point indices ordered by the nodes they belong to
+    const std::vector<std::size_t>& getOrder() const;
+    /// The number of points that are part of a node
+    std::size_t countValidPoints() const;
+
+private:
+    std::size_t sampleSize;
+    std::size_t numValid {0};
+    std::vector<Node> nodes;
+    std::vector<std::size_t> order;
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_POINTOCTREE_H
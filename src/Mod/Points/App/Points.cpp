@@ -52,7 +52,8 @@ PointKernel::PointKernel(const PointKernel& pts)
 
 PointKernel::PointKernel(PointKernel&& pts) noexcept
     : _Mtrx(pts._Mtrx)
-    , _Points(std::move(pts._Points))
+    // the memory of exported points must stay with their owner
+    , _Points(pts._exports.isExported() ? pts._Points : std::move(pts._Points))
 {}
 
 std::vector<const char*> PointKernel::getElementTypes() const
@@ -83,6 +84,7 @@ Data::Segment* PointKernel::getSubElement(const char* /*Type*/, unsigned long /*
 
 void PointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    _exports.check();
     std::vector<value_type>& kernel = getBasicPoints();
 #ifdef _MSC_VER
     // Win32-only at the moment since ppl.h is a Microsoft library. Points is not using Qt so we
@@ -129,6 +131,7 @@ Base::BoundBox3d PointKernel::getBoundBox() const
 PointKernel& PointKernel::operator=(const PointKernel& Kernel)
 {
     if (this != &Kernel) {
+        _exports.check();
         // copy the mesh structure
         setTransform(Kernel._Mtrx);
         this->_Points = Kernel._Points;
@@ -140,9 +143,15 @@ PointKernel& PointKernel::operator=(const PointKernel& Kernel)
 PointKernel& PointKernel::operator=(PointKernel&& Kernel) noexcept
 {
     if (this != &Kernel) {
-        // copy the mesh structure
+        // cannot throw here, so exported points are kept until their buffers are released
+        _exports.keepAlive(this->_Points);
         setTransform(Kernel._Mtrx);
-        this->_Points = std::move(Kernel._Points);
+        if (Kernel._exports.isExported()) {
+            this->_Points = Kernel._Points;
+        }
+        else {
+            this->_Points = std::move(Kernel._Points);
+        }
     }
 
     return *this;
@@ -193,9 +202,8 @@ void PointKernel::SaveDocFile(Base::Writer& writer) const
     uint32_t uCt = (uint32_t)size();
     str << uCt;
     // store the data without transforming it
-    for (const auto& pnt : _Points) {
-        str << pnt.x << pnt.y << pnt.z;
-    }
+    static_assert(sizeof(value_type) == 3 * sizeof(float), "Vector3f must not be padded");
+    str.write(reinterpret_cast<const float*>(_Points.data()), 3 * _Points.size());
 }
 
 void PointKernel::Restore(Base::XMLReader& reader)
@@ -220,14 +228,8 @@ void PointKernel::RestoreDocFile(Base::Reader& reader)
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
-    _Points.resize(uCt);
-    for (unsigned long i = 0; i < uCt; i++) {
-        float x {};
-        float y {};
-        float z {};
-        str >> x >> y >> z;
-        _Points[i].Set(x, y, z);
-    }
+    resize(uCt);
+    str.read(reinterpret_cast<float*>(_Points.data()), 3 * _Points.size());
 }
 
 void PointKernel::save(const char* file) const
@@ -29,6 +29,7 @@
 
 #include <App/ComplexGeoData.h>
 #include <App/PropertyGeo.h>
+#include <Base/BufferExports.h>
 #include <Base/Matrix.h>
 #include <Base/Reader.h>
 #include <Base/Vector3D.h>
@@ -94,12 +95,22 @@ public:
     }
     void setBasicPoints(const std::vector<value_type>& pts)
     {
+        _exports.check();
         this->_Points = pts;
     }
     void swap(std::vector<value_type>& pts)
     {
+        _exports.check();
         this->_Points.swap(pts);
     }
+    /** Counts the buffers exported from the points. The methods of this class
+     * that change the points throw as long as there is one, code that changes
+     * the points returned by getBasicPoints() must call check().
+     */
+    const Base::BufferExports& getBufferExports() const
+    {
+        return _exports;
+    }
 
     void getPoints(std::vector<Base::Vector3d>& Points,
                    std::vector<Base::Vector3d>& Normals,
@@ -125,6 +136,7 @@ public:
 private:
     Base::Matrix4D _Mtrx;
     std::vector<value_type> _Points;
+    Base::BufferExports _exports;
 
 public:
     /// number of points stored
@@ -136,19 +148,23 @@ public:
     std::vector<value_type> getValidPoints() const;
     void resize(size_type n)
     {
+        _exports.check();
         _Points.resize(n);
     }
     void reserve(size_type n)
     {
+        _exports.check();
         _Points.reserve(n);
     }
     inline void erase(size_type first, size_type last)
     {
+        _exports.check();
         _Points.erase(_Points.begin() + first, _Points.begin() + last);
     }
 
     void clear()
     {
+        _exports.check();
         _Points.clear();
     }
 
@@ -161,11 +177,13 @@ public:
     /// set the points
     inline void setPoint(const int idx, const Base::Vector3d& point)
     {
+        _exports.check();
         _Points[idx] = transformPointToInside(point);
     }
     /// insert the points
     inline void push_back(const Base::Vector3d& point)
     {
+        _exports.check();
         _Points.push_back(transformPointToInside(point));
     }
 
@@ -25,8 +25,12 @@
 #ifdef FC_OS_LINUX
 #include <unistd.h>
 #endif
+#include <algorithm>
+#include <cstring>
+#include <future>
 #include <memory>
 #include <sstream>
+#include <thread>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
@@ -211,7 +215,7 @@ public:
     Converter() = default;
     virtual ~Converter() = default;
     virtual std::string toString(double) const = 0;
-    virtual double toDouble(Base::InputStream&) const = 0;
+    virtual double toDouble(const char* ptr, bool swapByteOrder) const = 0;
     virtual int getSizeOf() const = 0;
 
     Converter(const Converter&) = delete;
@@ -232,10 +236,17 @@ public:
         oss << c;
         return oss.str();
     }
-    double toDouble(Base::InputStream& str) const override
+    double toDouble(const char* ptr, bool swapByteOrder) const override
     {
         T c;
-        str >> c;
+        if (swapByteOrder) {
+            char tmp[sizeof(T)];
+            std::reverse_copy(ptr, ptr + sizeof(T), tmp);
+            std::memcpy(&c, tmp, sizeof(T));
+        }
+        else {
+            std::memcpy(&c, ptr, sizeof(T));
+        }
         return static_cast<double>(c);
     }
     int getSizeOf() const override
@@ -246,89 +257,208 @@ public:
 
 using ConverterPtr = std::shared_ptr<Converter>;
 
-class DataStreambuf: public std::streambuf
+using RowBlock = Reader::RowBlock;
+using RowSink = Reader::RowSink;
+
+// The readers decode the records block-wise and directly pass them on to the
+// final arrays. So, only one block of values is kept in memory at any time.
+constexpr Eigen::Index blockRows = 65536;
+// Minimum number of ASCII records that are worth to be parsed in an own thread
+constexpr Eigen::Index minRowsPerThread = 4096;
+
+inline bool isFieldSeparator(char c)
 {
-public:
-    explicit DataStreambuf(const std::vector<char>& data)
-        : _buffer(data)
-        , _end(int(data.size()))
-    {}
-    ~DataStreambuf() override = default;
+    return c == ' ' || c == '\t' || c == '\r';
+}
 
-protected:
-    int_type uflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
+bool isBlankLine(const std::string& line)
+{
+    return std::all_of(line.begin(), line.end(), isFieldSeparator);
+}
 
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur++]) & 0x000000ff;
-    }
-    int_type underflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
+void parseAsciiRow(const std::string& line, Eigen::Index row, RowBlock& block)
+{
+    const char* it = line.data();
+    const char* end = it + line.size();
+    Eigen::Index numFields = block.cols();
+    Eigen::Index col = 0;
+    while (col < numFields) {
+        while (it != end && isFieldSeparator(*it)) {
+            ++it;
+        }
+        if (it == end) {
+            break;
         }
 
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur]) & 0x000000ff;
-    }
-    int_type pbackfail(int_type ch) override
-    {
-        if (_cur == _beg || (ch != traits_type::eof() && ch != _buffer[_cur - 1])) {
-            return traits_type::eof();
+        const char* token = it;
+        while (it != end && !isFieldSeparator(*it)) {
+            ++it;
         }
+        block(row, col++) = boost::lexical_cast<double>(token, std::size_t(it - token));
+    }
 
-        return static_cast<DataStreambuf::int_type>(_buffer[--_cur]) & 0x000000ff;
+    // missing values
+    for (; col < numFields; col++) {
+        block(row, col) = 0.0;
     }
-    std::streamsize showmanyc() override
-    {
-        return _end - _cur;
+}
+
+// Reads up to numPoints ASCII records after skipping the first skip non-blank lines.
+// The lines of a block are parsed on all cores and the rows are passed in file order.
+void readAsciiRows(std::istream& inp,
+                   std::size_t skip,
+                   Eigen::Index numPoints,
+                   Eigen::Index numFields,
+                   const RowSink& sink)
+{
+    if (numPoints <= 0) {
+        return;
     }
-    pos_type seekoff(std::streambuf::off_type off,
-                     std::ios_base::seekdir way,
-                     std::ios_base::openmode mode = std::ios::in | std::ios::out) override
-    {
-        (void)mode;
-        int p_pos = -1;
-        if (way == std::ios_base::beg) {
-            p_pos = _beg;
+
+    RowBlock block(std::min(blockRows, numPoints), numFields);
+    std::vector<std::string> lines(static_cast<std::size_t>(block.rows()));
+    Eigen::Index numThreads =
+        std::max<Eigen::Index>(1, static_cast<Eigen::Index>(std::thread::hardware_concurrency()));
+
+    std::string line;
+    Eigen::Index row = 0;
+    while (row < numPoints) {
+        Eigen::Index count = 0;
+        Eigen::Index needed = std::min(block.rows(), numPoints - row);
+        while (count < needed && std::getline(inp, line)) {
+            if (isBlankLine(line)) {
+                continue;
+            }
+            if (skip > 0) {
+                skip--;
+                continue;
+            }
+            lines[count++].swap(line);
+        }
+
+        if (count == 0) {
+            break;
         }
-        else if (way == std::ios_base::end) {
-            p_pos = _end;
+
+        Eigen::Index numTasks = std::min(numThreads, count / minRowsPerThread);
+        if (numTasks < 2) {
+            for (Eigen::Index i = 0; i < count; i++) {
+                parseAsciiRow(lines[i], i, block);
+            }
         }
-        else if (way == std::ios_base::cur) {
-            p_pos = _cur;
+        else {
+            // each task writes to its own rows of the block
+            Eigen::Index chunk = (count + numTasks - 1) / numTasks;
+            std::vector<std::future<void>> tasks;
+            for (Eigen::Index first = 0; first < count; first += chunk) {
+                Eigen::Index last = std::min(first + chunk, count);
+                tasks.push_back(std::async(std::launch::async, [&lines, &block, first, last]() {
+                    for (Eigen::Index i = first; i < last; i++) {
+                        parseAsciiRow(lines[i], i, block);
+                    }
+                }));
+            }
+            for (auto& it : tasks) {
+                it.get();
+            }
         }
 
-        if (p_pos > _end) {
-            return traits_type::eof();
+        sink(block, count);
+        row += count;
+    }
+}
+
+std::vector<std::size_t> fieldOffsets(const std::vector<ConverterPtr>& converters,
+                                      std::size_t& recordSize)
+{
+    std::vector<std::size_t> offsets;
+    offsets.reserve(converters.size());
+    recordSize = 0;
+    for (const auto& it : converters) {
+        offsets.push_back(recordSize);
+        recordSize += static_cast<std::size_t>(it->getSizeOf());
+    }
+    return offsets;
+}
+
+// Reads numPoints binary records of interleaved fields. The data is read in large
+// blocks instead of value by value.
+void readBinaryRows(std::istream& inp,
+                    bool swapByteOrder,
+                    const std::vector<ConverterPtr>& converters,
+                    Eigen::Index numPoints,
+                    const RowSink& sink)
+{
+    if (numPoints <= 0) {
+        return;
+    }
+
+    std::size_t recordSize {};
+    std::vector<std::size_t> offsets = fieldOffsets(converters, recordSize);
+    Eigen::Index numFields = Eigen::Index(converters.size());
+    RowBlock block(std::min(blockRows, numPoints), numFields);
+    std::vector<char> bytes(static_cast<std::size_t>(block.rows()) * recordSize);
+
+    Eigen::Index row = 0;
+    while (row < numPoints) {
+        Eigen::Index count = std::min(block.rows(), numPoints - row);
+        std::streamsize numBytes = static_cast<std::streamsize>(count) * recordSize;
+        inp.read(bytes.data(), numBytes);
+        if (inp.gcount() != numBytes) {
+            throw Base::BadFormatError("Unexpected end of file");
         }
 
-        if (((p_pos + off) > _end) || ((p_pos + off) < _beg)) {
-            return traits_type::eof();
+        for (Eigen::Index i = 0; i < count; i++) {
+            const char* record = bytes.data() + static_cast<std::size_t>(i) * recordSize;
+            for (Eigen::Index j = 0; j < numFields; j++) {
+                block(i, j) = converters[j]->toDouble(record + offsets[j], swapByteOrder);
+            }
         }
 
-        _cur = p_pos + off;
+        sink(block, count);
+        row += count;
+    }
+}
 
-        return ((p_pos + off) - _beg);
+// Decodes numPoints records from a buffer where the values are stored field by field
+void readColumnRows(const std::vector<char>& data,
+                    const std::vector<ConverterPtr>& converters,
+                    Eigen::Index numPoints,
+                    const RowSink& sink)
+{
+    if (numPoints <= 0) {
+        return;
     }
-    pos_type seekpos(std::streambuf::pos_type pos,
-                     std::ios_base::openmode which = std::ios::in | std::ios::out) override
-    {
-        (void)which;
-        return seekoff(pos, std::ios_base::beg);
+
+    std::size_t recordSize {};
+    std::vector<std::size_t> offsets = fieldOffsets(converters, recordSize);
+    if (data.size() < recordSize * static_cast<std::size_t>(numPoints)) {
+        throw Base::BadFormatError("File expects too many elements");
     }
 
-public:
-    DataStreambuf(const DataStreambuf&) = delete;
-    DataStreambuf(DataStreambuf&&) = delete;
-    DataStreambuf& operator=(const DataStreambuf&) = delete;
-    DataStreambuf& operator=(DataStreambuf&&) = delete;
+    // start of each field column
+    for (auto& it : offsets) {
+        it *= static_cast<std::size_t>(numPoints);
+    }
 
-private:
-    const std::vector<char>& _buffer;
-    int _beg {0}, _end {0}, _cur {0};
-};
+    Eigen::Index numFields = Eigen::Index(converters.size());
+    RowBlock block(std::min(blockRows, numPoints), numFields);
+
+    Eigen::Index row = 0;
+    while (row < numPoints) {
+        Eigen::Index count = std::min(block.rows(), numPoints - row);
+        for (Eigen::Index j = 0; j < numFields; j++) {
+            std::size_t size = static_cast<std::size_t>(converters[j]->getSizeOf());
+            const char* value = data.data() + offsets[j] + static_cast<std::size_t>(row) * size;
+            for (Eigen::Index i = 0; i < count; i++, value += size) {
+                block(i, j) = converters[j]->toDouble(value, false);
+            }
+        }
+
+        sink(block, count);
+        row += count;
+    }
+}
 
 // NOLINTBEGIN
 // Taken from https://github.com/PointCloudLibrary/pcl/blob/master/io/src/lzf.cpp
@@ -562,17 +692,6 @@ void PlyReader::read(const std::string& filename)
     this->width = numPoints;
     this->height = 1;
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, offset, data);
-    }
-    else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
-    }
-    else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
-    }
-
     std::vector<std::string>::iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
 
@@ -664,33 +783,47 @@ void PlyReader::read(const std::string& filename)
     bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (red != max_size && green != max_size && blue != max_size);
+    bool hasByteColor = hasColor && types[red] == "uchar";
+    bool hasFloatColor = hasColor && types[red] == "float";
 
     if (hasData) {
         points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
-        }
     }
-
     if (hasData && hasNormal) {
         normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
-        }
     }
-
     if (hasData && hasIntensity) {
         intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(static_cast<float>(data(i, greyvalue)));
-        }
     }
-
-    if (hasData && hasColor) {
+    if (hasData && (hasByteColor || hasFloatColor)) {
         colors.reserve(numPoints);
+    }
+
+    // transfer the data block by block
+    auto addRows = [&](const RowBlock& data, Eigen::Index rows) {
+        if (!hasData) {
+            return;
+        }
+
+        for (Eigen::Index i = 0; i < rows; i++) {
+            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+        }
+
+        if (hasNormal) {
+            for (Eigen::Index i = 0; i < rows; i++) {
+                normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+            }
+        }
+
+        if (hasIntensity) {
+            for (Eigen::Index i = 0; i < rows; i++) {
+                intensity.push_back(static_cast<float>(data(i, greyvalue)));
+            }
+        }
+
         float a = 1.0;
-        if (types[red] == "uchar") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
+        if (hasByteColor) {
+            for (Eigen::Index i = 0; i < rows; i++) {
                 float r = static_cast<float>(data(i, red));
                 float g = static_cast<float>(data(i, green));
                 float b = static_cast<float>(data(i, blue));
@@ -703,8 +836,8 @@ void PlyReader::read(const std::string& filename)
                                     static_cast<float>(a) / 255.0F);
             }
         }
-        else if (types[red] == "float") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
+        else if (hasFloatColor) {
+            for (Eigen::Index i = 0; i < rows; i++) {
                 float r = static_cast<float>(data(i, red));
                 float g = static_cast<float>(data(i, green));
                 float b = static_cast<float>(data(i, blue));
@@ -714,6 +847,17 @@ void PlyReader::read(const std::string& filename)
                 colors.emplace_back(r, g, b, a);
             }
         }
+    };
+
+    Eigen::Index numFields = Eigen::Index(fields.size());
+    if (format == "ascii") {
+        readAscii(inp, offset, numPoints, numFields, addRows);
+    }
+    else if (format == "binary_little_endian") {
+        readBinary(false, inp, offset, types, sizes, numPoints, addRows);
+    }
+    else if (format == "binary_big_endian") {
+        readBinary(true, inp, offset, types, sizes, numPoints, addRows);
     }
 }
 
@@ -887,37 +1031,13 @@ std::size_t PlyReader::readHeader(std::istream& in,
     return numPoints;
 }
 
-void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
+void PlyReader::readAscii(std::istream& inp,
+                          std::size_t offset,
+                          Eigen::Index numPoints,
+                          Eigen::Index numFields,
+                          const RowSink& sink)
 {
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = Eigen::Index(data.rows());
-    Eigen::Index numFields = Eigen::Index(data.cols());
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        if (offset > 0) {
-            offset--;
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
+    readAsciiRows(inp, offset, numPoints, numFields, sink);
 }
 
 void PlyReader::readBinary(bool swapByteOrder,
@@ -925,10 +1045,10 @@ void PlyReader::readBinary(bool swapByteOrder,
                            std::size_t offset,
                            const std::vector<std::string>& types,
                            const std::vector<int>& sizes,
-                           Eigen::MatrixXd& data)
+                           Eigen::Index numPoints,
+                           const RowSink& sink)
 {
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
+    Eigen::Index numFields = Eigen::Index(types.size());
 
     int neededSize = 0;
     ConverterPtr convert_float32(new ConverterT<float>);
@@ -1007,14 +1127,7 @@ void PlyReader::readBinary(bool swapByteOrder,
         }
     }
 
-    Base::InputStream str(inp);
-    str.setByteOrder(swapByteOrder ? Base::Stream::BigEndian : Base::Stream::LittleEndian);
-    for (Eigen::Index i = 0; i < numPoints; i++) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            double value = converters[j]->toDouble(str);
-            data(i, j) = value;
-        }
-    }
+    readBinaryRows(inp, swapByteOrder, converters, numPoints, sink);
 }
 
 // ----------------------------------------------------------------------------
@@ -1036,33 +1149,6 @@ void PcdReader::read(const std::string& filename)
     std::vector<int> sizes;
     Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, fields, types, sizes));
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, data);
-    }
-    else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
-    }
-    else if (format == "binary_compressed") {
-        unsigned int c {};
-        unsigned int u {};
-        Base::InputStream str(inp);
-        str >> c >> u;
-
-        std::vector<char> compressed(c);
-        inp.read(compressed.data(), c);
-        std::vector<char> uncompressed(u);
-        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
-            DataStreambuf ibuf(uncompressed);
-            std::istream istr(nullptr);
-            istr.rdbuf(&ibuf);
-            readBinary(true, istr, types, sizes, data);
-        }
-        else {
-            throw Base::BadFormatError("Failed to decompress binary data");
-        }
-    }
-
     std::vector<std::string>::iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
 
@@ -1139,42 +1225,56 @@ void PcdReader::read(const std::string& filename)
     bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (rgba != max_size);
+    bool hasPackedColor = hasColor && types[rgba] == "U";
+    bool hasFloatColor = hasColor && types[rgba] == "F";
 
     if (hasData) {
         points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
-        }
     }
-
     if (hasData && hasNormal) {
         normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
-        }
     }
-
     if (hasData && hasIntensity) {
         intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(data(i, greyvalue));
-        }
     }
-
-    if (hasData && hasColor) {
+    if (hasData && (hasPackedColor || hasFloatColor)) {
         colors.reserve(numPoints);
-        if (types[rgba] == "U") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
+    }
+
+    // transfer the data block by block
+    auto addRows = [&](const RowBlock& data, Eigen::Index rows) {
+        if (!hasData) {
+            return;
+        }
+
+        for (Eigen::Index i = 0; i < rows; i++) {
+            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+        }
+
+        if (hasNormal) {
+            for (Eigen::Index i = 0; i < rows; i++) {
+                normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+            }
+        }
+
+        if (hasIntensity) {
+            for (Eigen::Index i = 0; i < rows; i++) {
+                intensity.push_back(static_cast<float>(data(i, greyvalue)));
+            }
+        }
+
+        if (hasPackedColor) {
+            for (Eigen::Index i = 0; i < rows; i++) {
                 uint32_t packed = static_cast<uint32_t>(data(i, rgba));
                 App::Color col;
                 col.setPackedARGB(packed);
                 colors.emplace_back(col);
             }
         }
-        else if (types[rgba] == "F") {
+        else if (hasFloatColor) {
             static_assert(sizeof(float) == sizeof(uint32_t),
                           "float and uint32_t have different sizes");
-            for (Eigen::Index i = 0; i < numPoints; i++) {
+            for (Eigen::Index i = 0; i < rows; i++) {
                 float f = static_cast<float>(data(i, rgba));
                 uint32_t packed {};
                 std::memcpy(&packed, &f, sizeof(packed));
@@ -1183,6 +1283,32 @@ void PcdReader::read(const std::string& filename)
                 colors.emplace_back(col);
             }
         }
+    };
+
+    Eigen::Index numFields = Eigen::Index(fields.size());
+    if (format == "ascii") {
+        readAscii(inp, numPoints, numFields, addRows);
+    }
+    else if (format == "binary") {
+        readBinary(false, inp, types, sizes, numPoints, addRows);
+    }
+    else if (format == "binary_compressed") {
+        unsigned int c {};
+        unsigned int u {};
+        Base::InputStream str(inp);
+        str >> c >> u;
+
+        std::vector<char> compressed(c);
+        inp.read(compressed.data(), c);
+        std::vector<char> uncompressed(u);
+        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
+            compressed.clear();
+            compressed.shrink_to_fit();
+            readCompressed(uncompressed, types, sizes, numPoints, addRows);
+        }
+        else {
+            throw Base::BadFormatError("Failed to decompress binary data");
+        }
     }
 }
 
@@ -1257,44 +1383,19 @@ std::size_t PcdReader::readHeader(std::istream& in,
     return points;
 }
 
-void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
+void PcdReader::readAscii(std::istream& inp,
+                          Eigen::Index numPoints,
+                          Eigen::Index numFields,
+                          const RowSink& sink)
 {
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
+    readAsciiRows(inp, 0, numPoints, numFields, sink);
 }
 
-void PcdReader::readBinary(bool transpose,
-                           std::istream& inp,
-                           const std::vector<std::string>& types,
-                           const std::vector<int>& sizes,
-                           Eigen::MatrixXd& data)
+namespace
+{
+std::vector<ConverterPtr> getPcdConverters(const std::vector<std::string>& types,
+                                           const std::vector<int>& sizes)
 {
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-
-    int neededSize = 0;
     ConverterPtr convert_float32(new ConverterT<float>);
     ConverterPtr convert_float64(new ConverterT<double>);
     ConverterPtr convert_int8(new ConverterT<int8_t>);
@@ -1304,6 +1405,7 @@ void PcdReader::readBinary(bool transpose,
     ConverterPtr convert_int32(new ConverterT<int32_t>);
     ConverterPtr convert_uint32(new ConverterT<uint32_t>);
 
+    Eigen::Index numFields = Eigen::Index(types.size());
     std::vector<ConverterPtr> converters;
     for (Eigen::Index j = 0; j < numFields; j++) {
         char t = types[j][0];
@@ -1356,7 +1458,22 @@ void PcdReader::readBinary(bool transpose,
                 throw Base::BadFormatError("Unexpected type");
         }
 
-        neededSize += converters.back()->getSizeOf();
+    }
+
+    return converters;
+}
+}  // namespace
+
+void PcdReader::readBinary(std::istream& inp,
+                           const std::vector<std::string>& types,
+                           const std::vector<int>& sizes,
+                           Eigen::Index numPoints,
+                           const RowSink& sink)
+{
+    std::vector<ConverterPtr> converters = getPcdConverters(types, sizes);
+    int neededSize = 0;
+    for (const auto& it : converters) {
+        neededSize += it->getSizeOf();
     }
 
     std::streamoff ulSize = 0;
@@ -1371,23 +1488,18 @@ void PcdReader::readBinary(bool transpose,
         }
     }
 
-    Base::InputStream str(inp);
-    if (transpose) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
-    }
-    else {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            for (Eigen::Index j = 0; j < numFields; j++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
-    }
+    readBinaryRows(inp, false, converters, numPoints, sink);
+}
+
+void PcdReader::readCompressed(const std::vector<char>& data,
+                               const std::vector<std::string>& types,
+                               const std::vector<int>& sizes,
+                               Eigen::Index numPoints,
+                               const RowSink& sink)
+{
+    // the decompressed values are stored field by field
+    std::vector<ConverterPtr> converters = getPcdConverters(types, sizes);
+    readColumnRows(data, converters, numPoints, sink);
 }
 
 // ----------------------------------------------------------------------------
@@ -23,6 +23,7 @@
 #ifndef _PointsAlgos_h_
 #define _PointsAlgos_h_
 
+#include <functional>
 #include <Eigen/Core>
 
 #include "Points.h"
@@ -48,6 +49,11 @@ public:
 class PointsExport Reader
 {
 public:
+    /// A block of decoded records with one row per point and one column per field
+    using RowBlock = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    /// Takes over the first rows of a decoded block
+    using RowSink = std::function<void(const RowBlock&, Eigen::Index rows)>;
+
     Reader();
     virtual ~Reader();
     virtual void read(const std::string& filename) = 0;
@@ -101,13 +107,18 @@ private:
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
                            std::vector<int>& sizes);
-    void readAscii(std::istream&, std::size_t offset, Eigen::MatrixXd& data);
+    void readAscii(std::istream&,
+                   std::size_t offset,
+                   Eigen::Index numPoints,
+                   Eigen::Index numFields,
+                   const RowSink& sink);
     void readBinary(bool swapByteOrder,
                     std::istream&,
                     std::size_t offset,
                     const std::vector<std::string>& types,
                     const std::vector<int>& sizes,
-                    Eigen::MatrixXd& data);
+                    Eigen::Index numPoints,
+                    const RowSink& sink);
 };
 
 class PointsExport PcdReader: public Reader
@@ -122,12 +133,20 @@ private:
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
                            std::vector<int>& sizes);
-    void readAscii(std::istream&, Eigen::MatrixXd& data);
-    void readBinary(bool transpose,
-                    std::istream&,
+    void readAscii(std::istream&,
+                   Eigen::Index numPoints,
+                   Eigen::Index numFields,
+                   const RowSink& sink);
+    void readBinary(std::istream&,
                     const std::vector<std::string>& types,
                     const std::vector<int>& sizes,
-                    Eigen::MatrixXd& data);
+                    Eigen::Index numPoints,
+                    const RowSink& sink);
+    void readCompressed(const std::vector<char>& data,
+                        const std::vector<std::string>& types,
+                        const std::vector<int>& sizes,
+                        Eigen::Index numPoints,
+                        const RowSink& sink);
 };
 
 class PointsExport E57Reader: public Reader
@@ -28,6 +28,7 @@
 #include <Base/Builder3D.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/PyBufferView.h>
 #include <Base/VectorPy.h>
 
 #include "Points.h"
@@ -98,6 +99,31 @@ PyObject* PointsPy::copy(PyObject* args)
     return new PointsPy(kernel);
 }
 
+PyObject* PointsPy::getPointBuffer(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PointsPy* self = this;
+    return Base::PyBufferView::create(self, [self]() {
+        if (!self->isValid()) {
+            throw Base::RuntimeError("Points object is no longer valid");
+        }
+        PointKernel* kernel = self->getPointKernelPtr();
+        const std::vector<PointKernel::value_type>& points = kernel->getBasicPoints();
+        Base::BufferLayout layout =
+            Base::BufferLayout::rowsOf(points.empty() ? nullptr : &points.front().x,
+                                       points.size(),
+                                       3,
+                                       sizeof(PointKernel::value_type));
+        // keeps the points alive and unchanged while a buffer of them is exported
+        using PointsLock = std::pair<Base::Reference<PointKernel>, std::shared_ptr<void>>;
+        layout.storage = std::make_shared<PointsLock>(kernel, kernel->getBufferExports().lock());
+        return layout;
+    });
+}
+
 PyObject* PointsPy::read(PyObject* args)
 {
     const char* Name {};
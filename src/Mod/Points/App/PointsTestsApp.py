@@ -0,0 +1,63 @@
+# ***************************************************************************
+# *   Copyright (c) 2024 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This file is part of the FreeCAD CAx development system.              *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful,            *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Lesser General Public License for more details.                   *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with FreeCAD; if not, write to the Free Software        *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************/
+
+import unittest
+
+import FreeCAD
+import Points
+
+# ---------------------------------------------------------------------------
+# define the functions to test the FreeCAD points module
+# ---------------------------------------------------------------------------
+
+
+class PointsBufferCases(unittest.TestCase):
+    def setUp(self):
+        self.points = Points.Points()
+        self.points.addPoints([FreeCAD.Vector(i, 2 * i, 3 * i) for i in range(10)])
+
+    def testPointBuffer(self):
+        view = memoryview(self.points.getPointBuffer())
+        self.assertEqual(view.shape, (self.points.CountPoints, 3))
+        self.assertEqual(view.format, "f")
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.tolist(), [[i, 2 * i, 3 * i] for i in range(10)])
+
+    def testReadOnly(self):
+        with self.assertRaises(TypeError):
+            memoryview(self.points.getPointBuffer())[0, 0] = 1.0
+
+    def testModifiedPoints(self):
+        view = memoryview(self.points.getPointBuffer())
+        # the points cannot be modified while they are exported
+        with self.assertRaises(RuntimeError):
+            self.points.addPoints([FreeCAD.Vector(1, 1, 1)] * 1000)
+        self.assertEqual(view.shape, (10, 3))
+        self.assertEqual(view.tolist()[9], [9, 18, 27])
+        view.release()
+        self.points.addPoints([FreeCAD.Vector(1, 1, 1)] * 1000)
+        self.assertEqual(memoryview(self.points.getPointBuffer()).shape, (1010, 3))
+
+    def testEmpty(self):
+        view = memoryview(Points.Points().getPointBuffer())
+        self.assertEqual(view.shape, (0, 3))
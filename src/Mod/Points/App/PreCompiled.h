@@ -40,10 +40,13 @@
 // STL
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <set>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 // boost
@@ -150,9 +150,7 @@ void PropertyGreyValueList::SaveDocFile(Base::Writer& writer) const
     Base::OutputStream str(writer.Stream());
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
-    for (float it : _lValueList) {
-        str << it;
-    }
+    str.write(_lValueList.data(), _lValueList.size());
 }
 
 void PropertyGreyValueList::RestoreDocFile(Base::Reader& reader)
@@ -161,9 +159,7 @@ void PropertyGreyValueList::RestoreDocFile(Base::Reader& reader)
     uint32_t uCt = 0;
     str >> uCt;
     std::vector<float> values(uCt);
-    for (float& value : values) {
-        str >> value;
-    }
+    str.read(values.data(), values.size());
     setValues(values);
 }
 
@@ -322,9 +318,8 @@ void PropertyNormalList::SaveDocFile(Base::Writer& writer) const
     Base::OutputStream str(writer.Stream());
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
-    for (const auto& it : _lValueList) {
-        str << it.x << it.y << it.z;
-    }
+    static_assert(sizeof(Base::Vector3f) == 3 * sizeof(float), "Vector3f must not be padded");
+    str.write(reinterpret_cast<const float*>(_lValueList.data()), 3 * _lValueList.size());
 }
 
 void PropertyNormalList::RestoreDocFile(Base::Reader& reader)
@@ -333,9 +328,7 @@ void PropertyNormalList::RestoreDocFile(Base::Reader& reader)
     uint32_t uCt = 0;
     str >> uCt;
     std::vector<Base::Vector3f> values(uCt);
-    for (auto& value : values) {
-        str >> value.x >> value.y >> value.z;
-    }
+    str.read(reinterpret_cast<float*>(values.data()), 3 * values.size());
     setValues(values);
 }
 
@@ -597,13 +590,20 @@ void PropertyCurvatureList::SaveDocFile(Base::Writer& writer) const
     Base::OutputStream str(writer.Stream());
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
-    if (uCt > 0) {
-        for (const auto& it : _lValueList) {
-            str << it.fMaxCurvature << it.fMinCurvature;
-            str << it.cMaxCurvDir.x << it.cMaxCurvDir.y << it.cMaxCurvDir.z;
-            str << it.cMinCurvDir.x << it.cMinCurvDir.y << it.cMinCurvDir.z;
-        }
+    std::vector<float> data;
+    data.reserve(8 * _lValueList.size());
+    for (const auto& it : _lValueList) {
+        data.insert(data.end(),
+                    {it.fMaxCurvature,
+                     it.fMinCurvature,
+                     it.cMaxCurvDir.x,
+                     it.cMaxCurvDir.y,
+                     it.cMaxCurvDir.z,
+                     it.cMinCurvDir.x,
+                     it.cMinCurvDir.y,
+                     it.cMinCurvDir.z});
     }
+    str.write(data.data(), data.size());
 }
 
 void PropertyCurvatureList::RestoreDocFile(Base::Reader& reader)
@@ -611,11 +611,16 @@ void PropertyCurvatureList::RestoreDocFile(Base::Reader& reader)
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
+    std::vector<float> data(8 * std::size_t(uCt));
+    str.read(data.data(), data.size());
     std::vector<CurvatureInfo> values(uCt);
+    const float* it = data.data();
     for (auto& value : values) {
-        str >> value.fMaxCurvature >> value.fMinCurvature;
-        str >> value.cMaxCurvDir.x >> value.cMaxCurvDir.y >> value.cMaxCurvDir.z;
-        str >> value.cMinCurvDir.x >> value.cMinCurvDir.y >> value.cMinCurvDir.z;
+        value.fMaxCurvature = it[0];
+        value.fMinCurvature = it[1];
+        value.cMaxCurvDir.Set(it[2], it[3], it[4]);
+        value.cMinCurvDir.Set(it[5], it[6], it[7]);
+        it += 8;
     }
 
     setValues(values);
@@ -0,0 +1,82 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+import random
+import unittest
+
+import FreeCAD
+import FreeCADGui
+import Points
+
+# ---------------------------------------------------------------------------
+# The level of detail of large point clouds sorts the coordinates along an
+# octree. The picked and selected points must still refer to the indices of
+# the point kernel.
+# ---------------------------------------------------------------------------
+
+
+class PointsLevelOfDetailCases(unittest.TestCase):
+    def setUp(self):
+        self.param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Points")
+        self.threshold = self.param.GetInt("LevelOfDetailThreshold", -1)
+        self.param.SetInt("LevelOfDetailThreshold", 10)
+
+        # a planar grid in random order, so that the octree order differs from it
+        self.points = [FreeCAD.Vector(i, j, 0) for i in range(20) for j in range(20)]
+        random.Random(1).shuffle(self.points)
+
+        self.doc = FreeCAD.newDocument("PointsLevelOfDetail")
+        self.obj = self.doc.addObject("Points::Feature", "Points")
+        self.obj.Points = Points.Points(self.points)
+        self.doc.recompute()
+        self.view = FreeCADGui.getDocument(self.doc.Name).ActiveView
+        self.view.viewTop()
+        self.view.fitAll()
+        self.view.redraw()
+        FreeCADGui.updateGui()
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.doc.Name)
+        if self.threshold > 0:
+            self.param.SetInt("LevelOfDetailThreshold", self.threshold)
+        else:
+            self.param.RemInt("LevelOfDetailThreshold")
+
+    def coordinates(self):
+        from pivy import coin
+
+        search = coin.SoSearchAction()
+        search.setType(coin.SoCoordinate3.getClassTypeId())
+        search.apply(self.obj.ViewObject.RootNode)
+        return search.getPath().getTail().point
+
+    def testCoordinatesAreSorted(self):
+        coords = self.coordinates()
+        self.assertEqual(coords.getNum(), len(self.points))
+        moved = [i for i, p in enumerate(self.points) if FreeCAD.Vector(coords[i].getValue()) != p]
+        self.assertTrue(moved)
+
+    def testDetailOfElement(self):
+        from pivy import coin
+
+        coords = self.coordinates()
+        for index in (0, 57, 399):
+            path = coin.SoPath()
+            path.ref()
+            detail = self.obj.ViewObject.getDetailPath("Vertex{}".format(index + 1), path, True)
+            path.unref()
+            self.assertIsNotNone(detail)
+            detail = coin.cast(detail, "SoPointDetail")
+            coord = coords[detail.getCoordinateIndex()].getValue()
+            self.assertEqual(FreeCAD.Vector(coord), self.points[index])
+
+        path = coin.SoPath()
+        path.ref()
+        self.assertIsNone(self.obj.ViewObject.getDetailPath("Vertex401", path, True))
+        path.unref()
+
+    def testElementOfPickedPoint(self):
+        for index in (0, 57, 399):
+            pos = self.view.getPointOnScreen(self.points[index])
+            info = self.view.getObjectInfo(pos)
+            self.assertIsNotNone(info)
+            self.assertEqual(info["Component"], "Vertex{}".format(index + 1))
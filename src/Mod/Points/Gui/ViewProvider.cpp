@@ -23,26 +23,34 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <boost/math/special_functions/fpclassify.hpp>
+#include <algorithm>
 #include <limits>
+#include <sstream>
 
+#include <Inventor/details/SoPointDetail.h>
 #include <Inventor/errors/SoDebugError.h>
 #include <Inventor/events/SoMouseButtonEvent.h>
 #include <Inventor/nodes/SoCamera.h>
 #include <Inventor/nodes/SoCoordinate3.h>
 #include <Inventor/nodes/SoDrawStyle.h>
 #include <Inventor/nodes/SoIndexedPointSet.h>
+#include <Inventor/nodes/SoLevelOfDetail.h>
 #include <Inventor/nodes/SoMaterial.h>
 #include <Inventor/nodes/SoMaterialBinding.h>
 #include <Inventor/nodes/SoNormal.h>
 #include <Inventor/nodes/SoPointSet.h>
+#include <Inventor/nodes/SoSeparator.h>
 #endif
 
+#include <App/Application.h>
+#include <App/ComplexGeoData.h>
 #include <App/Document.h>
 #include <Base/Vector3D.h>
 #include <Gui/Application.h>
 #include <Gui/Document.h>
 #include <Gui/SoFCSelection.h>
 #include <Gui/View3DInventorViewer.h>
+#include <Mod/Points/App/PointOctree.h>
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/Properties.h>
 
@@ -118,9 +126,9 @@ void ViewProviderPoints::setVertexColorMode(App::PropertyColorList* pcProperty)
     pcColorMat->diffuseColor.setNum(val.size());
     SbColor* col = pcColorMat->diffuseColor.startEditing();
 
-    std::size_t i = 0;
-    for (const auto& it : val) {
-        col[i++].setValue(it.r, it.g, it.b);
+    for (std::size_t i = 0; i < val.size(); i++) {
+        const App::Color& it = val[getPointIndex(i)];
+        col[i].setValue(it.r, it.g, it.b);
     }
 
     pcColorMat->diffuseColor.finishEditing();
@@ -133,9 +141,9 @@ void ViewProviderPoints::setVertexGreyvalueMode(Points::PropertyGreyValueList* p
     pcColorMat->diffuseColor.setNum(val.size());
     SbColor* col = pcColorMat->diffuseColor.startEditing();
 
-    std::size_t i = 0;
-    for (float it : val) {
-        col[i++].setValue(it, it, it);
+    for (std::size_t i = 0; i < val.size(); i++) {
+        float it = val[getPointIndex(i)];
+        col[i].setValue(it, it, it);
     }
 
     pcColorMat->diffuseColor.finishEditing();
@@ -148,14 +156,57 @@ void ViewProviderPoints::setVertexNormalMode(Points::PropertyNormalList* pcPrope
     pcPointsNormal->vector.setNum(val.size());
     SbVec3f* norm = pcPointsNormal->vector.startEditing();
 
-    std::size_t i = 0;
-    for (const auto& it : val) {
-        norm[i++].setValue(it.x, it.y, it.z);
+    for (std::size_t i = 0; i < val.size(); i++) {
+        const Base::Vector3f& it = val[getPointIndex(i)];
+        norm[i].setValue(it.x, it.y, it.z);
     }
 
     pcPointsNormal->vector.finishEditing();
 }
 
+std::size_t ViewProviderPoints::getPointIndex(std::size_t index) const
+{
+    return pointOrder.empty() ? index : pointOrder[index];
+}
+
+std::string ViewProviderPoints::getElement(const SoDetail* detail) const
+{
+    std::stringstream str;
+    if (detail && detail->getTypeId() == SoPointDetail::getClassTypeId()) {
+        // the coordinate node may hold the points in the order of the level of detail
+        int index = static_cast<const SoPointDetail*>(detail)->getCoordinateIndex();
+        if (index >= 0 && index < pcPointsCoord->point.getNum()) {
+            str << "Vertex" << getPointIndex(static_cast<std::size_t>(index)) + 1;
+        }
+    }
+
+    return str.str();
+}
+
+SoDetail* ViewProviderPoints::getDetail(const char* subelement) const
+{
+    auto type = Data::ComplexGeoData::getTypeAndIndex(subelement);
+    if (type.first != "Vertex" || type.second == 0) {
+        return nullptr;
+    }
+
+    std::size_t index = type.second - 1;
+    if (!pointOrder.empty()) {
+        auto it = std::find(pointOrder.begin(), pointOrder.end(), index);
+        if (it == pointOrder.end()) {
+            return nullptr;
+        }
+        index = static_cast<std::size_t>(std::distance(pointOrder.begin(), it));
+    }
+    if (index >= static_cast<std::size_t>(pcPointsCoord->point.getNum())) {
+        return nullptr;
+    }
+
+    SoPointDetail* detail = new SoPointDetail();
+    detail->setCoordinateIndex(static_cast<int>(index));
+    return detail;
+}
+
 void ViewProviderPoints::setDisplayMode(const char* ModeName)
 {
     int numPoints = pcPointsCoord->point.getNum();
@@ -370,11 +421,14 @@ ViewProviderScattered::ViewProviderScattered()
 {
     pcPoints = new SoPointSet();
     pcPoints->ref();
+    pcPointsLOD = new SoGroup();
+    pcPointsLOD->ref();
 }
 
 ViewProviderScattered::~ViewProviderScattered()
 {
     pcPoints->unref();
+    pcPointsLOD->unref();
 }
 
 void ViewProviderScattered::attach(App::DocumentObject* pcObj)
@@ -388,7 +442,7 @@ void ViewProviderScattered::attach(App::DocumentObject* pcObj)
 
     // Highlight for selection
     pcHighlight->addChild(pcPointsCoord);
-    pcHighlight->addChild(pcPoints);
+    pcHighlight->addChild(pointOrder.empty() ? static_cast<SoNode*>(pcPoints) : pcPointsLOD);
 
     std::vector<std::string> modes = getDisplayModes();
 
@@ -427,8 +481,19 @@ void ViewProviderScattered::updateData(const App::Property* prop)
 {
     ViewProviderPoints::updateData(prop);
     if (prop->is<Points::PropertyPointKernel>()) {
-        ViewProviderPointsBuilder builder;
-        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        const Points::PointKernel& kernel =
+            static_cast<const Points::PropertyPointKernel*>(prop)->getValue();
+        if (useLevelOfDetail(kernel)) {
+            createLevelOfDetail(kernel);
+            showPoints(pcPointsLOD);
+        }
+        else {
+            pointOrder.clear();
+            pcPointsLOD->removeAllChildren();
+            ViewProviderPointsBuilder builder;
+            builder.createPoints(prop, pcPointsCoord, pcPoints);
+            showPoints(pcPoints);
+        }
 
         // The number of points might have changed, so force also a resize of the Inventor internals
         setActiveMode();
@@ -444,6 +509,86 @@ void ViewProviderScattered::updateData(const App::Property* prop)
     }
 }
 
+bool ViewProviderScattered::useLevelOfDetail(const Points::PointKernel& kernel) const
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Points");
+    long threshold = hGrp->GetInt("LevelOfDetailThreshold", 1000000);
+    return threshold > 0 && kernel.size() >= static_cast<std::size_t>(threshold);
+}
+
+void ViewProviderScattered::createLevelOfDetail(const Points::PointKernel& kernel)
+{
+    Points::PointOctree octree;
+    octree.build(kernel);
+    pointOrder = octree.getOrder();
+
+    // the coordinates are sorted so that each octree node refers to a contiguous range
+    const std::vector<Points::PointKernel::value_type>& points = kernel.getBasicPoints();
+    pcPointsCoord->point.setNum(static_cast<int>(pointOrder.size()));
+    SbVec3f* vec = pcPointsCoord->point.startEditing();
+    for (std::size_t i = 0; i < pointOrder.size(); i++) {
+        const Points::PointKernel::value_type& pnt = points[pointOrder[i]];
+        vec[i].setValue(pnt.x, pnt.y, pnt.z);
+    }
+    pcPointsCoord->point.finishEditing();
+
+    // The point budget refers to a full HD viewport. A node is refined as soon as the
+    // screen area of its points exceeds the area that the budget grants to its sample.
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Points");
+    long budget = std::max<long>(hGrp->GetInt("PointBudget", 2000000), 1);
+    const float referenceArea = 1920.0F * 1080.0F;
+    float areaPerPoint = referenceArea / static_cast<float>(budget);
+
+    pcPointsLOD->removeAllChildren();
+    if (!octree.empty()) {
+        pcPointsLOD->addChild(createLevelOfDetail(octree, 0, areaPerPoint));
+    }
+}
+
+SoNode* ViewProviderScattered::createLevelOfDetail(const Points::PointOctree& octree,
+                                                   int node,
+                                                   float areaPerPoint) const
+{
+    const Points::PointOctree::Node& data = octree.getNodes()[node];
+
+    // octants outside of the view volume are skipped
+    SoSeparator* sep = new SoSeparator();
+    sep->renderCulling = SoSeparator::ON;
+
+    SoPointSet* points = new SoPointSet();
+    points->startIndex = static_cast<int>(data.first);
+    points->numPoints = static_cast<int>(data.count);
+    sep->addChild(points);
+
+    if (!data.isLeaf()) {
+        SoGroup* children = new SoGroup();
+        for (int child : data.children) {
+            if (child >= 0) {
+                children->addChild(createLevelOfDetail(octree, child, areaPerPoint));
+            }
+        }
+
+        SoLevelOfDetail* lod = new SoLevelOfDetail();
+        lod->screenArea.setValue(static_cast<float>(data.count) * areaPerPoint);
+        lod->addChild(children);
+        lod->addChild(new SoGroup());
+        sep->addChild(lod);
+    }
+
+    return sep;
+}
+
+void ViewProviderScattered::showPoints(SoNode* node)
+{
+    SoNode* other = (node == pcPoints) ? static_cast<SoNode*>(pcPointsLOD) : pcPoints;
+    int index = pcHighlight->findChild(other);
+    if (index >= 0) {
+        pcHighlight->replaceChild(index, node);
+    }
+}
+
 void ViewProviderScattered::cut(const std::vector<SbVec2f>& picked,
                                 Gui::View3DInventorViewer& Viewer)
 {
@@ -32,6 +32,7 @@
 
 
 class SoSwitch;
+class SoGroup;
 class SoPointSet;
 class SoIndexedPointSet;
 class SoLocateHighlight;
@@ -54,6 +55,7 @@ namespace Points
 class PropertyGreyValueList;
 class PropertyNormalList;
 class PointKernel;
+class PointOctree;
 class Feature;
 }  // namespace Points
 
@@ -96,6 +98,14 @@ public:
     /// Unsets the edit mode
     void unsetEdit(int ModNum) override;
 
+    /** @name Selection handling
+     * A point is named Vertex followed by its index in the kernel, starting with 1.
+     */
+    //@{
+    std::string getElement(const SoDetail*) const override;
+    SoDetail* getDetail(const char*) const override;
+    //@}
+
 public:
     static void clipPointsCallback(void* ud, SoEventCallback* n);
 
@@ -104,6 +114,8 @@ protected:
     void setVertexColorMode(App::PropertyColorList*);
     void setVertexGreyvalueMode(Points::PropertyGreyValueList*);
     void setVertexNormalMode(Points::PropertyNormalList*);
+    /// Returns the index of the point that is stored at \a index in the coordinate node
+    std::size_t getPointIndex(std::size_t index) const;
     virtual void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) = 0;
 
 protected:
@@ -112,6 +124,8 @@ protected:
     SoMaterial* pcColorMat;
     SoNormal* pcPointsNormal;
     SoDrawStyle* pcPointStyle;
+    /// The order of the points in the coordinate node if it differs from the kernel
+    std::vector<std::size_t> pointOrder;
 
 private:
     static App::PropertyFloatConstraint::Constraints floatRange;
@@ -141,8 +155,16 @@ public:
 protected:
     void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) override;
 
+private:
+    bool useLevelOfDetail(const Points::PointKernel&) const;
+    void createLevelOfDetail(const Points::PointKernel&);
+    SoNode* createLevelOfDetail(const Points::PointOctree&, int node, float areaPerPoint) const;
+    void showPoints(SoNode*);
+
 protected:
     SoPointSet* pcPoints;
+    /// Draws the points of large clouds depending on their size on screen
+    SoGroup* pcPointsLOD;
 };
 
 /**
@@ -47,3 +47,4 @@ class PointsWorkbench(Workbench):
 
 
 Gui.addWorkbench(PointsWorkbench())
+FreeCAD.__unit_test__ += ["PointsTestsGui"]
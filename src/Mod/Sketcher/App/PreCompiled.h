@@ -32,6 +32,7 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iostream>
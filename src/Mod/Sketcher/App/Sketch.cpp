@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -2391,6 +2392,7 @@ int Sketch::addConstraints(const std::vector<Constraint*>& ConstraintList)
          it != ConstraintList.end();
          ++it, ++cid) {
         rtn = addConstraint(*it);
+        Constrs.back().listIndex = cid;
 
         if (rtn == -1) {
             int humanconstraintid = cid + 1;
@@ -2414,6 +2416,7 @@ int Sketch::addConstraints(const std::vector<Constraint*>& ConstraintList,
          ++it, ++cid) {
         if (!unenforceableConstraints[cid] && (*it)->Type != Block && (*it)->isActive) {
             rtn = addConstraint(*it);
+            Constrs.back().listIndex = cid;
 
             if (rtn == -1) {
                 int humanconstraintid = cid + 1;
@@ -5214,6 +5217,43 @@ int Sketch::setDatum(int /*constrId*/, double /*value*/)
     return -1;
 }
 
+bool Sketch::updateDatum(int constrId, const Constraint* constraint)
+{
+    auto it = std::find_if(Constrs.begin(), Constrs.end(), [constrId](const ConstrDef& c) {
+        return c.listIndex == constrId;
+    });
+    if (it == Constrs.end() || !it->driving || !it->value) {
+        return false;
+    }
+
+    // the datum of tangency and perpendicularity encodes the kind of the constraint and a zero
+    // datum may change the rank of the system, both require a new diagnosis
+    ConstraintType type = constraint->Type;
+    double datum = constraint->getValue();
+    if (type == Tangent || type == Perpendicular || datum == 0.0) {
+        return false;
+    }
+
+    if (type == SnellsLaw) {
+        // same split into the refractive indexes as in addSnellsLawConstraint
+        if (fabs(datum) >= 1.0) {
+            *it->secondvalue = datum;
+            *it->value = 1.0;
+        }
+        else {
+            *it->secondvalue = 1.0;
+            *it->value = 1 / datum;
+        }
+    }
+    else {
+        *it->value = datum;
+    }
+
+    // the replaced constraint may already be deleted
+    it->constr = const_cast<Constraint*>(constraint);
+    return true;
+}
+
 int Sketch::getPointId(int geoId, PointPos pos) const
 {
     // do a range check first
@@ -158,6 +158,15 @@ public:
      */
     int setDatum(int constrId, double value);
 
+    /** takes over the new datum value of constraint \a constrId of the list the sketch was set
+     * up with, without setting up the solver again. \a constraint replaces the constraint, it
+     * must only differ from it in its value.
+     *
+     * returns false if the solver model cannot take the new value as it is, in which case the
+     * sketch is left untouched and has to be set up anew.
+     */
+    bool updateDatum(int constrId, const Constraint* constraint);
+
     /** initializes a point (or curve) drag by setting the current
      * sketch status as a reference
      */
@@ -559,11 +568,13 @@ protected:
             , driving(true)
             , value(nullptr)
             , secondvalue(nullptr)
+            , listIndex(-1)
         {}
         Constraint* constr;  // pointer to the constraint
         bool driving;
         double* value;
         double* secondvalue;  // this is needed for SnellsLaw
+        int listIndex;        // index in the constraint list the sketch was set up with
     };
 
     std::vector<GeoDef> Geoms;
@@ -149,6 +149,7 @@ SketchObject::SketchObject()
     lastSolveTime = 0;
 
     solverNeedsUpdate = false;
+    solvedSketchUpToDate = false;
 
     noRecomputes = false;
 
@@ -347,6 +348,8 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
     lastDoF = solvedSketch.setUpSketch(
         getCompleteGeometry(), Constraints.getValues(), getExternalGeometryCount());
 
+    solvedSketchUpToDate = false;
+
     // At this point we have the solver information about conflicting/redundant/over-constrained,
     // but the sketch is NOT solved. Some examples: Redundant: a vertical line, a horizontal line
     // and an angle constraint of 90 degrees between the two lines Conflicting: a 80 degrees angle
@@ -419,6 +422,9 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
              ++it)
             if (*it)
                 delete *it;
+
+        // after setting the geometry, as a change of it resets the flag
+        solvedSketchUpToDate = true;
     }
     else if (err < 0) {
         // if solver failed, invalid constraints were likely added before solving
@@ -451,6 +457,11 @@ int SketchObject::setDatum(int ConstrId, double Datum)
     if (type == Distance && Datum == 0)
             return -5;
 
+    // A new datum value leaves the structure of the system unchanged, so the solver model of the
+    // last solve is reused instead of cloning all geometry into a new one. The flag has to be
+    // read before setting the constraints, which resets it.
+    bool reuseSolver = solvedSketchUpToDate && !solverNeedsUpdate;
+
     // copy the list
     std::vector<Constraint*> newVals(vals);
     double oldDatum = newVals[ConstrId]->getValue();
@@ -459,7 +470,14 @@ int SketchObject::setDatum(int ConstrId, double Datum)
 
     this->Constraints.setValues(std::move(newVals));
 
-    int err = solve();
+    int err = -1;
+    if (reuseSolver
+        && solvedSketch.updateDatum(ConstrId, this->Constraints.getValues()[ConstrId]))
+        err = solveChangedDatum();
+
+    // a full solve also gives a fresh diagnosis of why the datum cannot be solved
+    if (err)
+        err = solve();
 
     if (err)
         this->Constraints.getValues()[ConstrId]->setValue(oldDatum);// newVals is a shell now
@@ -467,6 +485,31 @@ int SketchObject::setDatum(int ConstrId, double Datum)
     return err;
 }
 
+int SketchObject::solveChangedDatum()
+{
+    // the diagnosis of the last solve still holds as only a datum value has changed
+    lastSolverStatus = solvedSketch.solve();
+    lastSolveTime = solvedSketch.getSolveTime();
+    if (lastSolverStatus != 0)
+        return -1;
+
+    if (lastHasPartialRedundancies) {
+        Base::Console().Warning(
+            this->getFullLabel(),
+            QT_TRANSLATE_NOOP("Notifications",
+                              "The Sketch has partially redundant constraints!") "\n");
+    }
+
+    std::vector<Part::Geometry*> geomlist = solvedSketch.extractGeometry();
+    Geometry.setValues(geomlist);
+    for (auto geo : geomlist)
+        delete geo;
+
+    solvedSketchUpToDate = true;
+
+    return 0;
+}
+
 int SketchObject::setDriving(int ConstrId, bool isdriving)
 {
     // no need to check input data validity as this is an sketchobject managed operation.
@@ -915,6 +958,8 @@ int SketchObject::setUpSketch()
     lastDoF = solvedSketch.setUpSketch(
         getCompleteGeometry(), Constraints.getValues(), getExternalGeometryCount());
 
+    solvedSketchUpToDate = false;
+
     retrieveSolverDiagnostics();
 
     if (lastHasRedundancies || lastDoF < 0 || lastHasConflict || lastHasMalformedConstraints
@@ -939,6 +984,8 @@ int SketchObject::diagnoseAdditionalConstraints(
     lastDoF =
         solvedSketch.setUpSketch(getCompleteGeometry(), allconstraints, getExternalGeometryCount());
 
+    solvedSketchUpToDate = false;
+
     retrieveSolverDiagnostics();
 
     return lastDoF;
@@ -967,6 +1014,9 @@ int SketchObject::movePoint(int GeoId, PointPos PosId, const Base::Vector3d& toP
         solverNeedsUpdate = false;
     }
 
+    // a failed move may leave the solver model in between
+    solvedSketchUpToDate = false;
+
     if (lastDoF < 0)// over-constrained sketch
         return -1;
     if (lastHasConflict)// conflicting constraints
@@ -7514,6 +7564,9 @@ void SketchObject::validateExternalLinks()
 
 void SketchObject::rebuildExternalGeometry()
 {
+    // the solver model holds copies of the external geometry
+    solvedSketchUpToDate = false;
+
     // get the actual lists of the externals
     std::vector<DocumentObject*> Objects = ExternalGeometry.getValues();
     std::vector<std::string> SubElements = ExternalGeometry.getSubValues();
@@ -8857,6 +8910,10 @@ void SketchObject::Restore(XMLReader& reader)
 
 void SketchObject::onChanged(const App::Property* prop)
 {
+    if (prop == &Geometry || prop == &Constraints || prop == &ExternalGeometry) {
+        solvedSketchUpToDate = false;
+    }
+
     if (isRestoring() && prop == &Geometry) {
         std::vector<Part::Geometry*> geom = Geometry.getValues();
         std::vector<Part::Geometry*> supportedGeom = supportedGeometry(geom);
@@ -800,6 +800,9 @@ protected:
     // retrieves redundant, conflicting and malformed constraint information from the solver
     void retrieveSolverDiagnostics();
 
+    // solves the solver model of the last solve again after a datum value changed
+    int solveChangedDatum();
+
     // retrieves whether a geometry blocked state corresponds to this constraint
     // returns true of the constraint is of Block type, false otherwise
     bool getBlockedState(const Constraint* cstr, bool& blockedstate) const;
@@ -852,6 +855,12 @@ private:
     */
     bool solverNeedsUpdate;
 
+    /** this internal flag indicates that solvedSketch was set up from the current geometry and
+       constraints and solved without error, so that it can be reused when only a datum value
+       changes (see setDatum).
+    */
+    bool solvedSketchUpToDate;
+
     int lastDoF;
     bool lastHasConflict;
     bool lastHasRedundancies;
@@ -906,6 +915,9 @@ inline int SketchObject::initTemporaryMove(int geoId, PointPos pos, bool fine /*
         solve();
     }
 
+    // the temporary move changes the solver model
+    solvedSketchUpToDate = false;
+
     return solvedSketch.initMove(geoId, pos, fine);
 }
 
@@ -921,6 +933,8 @@ inline int SketchObject::initTemporaryBSplinePieceMove(int geoId,
         solve();
     }
 
+    solvedSketchUpToDate = false;
+
     return solvedSketch.initBSplinePieceMove(geoId, pos, firstPoint, fine);
 }
 
@@ -528,6 +528,10 @@ void EditModeCoinManager::ParameterObserver::OnChange(Base::Subject<const char*>
 
         function(string);
 
+        // the parameter may change how any element is drawn
+        Client.pEditModeGeometryCoinManager->clearGeometryCache();
+        Client.pEditModeConstraintCoinManager->clearDrawingCaches();
+
         Client.redrawViewProvider();  // redraw with non-temporal geometry
     }
 }
@@ -818,7 +822,8 @@ void EditModeCoinManager::processGeometryConstraintsInformationOverlay(
 
     updateAxesLength();
 
-    pEditModeConstraintCoinManager->processConstraints(geolistfacade);
+    pEditModeConstraintCoinManager->processConstraints(geolistfacade,
+                                                       analysisResults.changedGeoIds);
 }
 
 void EditModeCoinManager::updateOverlayParameters()
@@ -352,6 +352,7 @@ struct AnalysisResults
     float boundingBoxMagnitudeOrder = 0;  // used for grid extension
     std::vector<int> bsplineGeoIds;       // used for information overlay
     std::vector<int> arcGeoIds;
+    std::vector<int> changedGeoIds;  // sorted, geometries redrawn by the last geometry processing
 };
 
 /** @brief      Struct adapted to store the parameters necessary to create and update
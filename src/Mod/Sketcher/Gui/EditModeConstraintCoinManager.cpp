@@ -112,13 +112,22 @@ void EditModeConstraintCoinManager::updateVirtualSpace()
     }
 }
 
-void EditModeConstraintCoinManager::processConstraints(const GeoListFacade& geolistfacade)
+void EditModeConstraintCoinManager::processConstraints(const GeoListFacade& geolistfacade,
+                                                       const std::vector<int>& changedGeoIds)
 {
     const auto& constrlist = ViewProviderSketchCoinAttorney::getConstraints(viewProvider);
 
     auto zConstrH = ViewProviderSketchCoinAttorney::getViewOrientationFactor(viewProvider)
         * drawingParameters.zConstr;
 
+    // the positions depend on the view orientation and, for icons, on the zoom
+    float scaleFactor = ViewProviderSketchCoinAttorney::getScaleFactor(viewProvider);
+    if (zConstrH != drawnZConstrH || scaleFactor != drawnScaleFactor) {
+        drawnConstraints.clear();
+        drawnZConstrH = zConstrH;
+        drawnScaleFactor = scaleFactor;
+    }
+
     // After an undo/redo it can happen that we have an empty geometry list but a non-empty
     // constraint list In this case just ignore the constraints. (See bug #0000421)
     if (geolistfacade.geomlist.size() <= 2 && !constrlist.empty()) {
@@ -142,6 +151,25 @@ Restart:
     // update the virtual space
     updateVirtualSpace();
 
+    drawnConstraints.resize(constrlist.size());
+
+    auto isGeometryChanged = [&changedGeoIds](int geoId) {
+        return std::binary_search(changedGeoIds.begin(), changedGeoIds.end(), geoId);
+    };
+
+    auto isSameConstraint = [](const Constraint* drawn, const Constraint* constr) {
+        return drawn && drawn->Type == constr->Type && drawn->AlignmentType == constr->AlignmentType
+            && drawn->Name == constr->Name && drawn->First == constr->First
+            && drawn->FirstPos == constr->FirstPos && drawn->Second == constr->Second
+            && drawn->SecondPos == constr->SecondPos && drawn->Third == constr->Third
+            && drawn->ThirdPos == constr->ThirdPos && drawn->LabelDistance == constr->LabelDistance
+            && drawn->LabelPosition == constr->LabelPosition
+            && drawn->isDriving == constr->isDriving
+            && drawn->InternalAlignmentIndex == constr->InternalAlignmentIndex
+            && drawn->isInVirtualSpace == constr->isInVirtualSpace
+            && drawn->isActive == constr->isActive && drawn->getValue() == constr->getValue();
+    };
+
     auto getNormal = [](const GeoListFacade& geolistfacade,
                         const int geoid,
                         const Base::Vector3d& pointoncurve) {
@@ -197,6 +225,14 @@ Restart:
                 continue;
             }
 
+            // nothing to do if neither the constraint nor its geometry changed since last time
+            if (isSameConstraint(drawnConstraints[i].get(), Constr)
+                && !isGeometryChanged(Constr->First) && !isGeometryChanged(Constr->Second)
+                && !isGeometryChanged(Constr->Third)) {
+                continue;
+            }
+            drawnConstraints[i].reset();
+
             // distinguish different constraint types to build up
             switch (Constr->Type) {
                 case Block:
@@ -1588,6 +1624,8 @@ Restart:
                 case NumConstraintTypes:
                     break;
             }
+
+            drawnConstraints[i].reset(Constr->clone());
         }
         catch (Base::Exception& e) {
             Base::Console().DeveloperError("EditModeConstraintCoinManager",
@@ -1870,6 +1908,12 @@ void EditModeConstraintCoinManager::rebuildConstraintNodes()
     rebuildConstraintNodes(geolistfacade);
 }
 
+void EditModeConstraintCoinManager::clearDrawingCaches()
+{
+    drawnConstraints.clear();
+    drawnIcons.clear();
+}
+
 void EditModeConstraintCoinManager::setConstraintSelectability(bool enabled /* = true */)
 {
     if (enabled) {
@@ -1889,6 +1933,7 @@ void EditModeConstraintCoinManager::rebuildConstraintNodes(const GeoListFacade&
     Gui::coinRemoveAllChildren(editModeScenegraphNodes.constrGroup);
 
     vConstrType.clear();
+    clearDrawingCaches();
 
     // Get sketch normal
     Base::Vector3d RN(0, 0, 1);
@@ -2581,14 +2626,30 @@ void EditModeConstraintCoinManager::combineConstraintIcons(IconQueue iconQueue)
 
 void EditModeConstraintCoinManager::drawMergedConstraintIcons(IconQueue iconQueue)
 {
-    for (IconQueue::iterator i = iconQueue.begin(); i != iconQueue.end(); ++i) {
-        clearCoinImage(i->destination);
+    QString key;
+    for (const auto& item : iconQueue) {
+        key.append(iconKey(item));
+    }
+
+    for (IconQueue::iterator i = iconQueue.begin() + 1; i != iconQueue.end(); ++i) {
+        auto& drawn = drawnIcons[i->destination];
+        if (!drawn.cleared) {
+            clearCoinImage(i->destination);
+            drawn = DrawnIcon();
+            drawn.cleared = true;
+        }
     }
 
     QImage compositeIcon;
     SoImage* thisDest = iconQueue[0].destination;
     SoInfo* thisInfo = iconQueue[0].infoPtr;
 
+    auto& drawn = drawnIcons[thisDest];
+    if (drawn.key == key) {
+        combinedConstrBoxes[drawn.idString] = drawn.boundingBoxes;
+        return;
+    }
+
     // Tracks all constraint IDs that are combined into this icon
     QString idString;
     int lastVPad = 0;
@@ -2718,6 +2779,11 @@ void EditModeConstraintCoinManager::drawMergedConstraintIcons(IconQueue iconQueu
     combinedConstrBoxes[idString] = boundingBoxes;
     thisInfo->string.setValue(idString.toLatin1().data());
     sendConstraintIconToCoin(compositeIcon, thisDest);
+
+    drawn.key = key;
+    drawn.idString = idString;
+    drawn.boundingBoxes = boundingBoxes;
+    drawn.cleared = false;
 }
 
 
@@ -2823,6 +2889,12 @@ QImage EditModeConstraintCoinManager::renderConstrIcon(const QString& type,
 
 void EditModeConstraintCoinManager::drawTypicalConstraintIcon(const constrIconQueueItem& i)
 {
+    auto& drawn = drawnIcons[i.destination];
+    QString key = iconKey(i);
+    if (drawn.key == key) {
+        return;
+    }
+
     QColor color = constrColor(i.constraintId);
 
     QImage image = renderConstrIcon(i.type,
@@ -2833,6 +2905,19 @@ void EditModeConstraintCoinManager::drawTypicalConstraintIcon(const constrIconQu
 
     i.infoPtr->string.setValue(QString::number(i.constraintId).toLatin1().data());
     sendConstraintIconToCoin(image, i.destination);
+
+    drawn = DrawnIcon();
+    drawn.key = key;
+}
+
+QString EditModeConstraintCoinManager::iconKey(const constrIconQueueItem& i)
+{
+    return QString::fromLatin1("%1;%2;%3;%4;%5;")
+        .arg(i.type)
+        .arg(i.constraintId)
+        .arg(constrColor(i.constraintId).name())
+        .arg(i.iconRotation)
+        .arg(i.label);
 }
 
 QString EditModeConstraintCoinManager::iconTypeFromConstraint(Constraint* constraint)
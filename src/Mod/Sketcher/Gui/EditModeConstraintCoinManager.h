@@ -24,6 +24,7 @@
 #define SKETCHERGUI_EditModeConstraintCoinManager_H
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 #include <QColor>
@@ -104,8 +105,10 @@ public:
 
 
     /** @name update coin nodes*/
-    // geometry list to be used for constraints, which may be a temporal geometry
-    void processConstraints(const GeoListFacade& geolistfacade);
+    // geometry list to be used for constraints, which may be a temporal geometry. Only the
+    // constraints that changed or that refer to one of the sorted changedGeoIds are repositioned.
+    void processConstraints(const GeoListFacade& geolistfacade,
+                            const std::vector<int>& changedGeoIds);
 
     void updateVirtualSpace();
 
@@ -137,6 +140,9 @@ public:
 
     void createEditModeInventorNodes();
 
+    /// forces the next processConstraints and drawConstraintIcons to redraw everything
+    void clearDrawingCaches();
+
 private:
     void rebuildConstraintNodes(const GeoListFacade& geolistfacade);  // with specific geometry
 
@@ -191,6 +197,22 @@ private:
 
     std::map<QString, ConstrIconBBVec> combinedConstrBoxes;
 
+    // copies of the constraints as they were last positioned, indexed like the constraint list
+    std::vector<std::unique_ptr<Sketcher::Constraint>> drawnConstraints;
+    float drawnZConstrH = 0;
+    float drawnScaleFactor = 0;
+
+    // What was last sent to each icon node, so that icons are only rendered when they change
+    struct DrawnIcon
+    {
+        QString key;
+        QString idString;
+        ConstrIconBBVec boundingBoxes;
+        bool cleared = false;
+    };
+
+    std::map<SoImage*, DrawnIcon> drawnIcons;
+
 
     /// Internal type used for drawing constraint icons
     struct constrIconQueueItem
@@ -251,6 +273,9 @@ private:
     /// Essentially a version of sendConstraintIconToCoin, with a blank icon
     void clearCoinImage(SoImage* soImagePtr);
 
+    /// Returns the inputs the icon of the item is rendered from
+    QString iconKey(const constrIconQueueItem& i);
+
     /// Find helper angle for radius/diameter constraint
     void findHelperAngles(double& helperStartAngle,
                           double& helperAngle,
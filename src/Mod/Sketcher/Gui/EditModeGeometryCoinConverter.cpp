@@ -39,39 +39,283 @@ EditModeGeometryCoinConverter::EditModeGeometryCoinConverter(
     GeometryLayerNodes& geometrylayernodes,
     DrawingParameters& drawingparameters,
     GeometryLayerParameters& geometryLayerParams,
-    CoinMapping& coinMap)
+    CoinMapping& coinMap,
+    Cache& geometryCache)
     : viewProvider(vp)
     , geometryLayerNodes(geometrylayernodes)
     , drawingParameters(drawingparameters)
     , geometryLayerParameters(geometryLayerParams)
     , coinMapping(coinMap)
+    , cache(geometryCache)
 {}
 
+void EditModeGeometryCoinConverter::Cache::clear()
+{
+    entries.clear();
+}
+
 void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geolistfacade)
 {
 
     // measurements
     bsplineGeoIds.clear();
     arcGeoIds.clear();
+    changedGeoIds.clear();
+
+    int vOrFactor = ViewProviderSketchCoinAttorney::getViewOrientationFactor(viewProvider);
+    double linez = vOrFactor * drawingParameters.zLowLines;  // NOLINT
+    double pointz = vOrFactor * drawingParameters.zLowPoints;
+
+    int coinLayerCount = geometryLayerParameters.getCoinLayerCount();
+    int subLayerCount = geometryLayerParameters.getSubLayerCount();
+
+    // the cached entries are only valid for the parameters they were generated with
+    if (cache.curvedEdgeCountSegments != drawingParameters.curvedEdgeCountSegments
+        || cache.coinLayerCount != coinLayerCount || cache.subLayerCount != subLayerCount
+        || cache.linez != linez || cache.pointz != pointz) {
+        cache.clear();
+        cache.curvedEdgeCountSegments = drawingParameters.curvedEdgeCountSegments;
+        cache.coinLayerCount = coinLayerCount;
+        cache.subLayerCount = subLayerCount;
+        cache.linez = linez;
+        cache.pointz = pointz;
+    }
+
+    // Geometries that are not noticeably different from the cached ones are not converted again
+    constexpr double sameTolerance = 1e-9;
+
+    size_t geoCount = geolistfacade.geomlist.size() - 2;
+
+    // the layout is the number of points and vertices of each geometry in each layer. As long as
+    // it does not change, neither the coin mapping nor the unchanged coin values need an update.
+    bool sameLayout = !cache.entries.empty() && cache.entries.size() == geoCount
+        && coinMapping.PointIdToGeoId.size() == size_t(coinLayerCount);
+
+    cache.entries.resize(geoCount);
+    std::vector<bool> changed(geoCount, false);
+
+    for (size_t i = 0; i < geoCount; i++) {
+
+        const auto GeoId = geolistfacade.getGeoIdFromGeomListIndex(i);
+        const auto geom = geolistfacade.getGeometryFacadeFromGeoId(GeoId);
+        const auto geo = geom->getGeometry();
+        const auto type = geo->getTypeId();
+
+        int layerId = getSafeGeomLayerId(geom);
+        int subLayerId = geometryLayerParameters.getSubLayerIndex(GeoId, geom);
+
+        auto coinLayer = geometryLayerParameters.getSafeCoinLayer(layerId);
+
+        if (type.isDerivedFrom(Part::GeomArcOfConic::getClassTypeId())) {
+            arcGeoIds.push_back(GeoId);
+        }
+        else if (type == Part::GeomBSplineCurve::getClassTypeId()) {
+            bsplineGeoIds.push_back(GeoId);
+        }
+
+        auto& cached = cache.entries[i];
+
+        if (cached.geometry && cached.geoId == GeoId && cached.coinLayer == coinLayer
+            && cached.subLayer == subLayerId && cached.geometry->getTypeId() == type
+            && cached.geometry->isSame(*geo, sameTolerance, sameTolerance)) {
+            continue;
+        }
+
+        Cache::Entry entry;
+        entry.geometry.reset(geo->copy());
+        entry.geoId = GeoId;
+        entry.coinLayer = coinLayer;
+        entry.subLayer = subLayerId;
+
+        if (type == Part::GeomPoint::getClassTypeId()) {  // add a point
+            convert<Part::GeomPoint,
+                    EditModeGeometryCoinConverter::PointsMode::InsertSingle,
+                    EditModeGeometryCoinConverter::CurveMode::NoCurve,
+                    EditModeGeometryCoinConverter::AnalyseMode::BoundingBoxMagnitude>(geom,
+                                                                                      GeoId,
+                                                                                      entry);
+        }
+        else if (type == Part::GeomLineSegment::getClassTypeId()) {  // add a line
+            convert<Part::GeomLineSegment,
+                    EditModeGeometryCoinConverter::PointsMode::InsertStartEnd,
+                    EditModeGeometryCoinConverter::CurveMode::StartEndPointsOnly,
+                    EditModeGeometryCoinConverter::AnalyseMode::BoundingBoxMagnitude>(geom,
+                                                                                      GeoId,
+                                                                                      entry);
+        }
+        else if (type.isDerivedFrom(
+                     Part::GeomConic::getClassTypeId())) {  // add a closed curve conic
+            convert<Part::GeomConic,
+                    EditModeGeometryCoinConverter::PointsMode::InsertMidOnly,
+                    EditModeGeometryCoinConverter::CurveMode::ClosedCurve,
+                    EditModeGeometryCoinConverter::AnalyseMode::BoundingBoxMagnitude>(geom,
+                                                                                      GeoId,
+                                                                                      entry);
+        }
+        else if (type.isDerivedFrom(
+                     Part::GeomArcOfConic::getClassTypeId())) {  // add an arc of conic
+            convert<Part::GeomArcOfConic,
+                    EditModeGeometryCoinConverter::PointsMode::InsertStartEndMid,
+                    EditModeGeometryCoinConverter::CurveMode::OpenCurve,
+                    EditModeGeometryCoinConverter::AnalyseMode::BoundingBoxMagnitude>(geom,
+                                                                                      GeoId,
+                                                                                      entry);
+        }
+        else if (type == Part::GeomBSplineCurve::getClassTypeId()) {  // add a bspline (a bounded
+                                                                      // curve that is not a conic)
+            convert<Part::GeomBSplineCurve,
+                    EditModeGeometryCoinConverter::PointsMode::InsertStartEnd,
+                    EditModeGeometryCoinConverter::CurveMode::OpenCurve,
+                    EditModeGeometryCoinConverter::AnalyseMode::
+                        BoundingBoxMagnitudeAndBSplineCurvature>(geom, GeoId, entry);
+        }
 
-    // end information layer
-    Points.clear();
-    Coords.clear();
-    Index.clear();
+        if (!cached.geometry || cached.geoId != entry.geoId || cached.coinLayer != entry.coinLayer
+            || cached.subLayer != entry.subLayer || cached.pointMode != entry.pointMode
+            || cached.hasCurve != entry.hasCurve || cached.points.size() != entry.points.size()
+            || cached.coords.size() != entry.coords.size()) {
+            sameLayout = false;
+        }
+
+        cached = std::move(entry);
+        changed[i] = true;
+        changedGeoIds.push_back(GeoId);
+    }
+
+    std::sort(changedGeoIds.begin(), changedGeoIds.end());
+
+    // position of the points and vertices of each geometry within the coin fields of its layer
+    std::vector<int> pointOffsets(geoCount);
+    std::vector<int> coordOffsets(geoCount);
+    std::vector<int> pointCount(coinLayerCount, 0);
+    std::vector<std::vector<int>> coordCount(coinLayerCount, std::vector<int>(subLayerCount, 0));
+    std::vector<std::vector<int>> curveCount(coinLayerCount, std::vector<int>(subLayerCount, 0));
+
+    pointCount[0] = 1;  // RootPoint
 
+    for (size_t i = 0; i < geoCount; i++) {
+        const auto& entry = cache.entries[i];
+
+        boundingBoxMaxMagnitude = std::max(boundingBoxMaxMagnitude, entry.maxMagnitude);
+        combrepscale = std::max(combrepscale, entry.combRepScale);
+
+        pointOffsets[i] = pointCount[entry.coinLayer];
+        pointCount[entry.coinLayer] += int(entry.points.size());
+        coordOffsets[i] = coordCount[entry.coinLayer][entry.subLayer];
+        coordCount[entry.coinLayer][entry.subLayer] += int(entry.coords.size());
+        if (entry.hasCurve) {
+            curveCount[entry.coinLayer][entry.subLayer]++;
+        }
+    }
+
+    // the nodes may have been recreated in the meantime
+    for (auto l = 0; l < coinLayerCount && sameLayout; l++) {
+        sameLayout = geometryLayerNodes.PointsCoordinate[l]->point.getNum() == pointCount[l];
+        for (auto t = 0; t < subLayerCount && sameLayout; t++) {
+            sameLayout =
+                geometryLayerNodes.CurvesCoordinate[l][t]->point.getNum() == coordCount[l][t]
+                && geometryLayerNodes.CurveSet[l][t]->numVertices.getNum() == curveCount[l][t];
+        }
+    }
+
+    // Coin Nodes Editing
+    std::vector<SbVec3f*> pverts(coinLayerCount, nullptr);
+    std::vector<std::vector<SbVec3f*>> verts(coinLayerCount,
+                                             std::vector<SbVec3f*>(subLayerCount, nullptr));
+
+    if (!sameLayout) {
+        rebuildCoinMapping();
+
+        for (auto l = 0; l < coinLayerCount; l++) {
+            geometryLayerNodes.PointsCoordinate[l]->point.setNum(pointCount[l]);
+            geometryLayerNodes.PointsMaterials[l]->diffuseColor.setNum(pointCount[l]);
+            pverts[l] = geometryLayerNodes.PointsCoordinate[l]->point.startEditing();
+
+            for (auto t = 0; t < subLayerCount; t++) {
+                geometryLayerNodes.CurvesCoordinate[l][t]->point.setNum(coordCount[l][t]);
+                geometryLayerNodes.CurveSet[l][t]->numVertices.setNum(curveCount[l][t]);
+                geometryLayerNodes.CurvesMaterials[l][t]->diffuseColor.setNum(curveCount[l][t]);
+                verts[l][t] = geometryLayerNodes.CurvesCoordinate[l][t]->point.startEditing();
+            }
+        }
+
+        pverts[0][0].setValue(0., 0., pointz);  // RootPoint
+
+        // setting up the indexes of the line sets
+        std::vector<std::vector<int32_t*>> index(coinLayerCount,
+                                                 std::vector<int32_t*>(subLayerCount, nullptr));
+        for (auto l = 0; l < coinLayerCount; l++) {
+            for (auto t = 0; t < subLayerCount; t++) {
+                index[l][t] = geometryLayerNodes.CurveSet[l][t]->numVertices.startEditing();
+            }
+        }
+
+        for (const auto& entry : cache.entries) {
+            if (entry.hasCurve) {
+                *index[entry.coinLayer][entry.subLayer]++ = entry.coords.size();
+            }
+        }
+
+        for (auto l = 0; l < coinLayerCount; l++) {
+            for (auto t = 0; t < subLayerCount; t++) {
+                geometryLayerNodes.CurveSet[l][t]->numVertices.finishEditing();
+            }
+        }
+    }
+
+    // setting up the point and line sets, either of all geometries or only of the changed ones
+    for (size_t i = 0; i < geoCount; i++) {
+        if (sameLayout && !changed[i]) {
+            continue;
+        }
+
+        const auto& entry = cache.entries[i];
+        int l = entry.coinLayer;
+        int t = entry.subLayer;
+
+        if (!entry.points.empty()) {
+            if (!pverts[l]) {
+                pverts[l] = geometryLayerNodes.PointsCoordinate[l]->point.startEditing();
+            }
+            SbVec3f* pvert = pverts[l] + pointOffsets[i];
+            for (auto& point : entry.points) {
+                (pvert++)->setValue(point.x, point.y, pointz);
+            }
+        }
+
+        if (!entry.coords.empty()) {
+            if (!verts[l][t]) {
+                verts[l][t] = geometryLayerNodes.CurvesCoordinate[l][t]->point.startEditing();
+            }
+            SbVec3f* vert = verts[l][t] + coordOffsets[i];
+            for (auto& coord : entry.coords) {
+                (vert++)->setValue(coord.x, coord.y, linez);  // NOLINT
+            }
+        }
+    }
+
+    for (auto l = 0; l < coinLayerCount; l++) {
+        if (pverts[l]) {
+            geometryLayerNodes.PointsCoordinate[l]->point.finishEditing();
+        }
+        for (auto t = 0; t < subLayerCount; t++) {
+            if (verts[l][t]) {
+                geometryLayerNodes.CurvesCoordinate[l][t]->point.finishEditing();
+            }
+        }
+    }
+}
+
+void EditModeGeometryCoinConverter::rebuildCoinMapping()
+{
     coinMapping.clear();
 
     pointCounter.clear();
+    vertexCounter = 0;
 
     for (auto l = 0; l < geometryLayerParameters.getCoinLayerCount(); l++) {
-        Points.emplace_back();
-        Coords.emplace_back();
-        Index.emplace_back();
-
         coinMapping.CurvIdToGeoId.emplace_back();
         for (int t = 0; t < geometryLayerParameters.getSubLayerCount(); t++) {
-            Coords[l].emplace_back();
-            Index[l].emplace_back();
             coinMapping.CurvIdToGeoId[l].emplace_back();
         }
         coinMapping.PointIdToGeoId.emplace_back();
@@ -84,7 +328,6 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geoli
     // TODO: RootPoint is here added in layer0. However, this layer may be hidden. The point should,
     // when that functionality is provided, be added to the first visible layer, or may even a new
     // empty layer.
-    Points[0].emplace_back(0., 0., 0.);
     coinMapping.PointIdToGeoId[0].push_back(-1);  // root point
     coinMapping.PointIdToVertexId[0].push_back(-1);
     // VertexId is the reference used for point selection/preselection
@@ -168,125 +411,15 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geoli
         }
     };
 
-    for (size_t i = 0; i < geolistfacade.geomlist.size() - 2; i++) {
-
-        const auto GeoId = geolistfacade.getGeoIdFromGeomListIndex(i);
-        const auto geom = geolistfacade.getGeometryFacadeFromGeoId(GeoId);
-        const auto type = geom->getGeometry()->getTypeId();
-
-        int layerId = getSafeGeomLayerId(geom);
-        int subLayerId = geometryLayerParameters.getSubLayerIndex(GeoId, geom);
-
-        auto coinLayer = geometryLayerParameters.getSafeCoinLayer(layerId);
-
-        if (type == Part::GeomPoint::getClassTypeId()) {  // add a point
-            convert<Part::GeomPoint,
-                    EditModeGeometryCoinConverter::PointsMode::InsertSingle,
-                    EditModeGeometryCoinConverter::CurveMode::NoCurve,
-                    EditModeGeometryCoinConverter::AnalyseMode::BoundingBoxMagnitude>(geom,
-                                                                                      GeoId,
-                                                                                      subLayerId);
-            setTracking(GeoId,
-                        coinLayer,
-                        EditModeGeometryCoinConverter::PointsMode::InsertSingle,
-                        0,
-                        subLayerId);
-        }
-        else if (type == Part::GeomLineSegment::getClassTypeId()) {  // add a line
-            convert<Part::GeomLineSegment,
-                    EditModeGeometryCoinConverter::PointsMode::InsertStartEnd,
-                    EditModeGeometryCoinConverter::CurveMode::StartEndPointsOnly,
-                    EditModeGeometryCoinConverter::AnalyseMode::BoundingBoxMagnitude>(geom,
-                                                                                      GeoId,
-                                                                                      subLayerId);
-            setTracking(GeoId,
-                        coinLayer,
-                        EditModeGeometryCoinConverter::PointsMode::InsertStartEnd,
-                        1,
-                        subLayerId);
-        }
-        else if (type.isDerivedFrom(
-                     Part::GeomConic::getClassTypeId())) {  // add a closed curve conic
-            convert<Part::GeomConic,
-                    EditModeGeometryCoinConverter::PointsMode::InsertMidOnly,
-                    EditModeGeometryCoinConverter::CurveMode::ClosedCurve,
-                    EditModeGeometryCoinConverter::AnalyseMode::BoundingBoxMagnitude>(geom,
-                                                                                      GeoId,
-                                                                                      subLayerId);
-            setTracking(GeoId,
-                        coinLayer,
-                        EditModeGeometryCoinConverter::PointsMode::InsertMidOnly,
-                        1,
-                        subLayerId);
-        }
-        else if (type.isDerivedFrom(
-                     Part::GeomArcOfConic::getClassTypeId())) {  // add an arc of conic
-            convert<Part::GeomArcOfConic,
-                    EditModeGeometryCoinConverter::PointsMode::InsertStartEndMid,
-                    EditModeGeometryCoinConverter::CurveMode::OpenCurve,
-                    EditModeGeometryCoinConverter::AnalyseMode::BoundingBoxMagnitude>(geom,
-                                                                                      GeoId,
-                                                                                      subLayerId);
-            setTracking(GeoId,
-                        coinLayer,
-                        EditModeGeometryCoinConverter::PointsMode::InsertStartEndMid,
-                        1,
-                        subLayerId);
-            arcGeoIds.push_back(GeoId);
-        }
-        else if (type == Part::GeomBSplineCurve::getClassTypeId()) {  // add a bspline (a bounded
-                                                                      // curve that is not a conic)
-            convert<Part::GeomBSplineCurve,
-                    EditModeGeometryCoinConverter::PointsMode::InsertStartEnd,
-                    EditModeGeometryCoinConverter::CurveMode::OpenCurve,
-                    EditModeGeometryCoinConverter::AnalyseMode::
-                        BoundingBoxMagnitudeAndBSplineCurvature>(geom, GeoId, subLayerId);
-            setTracking(GeoId,
-                        coinLayer,
-                        EditModeGeometryCoinConverter::PointsMode::InsertStartEnd,
-                        1,
-                        subLayerId);
-            bsplineGeoIds.push_back(GeoId);
-        }
-    }
-
-    // Coin Nodes Editing
-    int vOrFactor = ViewProviderSketchCoinAttorney::getViewOrientationFactor(viewProvider);
-    double linez = vOrFactor * drawingParameters.zLowLines;  // NOLINT
-    double pointz = vOrFactor * drawingParameters.zLowPoints;
-
-    for (auto l = 0; l < geometryLayerParameters.getCoinLayerCount(); l++) {
-        geometryLayerNodes.PointsCoordinate[l]->point.setNum(Points[l].size());
-        geometryLayerNodes.PointsMaterials[l]->diffuseColor.setNum(Points[l].size());
-        SbVec3f* pverts = geometryLayerNodes.PointsCoordinate[l]->point.startEditing();
-
-        int i = 0;  // setting up the point set
-        for (auto& point : Points[l]) {
-            pverts[i++].setValue(point.x, point.y, pointz);
-        }
-        geometryLayerNodes.PointsCoordinate[l]->point.finishEditing();
-
-        for (auto t = 0; t < geometryLayerParameters.getSubLayerCount(); t++) {
-            geometryLayerNodes.CurvesCoordinate[l][t]->point.setNum(Coords[l][t].size());
-            geometryLayerNodes.CurveSet[l][t]->numVertices.setNum(Index[l][t].size());
-            geometryLayerNodes.CurvesMaterials[l][t]->diffuseColor.setNum(Index[l][t].size());
-
-            SbVec3f* verts = geometryLayerNodes.CurvesCoordinate[l][t]->point.startEditing();
-            int32_t* index = geometryLayerNodes.CurveSet[l][t]->numVertices.startEditing();
-
-            i = 0;  // setting up the line set
-            for (auto& coord : Coords[l][t]) {
-                verts[i++].setValue(coord.x, coord.y, linez);  // NOLINT
-            }
-
-            i = 0;  // setting up the indexes of the line set
-            for (auto it : Index[l][t]) {
-                index[i++] = it;
-            }
-
-            geometryLayerNodes.CurvesCoordinate[l][t]->point.finishEditing();
-            geometryLayerNodes.CurveSet[l][t]->numVertices.finishEditing();
+    for (const auto& entry : cache.entries) {
+        if (entry.points.empty()) {  // not a supported geometry type
+            continue;
         }
+        setTracking(entry.geoId,
+                    entry.coinLayer,
+                    entry.pointMode,
+                    entry.hasCurve ? 1 : 0,
+                    entry.subLayer);
     }
 }
 
@@ -296,14 +429,13 @@ template<typename GeoType,
          EditModeGeometryCoinConverter::AnalyseMode analysemode>
 void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geometryfacade,
                                             [[maybe_unused]] int geoid,
-                                            int subLayer)
+                                            Cache::Entry& entry)
 {
     auto geo = static_cast<const GeoType*>(geometryfacade->getGeometry());
-    auto layerId = getSafeGeomLayerId(geometryfacade);
 
-    auto coinLayer = geometryLayerParameters.getSafeCoinLayer(layerId);
+    entry.pointMode = pointmode;
 
-    auto addPoint = [&dMg = boundingBoxMaxMagnitude](auto& pushvector, Base::Vector3d point) {
+    auto addPoint = [&dMg = entry.maxMagnitude](auto& pushvector, Base::Vector3d point) {
         if constexpr (analysemode == AnalyseMode::BoundingBoxMagnitude
                       || analysemode == AnalyseMode::BoundingBoxMagnitudeAndBSplineCurvature) {
             dMg = dMg > std::abs(point.x) ? dMg : std::abs(point.x);
@@ -314,27 +446,27 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
 
     // Points
     if constexpr (pointmode == PointsMode::InsertSingle) {
-        addPoint(Points[coinLayer], geo->getPoint());
+        addPoint(entry.points, geo->getPoint());
     }
     else if constexpr (pointmode == PointsMode::InsertStartEnd) {
-        addPoint(Points[coinLayer], geo->getStartPoint());
-        addPoint(Points[coinLayer], geo->getEndPoint());
+        addPoint(entry.points, geo->getStartPoint());
+        addPoint(entry.points, geo->getEndPoint());
     }
     else if constexpr (pointmode == PointsMode::InsertStartEndMid) {
         // All in this group are Trimmed Curves (see Geometry.h)
-        addPoint(Points[coinLayer], geo->getStartPoint(/*emulateCCW=*/true));
-        addPoint(Points[coinLayer], geo->getEndPoint(/*emulateCCW=*/true));
-        addPoint(Points[coinLayer], geo->getCenter());
+        addPoint(entry.points, geo->getStartPoint(/*emulateCCW=*/true));
+        addPoint(entry.points, geo->getEndPoint(/*emulateCCW=*/true));
+        addPoint(entry.points, geo->getCenter());
     }
     else if constexpr (pointmode == PointsMode::InsertMidOnly) {
-        addPoint(Points[coinLayer], geo->getCenter());
+        addPoint(entry.points, geo->getCenter());
     }
 
     // Curves
     if constexpr (curvemode == CurveMode::StartEndPointsOnly) {
-        addPoint(Coords[coinLayer][subLayer], geo->getStartPoint());
-        addPoint(Coords[coinLayer][subLayer], geo->getEndPoint());
-        Index[coinLayer][subLayer].push_back(2);
+        addPoint(entry.coords, geo->getStartPoint());
+        addPoint(entry.coords, geo->getEndPoint());
+        entry.hasCurve = true;
     }
     else if constexpr (curvemode == CurveMode::ClosedCurve) {
         int numSegments = drawingParameters.curvedEdgeCountSegments;
@@ -346,13 +478,13 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
 
         for (int i = 0; i < numSegments; i++) {
             Base::Vector3d pnt = geo->value(i * segment);
-            addPoint(Coords[coinLayer][subLayer], pnt);
+            addPoint(entry.coords, pnt);
         }
 
         Base::Vector3d pnt = geo->value(0);
-        addPoint(Coords[coinLayer][subLayer], pnt);
+        addPoint(entry.coords, pnt);
 
-        Index[coinLayer][subLayer].push_back(numSegments + 1);
+        entry.hasCurve = true;
     }
     else if constexpr (curvemode == CurveMode::OpenCurve) {
         int numSegments = drawingParameters.curvedEdgeCountSegments;
@@ -364,13 +496,13 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
 
         for (int i = 0; i < numSegments; i++) {
             Base::Vector3d pnt = geo->value(geo->getFirstParameter() + i * segment);
-            addPoint(Coords[coinLayer][subLayer], pnt);
+            addPoint(entry.coords, pnt);
         }
 
         Base::Vector3d pnt = geo->value(geo->getLastParameter());
-        addPoint(Coords[coinLayer][subLayer], pnt);
+        addPoint(entry.coords, pnt);
 
-        Index[coinLayer][subLayer].push_back(numSegments + 1);
+        entry.hasCurve = true;
 
         if constexpr (analysemode == AnalyseMode::BoundingBoxMagnitudeAndBSplineCurvature) {
             //***************************************************************************************************************
@@ -437,8 +569,8 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
                     / maxcurv;  // just a factor to make a comb reasonably visible
             }
 
-            if (temprepscale > combrepscale) {
-                combrepscale = temprepscale;
+            if (temprepscale > entry.combRepScale) {
+                entry.combRepScale = temprepscale;
             }
         }
     }
@@ -23,6 +23,7 @@
 #ifndef SKETCHERGUI_GeometryCoinConverter_H
 #define SKETCHERGUI_GeometryCoinConverter_H
 
+#include <memory>
 #include <vector>
 
 #include "ViewProviderSketch.h"
@@ -70,6 +71,11 @@ struct CoinMapping;
  *
  * Analysis performs analysis such as maximum boundingbox magnitude of all geometries and maximum
  * curvature of BSplines
+ *
+ * The points and curve vertices of each geometry are kept in a Cache provided by the caller, so
+ * that a conversion only evaluates the geometries that changed since the previous one. If the
+ * number of points and vertices of every layer is unchanged, only the coin field values of the
+ * changed geometries are rewritten.
  */
 class EditModeGeometryCoinConverter
 {
@@ -99,6 +105,38 @@ private:
     };
 
 public:
+    /** Points and curve vertices generated for each geometry by the last conversion. It outlives
+     * the converter, which is created for each conversion.
+     */
+    struct Cache
+    {
+        struct Entry
+        {
+            std::unique_ptr<Part::Geometry> geometry;  // copy of the converted geometry
+            int geoId = 0;
+            int coinLayer = 0;
+            int subLayer = 0;
+            PointsMode pointMode = PointsMode::InsertSingle;
+            bool hasCurve = false;
+            std::vector<Base::Vector3d> points;
+            std::vector<Base::Vector3d> coords;
+            float maxMagnitude = 0;
+            double combRepScale = 0;
+        };
+
+        void clear();
+
+        // indexed by the position of the geometry in the geometry list
+        std::vector<Entry> entries;
+
+        // parameters the entries were generated with
+        int curvedEdgeCountSegments = 0;
+        int coinLayerCount = 0;
+        int subLayerCount = 0;
+        double linez = 0;
+        double pointz = 0;
+    };
+
     /** Constructs an GeometryCoinConverter responsible for
      * generating the points and line sets for drawing the geometry
      * defined by a GeometryLayer into the coin nodes provided by
@@ -108,12 +146,15 @@ public:
      * the geometry
      *
      * @param drawingparameters: Parameters for drawing the overlay information
+     *
+     * @param geometryCache: The result of the previous conversion into the same nodes
      */
     EditModeGeometryCoinConverter(ViewProviderSketch& vp,
                                   GeometryLayerNodes& geometrylayernodes,
                                   DrawingParameters& drawingparameters,
                                   GeometryLayerParameters& geometryLayerParams,
-                                  CoinMapping& coinMap);
+                                  CoinMapping& coinMap,
+                                  Cache& geometryCache);
 
     /**
      * converts the geometry defined by GeometryLayer into the coin nodes.
@@ -150,11 +191,22 @@ public:
         return std::move(arcGeoIds);
     }
 
+    /**
+     * returns the GeoIds of the geometries whose points or curves were generated anew, sorted
+     */
+    auto getChangedGeoIds()
+    {
+        return std::move(changedGeoIds);
+    }
+
 private:
     template<typename GeoType, PointsMode pointmode, CurveMode curvemode, AnalyseMode analysemode>
     void convert(const Sketcher::GeometryFacade* geometryfacade,
                  [[maybe_unused]] int geoId,
-                 int subLayerId = 0);
+                 Cache::Entry& entry);
+
+    /// rebuilds the coin mapping of all the geometries from the cache entries
+    void rebuildCoinMapping();
 
 private:
     /// Reference to ViewProviderSketch in order to access the public and the Attorney Interface
@@ -162,10 +214,6 @@ private:
 
     GeometryLayerNodes& geometryLayerNodes;
 
-    std::vector<std::vector<Base::Vector3d>> Points;
-    std::vector<std::vector<std::vector<Base::Vector3d>>> Coords;
-    std::vector<std::vector<std::vector<unsigned int>>> Index;
-
     // temporal counters, one per layer
     std::vector<int> pointCounter;
 
@@ -178,12 +226,15 @@ private:
     // Mappings coin geoId
     CoinMapping& coinMapping;
 
+    Cache& cache;
+
     // measurements
     float boundingBoxMaxMagnitude = 100;
     double combrepscale =
         0;  // the repscale that would correspond to this comb based only on this calculation.
     std::vector<int> bsplineGeoIds;
     std::vector<int> arcGeoIds;
+    std::vector<int> changedGeoIds;
 };
 
 
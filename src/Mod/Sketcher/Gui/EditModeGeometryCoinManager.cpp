@@ -105,7 +105,8 @@ void EditModeGeometryCoinManager::processGeometry(const GeoListFacade& geolistfa
                                          geometrylayernodes,
                                          drawingParameters,
                                          geometryLayerParameters,
-                                         coinMapping);
+                                         coinMapping,
+                                         geometryCache);
 
     gcconv.convert(geolistfacade);
 
@@ -118,6 +119,7 @@ void EditModeGeometryCoinManager::processGeometry(const GeoListFacade& geolistfa
         exp(ceil(log(std::abs(gcconv.getBoundingBoxMaxMagnitude()))));
     analysisResults.bsplineGeoIds = gcconv.getBSplineGeoIds();
     analysisResults.arcGeoIds = gcconv.getArcGeoIds();
+    analysisResults.changedGeoIds = gcconv.getChangedGeoIds();
 }
 
 void EditModeGeometryCoinManager::updateGeometryColor(const GeoListFacade& geolistfacade,
@@ -472,6 +474,13 @@ void EditModeGeometryCoinManager::updateGeometryLayersConfiguration()
     emptyGeometryRootNodes();
     createEditModePointInventorNodes();
     createEditModeCurveInventorNodes();
+
+    clearGeometryCache();
+}
+
+void EditModeGeometryCoinManager::clearGeometryCache()
+{
+    geometryCache.clear();
 }
 
 auto concat(std::string string, int i)
@@ -29,6 +29,7 @@
 #include <Mod/Sketcher/App/GeoList.h>
 
 #include "EditModeCoinManagerParameters.h"
+#include "EditModeGeometryCoinConverter.h"
 
 
 class SbVec3f;
@@ -102,6 +103,9 @@ public:
 
     void updateGeometryLayersConfiguration();
 
+    /// forces the next processGeometry to convert all the geometry anew
+    void clearGeometryCache();
+
     /** @name coin nodes creation*/
     void createEditModeInventorNodes();
     //@}
@@ -122,6 +126,9 @@ private:
     EditModeScenegraphNodes& editModeScenegraphNodes;
 
     CoinMapping& coinMapping;
+
+    // result of the previous conversion, so that only changed geometries are converted again
+    EditModeGeometryCoinConverter::Cache geometryCache;
 };
 
 
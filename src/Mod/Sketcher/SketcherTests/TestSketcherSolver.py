@@ -21,7 +21,7 @@
 # **************************************************************************
 
 
-import FreeCAD, os, sys, unittest, Part, Sketcher
+import FreeCAD, math, os, sys, unittest, Part, Sketcher
 from Part import Precision
 
 App = FreeCAD
@@ -480,6 +480,30 @@ class TestSketcherSolver(unittest.TestCase):
             msg="Reference constraint did not return the expected distance.",
         )
 
+    def testSetDatumSequence(self):
+        sketch = self.Doc.addObject("Sketcher::SketchObject", "Sketch")
+        l_idx = sketch.addGeometry(Part.LineSegment(vec(0, 0), vec(10, 5)))
+        angle = math.radians(30)
+        sketch.addConstraint(
+            [
+                Sketcher.Constraint("Coincident", l_idx, 1, -1, 1),
+                Sketcher.Constraint("Angle", l_idx, angle),
+            ]
+        )
+        dist_idx = sketch.addConstraint(Sketcher.Constraint("Distance", l_idx, 10.0))
+        # the reference constraint has to follow each datum change
+        ref_idx = sketch.addConstraint([Sketcher.Constraint("DistanceX", l_idx, 1.0)])[0]
+        sketch.setDriving(ref_idx, False)
+        self.assertSuccessfulSolve(sketch)
+        for length in (20.0, 35.0, 12.5):
+            self.assertEqual(sketch.setDatum(dist_idx, length), 0)
+            self.assertAlmostEqual(sketch.Geometry[l_idx].length(), length, 6)
+            self.assertAlmostEqual(sketch.Constraints[ref_idx].Value, length * math.cos(angle), 6)
+        self.assertEqual(sketch.setDatum(1, math.radians(45)), 0)
+        end = sketch.Geometry[l_idx].EndPoint
+        self.assertAlmostEqual(end.x, end.y, 6)
+        self.assertAlmostEqual(sketch.Geometry[l_idx].length(), 12.5, 6)
+
     def assertSuccessfulSolve(self, sketch, msg=None):
         status = sketch.solve()
         # TODO: can we get the solver's messages somehow to improve the message?
@@ -20,7 +20,14 @@
 #   USA                                                                   *
 # **************************************************************************
 
-# import FreeCAD, FreeCADGui, os, sys, unittest, Sketcher, SketcherGui
+import re
+import unittest
+
+import FreeCAD
+import FreeCADGui
+import Part
+import Sketcher
+from pivy import coin
 
 
 # ---------------------------------------------------------------------------
@@ -42,3 +49,78 @@
 #   def tearDown(self):
 #       #closing doc
 #       FreeCAD.closeDocument("SketchGuiTest")
+
+
+def findNodes(root, typeName):
+    """Returns all the nodes of the given type below root"""
+    search = coin.SoSearchAction()
+    search.setType(coin.SoType.fromName(typeName))
+    search.setInterest(coin.SoSearchAction.ALL)
+    search.setSearchingAll(True)
+    search.apply(root)
+    return [path.getTail() for path in search.getPaths()]
+
+
+def hasPoint(points, x, y, tol=1e-4):
+    return any(abs(p[0] - x) < tol and abs(p[1] - y) < tol for p in points)
+
+
+class SketcherGuiEditModeTestCases(unittest.TestCase):
+    """Checks that the edit mode scene graph follows the changes of the sketch"""
+
+    def setUp(self):
+        self.Doc = FreeCAD.newDocument("SketchGuiTest")
+        self.Sketch = self.Doc.addObject("Sketcher::SketchObject", "Sketch")
+        self.Sketch.addGeometry(
+            Part.LineSegment(FreeCAD.Vector(0, 0, 0), FreeCAD.Vector(10, 0, 0)), False
+        )
+        self.Sketch.addGeometry(Part.Circle(FreeCAD.Vector(30, 0, 0), FreeCAD.Vector(0, 0, 1), 5))
+        self.Sketch.addConstraint(Sketcher.Constraint("Coincident", 0, 1, -1, 1))
+        self.Sketch.addConstraint(Sketcher.Constraint("Distance", 0, 10))
+        self.Sketch.setDriving(1, False)
+        self.Doc.recompute()
+        FreeCADGui.ActiveDocument.setEdit(self.Sketch.Name)
+        self.Root = FreeCADGui.ActiveDocument.ActiveView.getSceneGraph()
+
+    def getCoordinates(self):
+        """Returns the drawn points and curve vertices of the geometries"""
+        points = []
+        for node in findNodes(self.Root, "SoCoordinate3"):
+            name = node.getName().getString()
+            if name.startswith("PointsCoordinate") or name.startswith("CurvesCoordinate"):
+                points.extend(v.getValue() for v in node.point.getValues())
+        return points
+
+    def getDatumPoints(self):
+        labels = findNodes(self.Root, "SoDatumLabel")
+        self.assertEqual(len(labels), 1)
+        values = [float(v) for v in re.findall(r"[-+0-9.eE]+", labels[0].getField("pnts").get())]
+        return [values[i : i + 3] for i in range(0, len(values), 3)]
+
+    def movePoint(self, x, y):
+        self.Sketch.movePoint(0, 2, FreeCAD.Vector(x, y, 0))
+        FreeCADGui.updateGui()
+        points = self.getCoordinates()
+        self.assertTrue(hasPoint(points, x, y))
+        self.assertFalse(hasPoint(points, 10, 0))
+        # the circle is not changed, its center must still be drawn
+        self.assertTrue(hasPoint(points, 30, 0))
+        datum = self.getDatumPoints()
+        self.assertTrue(hasPoint(datum, 0, 0))
+        self.assertTrue(hasPoint(datum, x, y))
+
+    def testDragGeometry(self):
+        self.movePoint(5, 5)
+        # a second drag keeps the layout of the coin nodes and only rewrites the line
+        self.movePoint(7, 3)
+        # a new geometry changes the layout
+        self.Sketch.addGeometry(
+            Part.LineSegment(FreeCAD.Vector(0, 20, 0), FreeCAD.Vector(10, 20, 0)), False
+        )
+        FreeCADGui.updateGui()
+        self.assertTrue(hasPoint(self.getCoordinates(), 10, 20))
+        self.movePoint(2, 8)
+
+    def tearDown(self):
+        FreeCADGui.ActiveDocument.resetEdit()
+        FreeCAD.closeDocument("SketchGuiTest")
@@ -20,6 +20,8 @@
 
 #include "PreCompiled.h"
 
+#include <App/Application.h>
+#include <App/Document.h>
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 #include <Base/PyObjectBase.h>
@@ -56,7 +58,9 @@
 #include "DrawViewSymbol.h"
 #include "DrawWeldSymbol.h"
 #include "FeatureProjection.h"
+#include "HlrScheduler.h"
 #include "LandmarkDimension.h"
+#include "ProjectionCache.h"
 #include "PropertyCenterLineList.h"
 #include "PropertyCosmeticEdgeList.h"
 #include "PropertyCosmeticVertexList.h"
@@ -83,6 +87,16 @@ PyMOD_INIT_FUNC(TechDraw)
     PyObject* mod = TechDraw::initModule();
     Base::Console().Log("Loading TechDraw module... done\n");
 
+    // the scheduler has to be created in the main thread
+    TechDraw::HlrScheduler::instance();
+
+    // keep the projections of closed documents on disk instead of in memory
+    TechDraw::ProjectionCache::instance().setStoreDirectory(
+        App::Application::getUserCachePath() + "TechDraw/Projections");
+    App::GetApplication().signalDeleteDocument.connect([](const App::Document& doc) {
+        TechDraw::ProjectionCache::instance().releaseDocument(doc.getName());
+    });
+
     TechDraw::DrawPage            ::init();
     TechDraw::DrawView            ::init();
     TechDraw::DrawViewCollection  ::init();
@@ -36,6 +36,8 @@
 //    m_cutPieces = (baseShape - m_cuttingTool) (DVSCutPieces.brep)
 
 //onSectionCutFinished
+//    for Aligned, makeAlignedPieces runs in a separate thread first and
+//    onSectionCutFinished is called again when it has finished
 //    m_preparedShape = prepareShape(m_cutPieces)* - centered, scaled, rotated
 //    geometryObject = DVP::buildGeometryObject(m_preparedShape)  (HLR)
 
@@ -83,7 +85,6 @@
 #include <HLRAlgo_Projector.hxx>
 #include <QFuture>
 #include <QFutureWatcher>
-#include <QtConcurrentRun>
 #include <ShapeExtend_WireData.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -121,6 +122,7 @@
 #include "DrawComplexSection.h"
 #include "DrawUtil.h"
 #include "GeometryObject.h"
+#include "HlrScheduler.h"
 #include "ShapeUtils.h"
 
 using namespace TechDraw;
@@ -148,6 +150,12 @@ DrawComplexSection::DrawComplexSection()
                       "Make a single cut, or use the profile in pieces");
 }
 
+DrawComplexSection::~DrawComplexSection()
+{
+    //don't destroy this object while the aligned pieces are still being made
+    HlrScheduler::instance().cancelAll(this);
+}
+
 TopoDS_Shape DrawComplexSection::makeCuttingTool(double dMax)
 {
     //    Base::Console().Message("DCS::makeCuttingTool()\n");
@@ -277,23 +285,8 @@ void DrawComplexSection::makeSectionCut(const TopoDS_Shape& baseShape)
         return DrawViewSection::makeSectionCut(baseShape);
     }
 
-    try {
-        connectAlignWatcher =
-            QObject::connect(&m_alignWatcher, &QFutureWatcherBase::finished, &m_alignWatcher,
-                             [this] { this->onSectionCutFinished(); });
-
-        // We create a lambda closure to hold a copy of baseShape.
-        // This is important because this variable might be local to the calling
-        // function and might get destructed before the parallel processing finishes.
-        auto lambda = [this, baseShape]{this->makeAlignedPieces(baseShape);};
-        m_alignFuture = QtConcurrent::run(std::move(lambda));
-        m_alignWatcher.setFuture(m_alignFuture);
-        waitingForAlign(true);
-    }
-    catch (...) {
-        Base::Console().Message("DCS::makeSectionCut - failed to make alignedPieces");
-        return;
-    }
+    // the aligned pieces are made once the cut has finished, see onSectionCutFinished()
+    m_alignBaseShape = baseShape;
 
     return DrawViewSection::makeSectionCut(baseShape);
 }
@@ -303,15 +296,51 @@ void DrawComplexSection::onSectionCutFinished()
 {
     //    Base::Console().Message("DCS::onSectionCutFinished() - %s - cut: %d align: %d\n",
     //                            getNameInDocument(), m_cutFuture.isRunning(), m_alignFuture.isRunning());
-    if (m_cutFuture.isRunning() ||  //waitingForCut()
-        m_alignFuture.isRunning()) {//waitingForAlign()
+    if (waitingForAlign()) {
         //can not continue yet.  return until the other thread ends
         return;
     }
 
+    if (!m_alignBaseShape.IsNull()) {
+        makeAlignedPiecesLater();
+        return;
+    }
+
     DrawViewSection::onSectionCutFinished();
+}
+
+//! start making the aligned pieces in a separate thread. This runs in the main thread after
+//! the cut has finished.
+void DrawComplexSection::makeAlignedPiecesLater()
+{
+    TopoDS_Shape baseShape = m_alignBaseShape;
+    m_alignBaseShape.Nullify();
+
+    try {
+        connectAlignWatcher =
+            QObject::connect(&m_alignWatcher, &QFutureWatcherBase::finished, &m_alignWatcher,
+                             [this] {
+                                 this->waitingForAlign(false);
+                                 QObject::disconnect(connectAlignWatcher);
+                                 this->onSectionCutFinished();
+                             });
 
-    QObject::disconnect(connectAlignWatcher);
+        // We create a lambda closure to hold a copy of baseShape.
+        // This is important because this variable might be local to the calling
+        // function and might get destructed before the parallel processing finishes.
+        auto lambda = [this, baseShape]{this->makeAlignedPieces(baseShape);};
+        HlrScheduler::instance().submit(this, HlrScheduler::TaskType::Align, std::move(lambda),
+                                        [this](const QFuture<void>& future) {
+                                            m_alignFuture = future;
+                                            m_alignWatcher.setFuture(m_alignFuture);
+                                        });
+        waitingForAlign(true);
+    }
+    catch (...) {
+        QObject::disconnect(connectAlignWatcher);
+        Base::Console().Message("DCS::makeAlignedPiecesLater - failed to make alignedPieces");
+        DrawViewSection::onSectionCutFinished();
+    }
 }
 
 //for Aligned strategy, cut the rawShape by each segment of the tool
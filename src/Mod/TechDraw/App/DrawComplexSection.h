@@ -41,7 +41,7 @@ class TechDrawExport DrawComplexSection: public DrawViewSection
 
 public:
     DrawComplexSection();
-    ~DrawComplexSection() override = default;
+    ~DrawComplexSection() override;
 
     App::PropertyLink CuttingToolWireObject;
     App::PropertyEnumeration ProjectionStrategy;//Offset or Aligned
@@ -72,6 +72,7 @@ public Q_SLOTS:
     std::vector<TopoDS_Face> faceShapeIntersect(const TopoDS_Face& face, const TopoDS_Shape& shape);
     TopoDS_Shape extrudeWireToFace(TopoDS_Wire& wire, gp_Dir extrudeDir, double extrudeDist);
     void makeAlignedPieces(const TopoDS_Shape& rawShape);
+    void makeAlignedPiecesLater();
     TopoDS_Compound singleToolIntersections(const TopoDS_Shape& cutShape);
     TopoDS_Compound alignedToolIntersections(const TopoDS_Shape& cutShape);
 
@@ -104,12 +105,13 @@ private:
 
     TopoDS_Shape m_toolFaceShape;
     TopoDS_Shape m_alignResult;
+    TopoDS_Shape m_alignBaseShape;//set by the cut thread, read after the cut has finished
     TopoDS_Shape m_preparedShape;//saved for detail views
 
     QMetaObject::Connection connectAlignWatcher;
     QFutureWatcher<void> m_alignWatcher;
     QFuture<void> m_alignFuture;
-    bool m_waitingForAlign;
+    bool m_waitingForAlign {false};
 
     static const char* ProjectionStrategyEnums[];
 };
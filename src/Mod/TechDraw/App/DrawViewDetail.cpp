@@ -33,7 +33,6 @@
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
 #include <Bnd_Box.hxx>
-#include <QtConcurrentRun>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
@@ -59,6 +58,7 @@
 #include "DrawViewDetail.h"
 #include "DrawViewSection.h"
 #include "GeometryObject.h"
+#include "HlrScheduler.h"
 #include "Preferences.h"
 #include "ShapeUtils.h"
 
@@ -103,6 +103,7 @@ DrawViewDetail::DrawViewDetail() : m_waitingForDetail(false), m_saveDvp(nullptr)
 DrawViewDetail::~DrawViewDetail()
 {
     //don't delete this object while it still has dependent tasks running
+    HlrScheduler::instance().cancelAll(this);
     if (m_detailFuture.isRunning()) {
         Base::Console().Message("%s is waiting for detail cut to finish\n", Label.getValue());
         m_detailFuture.waitForFinished();
@@ -185,10 +186,19 @@ App::DocumentObjectExecReturn* DrawViewDetail::execute()
 //if there are no solids/shells in shape, use the edges in shape
 void DrawViewDetail::detailExec(TopoDS_Shape& shape, DrawViewPart* dvp, DrawViewSection* dvs)
 {
-    if (waitingForHlr() || waitingForDetail()) {
+    if (waitingForHlr()) {
         return;
     }
 
+    if (waitingForDetail()) {
+        //a detail that has not been started yet is obsolete now
+        if (!HlrScheduler::instance().cancel(this, HlrScheduler::TaskType::Detail)) {
+            return;
+        }
+        QObject::disconnect(connectDetailWatcher);
+        waitingForDetail(false);
+    }
+
     //note that &m_detailWatcher in the third parameter is not strictly required, but using the
     //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
     //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
@@ -201,8 +211,13 @@ void DrawViewDetail::detailExec(TopoDS_Shape& shape, DrawViewPart* dvp, DrawView
     // function and might get destructed before the parallel processing finishes.
     // TODO: What about dvp and dvs? Do they live past makeDetailShape?
     auto lambda = [this, shape, dvp, dvs]{this->makeDetailShape(shape, dvp, dvs);};
-    m_detailFuture = QtConcurrent::run(std::move(lambda));
-    m_detailWatcher.setFuture(m_detailFuture);
+    HlrScheduler::instance().expect(this, HlrScheduler::TaskType::Hlr);
+    HlrScheduler::instance().submit(this, HlrScheduler::TaskType::Detail, std::move(lambda),
+                                    [this](const QFuture<void>& future) {
+                                        m_detailFuture = future;
+                                        m_detailWatcher.setFuture(m_detailFuture);
+                                    },
+                                    {dvp});
     waitingForDetail(true);
 }
 
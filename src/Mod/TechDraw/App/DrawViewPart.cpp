@@ -48,7 +48,6 @@
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
 #include <HLRAlgo_Projector.hxx>
-#include <QtConcurrentRun>
 #include <ShapeAnalysis.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -87,8 +86,10 @@
 #include "EdgeWalker.h"
 #include "Geometry.h"
 #include "GeometryObject.h"
+#include "HlrScheduler.h"
 #include "ShapeExtractor.h"
 #include "Preferences.h"
+#include "ProjectionCache.h"
 #include "ShapeUtils.h"
 
 using namespace TechDraw;
@@ -153,6 +154,7 @@ DrawViewPart::DrawViewPart(void)
 DrawViewPart::~DrawViewPart()
 {
     //don't delete this object while it still has dependent threads running
+    HlrScheduler::instance().cancelAll(this);
     if (m_hlrFuture.isRunning()) {
         Base::Console().Message("%s is waiting for HLR to finish\n", Label.getValue());
         m_hlrFuture.waitForFinished();
@@ -228,7 +230,7 @@ App::DocumentObjectExecReturn* DrawViewPart::execute(void)
         return DrawView::execute();
     }
 
-    if (waitingForHlr()) {
+    if (waitingForHlr() && !HlrScheduler::instance().isQueued(this, HlrScheduler::TaskType::Hlr)) {
         return DrawView::execute();
     }
 
@@ -284,8 +286,13 @@ void DrawViewPart::partExec(TopoDS_Shape& shape)
 {
     //    Base::Console().Message("DVP::partExec() - %s\n", getNameInDocument());
     if (waitingForHlr()) {
-        //finish what we are already doing before starting a new cycle
-        return;
+        //a projection that has not been started yet is obsolete now. Otherwise finish what we
+        //are already doing before starting a new cycle
+        if (!HlrScheduler::instance().cancel(this, HlrScheduler::TaskType::Hlr)) {
+            return;
+        }
+        QObject::disconnect(connectHlrWatcher);
+        waitingForHlr(false);
     }
 
     //we need to keep using the old geometryObject until the new one is fully populated
@@ -309,11 +316,17 @@ GeometryObjectPtr DrawViewPart::makeGeometryForShape(TopoDS_Shape& shape)
     BRepBuilderAPI_Copy copier(shape, copyGeometry, copyMesh);
     TopoDS_Shape localShape = copier.Shape();
 
+    // the copy has new TShapes, so the projection is cached under the source shape
+    ProjectionKey key = ProjectionCache::makeKey(shape, getProjectionCS(), getScale(),
+                                                 Rotation.getValue(), IsoCount.getValue(),
+                                                 Perspective.getValue(), Focus.getValue());
+    key.document = getDocument()->getName();
+
     gp_Pnt gCentroid = ShapeUtils::findCentroid(localShape, getProjectionCS());
     m_saveCentroid = DU::toVector3d(gCentroid);
     m_saveShape = centerScaleRotate(this, localShape, m_saveCentroid);
 
-    return buildGeometryObject(localShape, getProjectionCS());
+    return buildGeometryObject(localShape, getProjectionCS(), key);
 }
 
 //! Modify a shape by centering, scaling and rotating and return the centered (but not rotated) shape
@@ -336,12 +349,19 @@ TopoDS_Shape DrawViewPart::centerScaleRotate(DrawViewPart* dvp, TopoDS_Shape& in
 }
 
 //! create a geometry object and trigger the HLR process in another thread
+//! the HLR result is looked up in the ProjectionCache under key, if it is not empty
 TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shape,
-                                                              const gp_Ax2& viewAxis)
+                                                              const gp_Ax2& viewAxis,
+                                                              const ProjectionKey& key)
 {
 //    Base::Console().Message("DVP::buildGeometryObject() - %s\n", getNameInDocument());
     showProgressMessage(getNameInDocument(), "is finding hidden lines");
 
+    //the preferences can not be read from the HLR thread
+    int cacheSize = std::max(Preferences::projectionCacheSize(), 0);
+    ProjectionCache::instance().setCapacity(static_cast<std::size_t>(cacheSize));
+    HlrScheduler::instance().setMaxThreads(Preferences::hlrThreadCount());
+
     TechDraw::GeometryObjectPtr go(
         std::make_shared<TechDraw::GeometryObject>(getNameInDocument(), this));
     go->setIsoCount(IsoCount.getValue());
@@ -349,10 +369,14 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     go->setFocus(Focus.getValue());
     go->usePolygonHLR(CoarseView.getValue());
     go->setScrubCount(ScrubCount.getValue());
+    if (!CoarseView.getValue()) {
+        go->setProjectionKey(key);
+    }
 
     if (CoarseView.getValue()) {
         //the polygon approximation HLR process runs quickly, so doesn't need to be in a
         //separate thread
+        HlrScheduler::instance().release(this, HlrScheduler::TaskType::Hlr);
         go->projectShapeWithPolygonAlgo(shape, viewAxis);
     }
     else {
@@ -366,9 +390,16 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         // We create a lambda closure to hold a copy of go, shape and viewAxis.
         // This is important because those variables might be local to the calling
         // function and might get destructed before the parallel processing finishes.
+        // the views that depend on this one have to wait for the faces, too
         auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
-        m_hlrFuture = QtConcurrent::run(std::move(lambda));
-        m_hlrWatcher.setFuture(m_hlrFuture);
+        if (handleFaces()) {
+            HlrScheduler::instance().expect(this, HlrScheduler::TaskType::Faces);
+        }
+        HlrScheduler::instance().submit(this, HlrScheduler::TaskType::Hlr, std::move(lambda),
+                                        [this](const QFuture<void>& future) {
+                                            m_hlrFuture = future;
+                                            m_hlrWatcher.setFuture(m_hlrFuture);
+                                        });
         waitingForHlr(true);
     }
     return go;
@@ -385,6 +416,7 @@ void DrawViewPart::onHlrFinished(void)
         m_tempGeometryObject = nullptr;       //superfluous?
     }
     if (!geometryObject) {
+        HlrScheduler::instance().release(this, HlrScheduler::TaskType::Faces);
         throw Base::RuntimeError("DrawViewPart has lost its geometry");
     }
 
@@ -409,17 +441,24 @@ void DrawViewPart::onHlrFinished(void)
                                  [this] { this->onFacesFinished(); });
 
             auto lambda = [this]{this->extractFaces();};
-            m_faceFuture = QtConcurrent::run(std::move(lambda));
-            m_faceWatcher.setFuture(m_faceFuture);
+            HlrScheduler::instance().submit(this, HlrScheduler::TaskType::Faces, std::move(lambda),
+                                            [this](const QFuture<void>& future) {
+                                                m_faceFuture = future;
+                                                m_faceWatcher.setFuture(m_faceFuture);
+                                            });
             waitingForFaces(true);
         }
         catch (Standard_Failure& e) {
             waitingForFaces(false);
+            HlrScheduler::instance().release(this, HlrScheduler::TaskType::Faces);
             Base::Console().Error("DVP::partExec - %s - extractFaces failed - %s **\n",
                                   getNameInDocument(), e.GetMessageString());
             throw Base::RuntimeError("DVP::onHlrFinished - error extracting faces");
         }
     }
+    else {
+        HlrScheduler::instance().release(this, HlrScheduler::TaskType::Faces);
+    }
 }
 
 //! run any tasks that need to been done after geometry is available
@@ -496,23 +535,63 @@ void DrawViewPart::extractFaces()
         return;
     }
 
-    if (newFaceFinder()) {
-        findFacesNew(goEdges);
-    } else {
-        findFacesOld(goEdges);
+    // face finding is expensive, so reuse the faces of an earlier run on the same projection
+    std::vector<TopoDS_Wire> faceWires;
+    bool newFinder = newFaceFinder();
+    ProjectionKey faceKey = makeFaceKey(goEdges, newFinder);
+    if (faceKey.empty() || !ProjectionCache::instance().findFaces(faceKey, faceWires)) {
+        if (newFinder) {
+            faceWires = findFacesNew(goEdges);
+        } else {
+            faceWires = findFacesOld(goEdges);
+        }
+        if (!faceKey.empty()) {
+            ProjectionCache::instance().addFaces(faceKey, faceWires);
+        }
+    }
+
+    geometryObject->clearFaceGeom();
+    for (auto& wire : faceWires) {
+        TechDraw::FacePtr f(std::make_shared<TechDraw::Face>());
+        f->wires.push_back(new TechDraw::Wire(wire));
+        geometryObject->addFaceGeom(f);
+    }
+}
+
+//! make the key for the faces in the ProjectionCache. The key is empty if the faces can
+//! not be cached because they depend on cosmetic edges or the cache is disabled.
+ProjectionKey DrawViewPart::makeFaceKey(const std::vector<TechDraw::BaseGeomPtr>& goEdges,
+                                        bool newFinder)
+{
+    ProjectionKey faceKey = geometryObject->getProjectionKey();
+    if (faceKey.empty()) {
+        return {};
+    }
+
+    for (auto& e : goEdges) {
+        if (e->getCosmetic() || e->source() != 0) {
+            return {};
+        }
     }
+
+    std::stringstream params;
+    params << ":faces:" << SmoothVisible.getValue() << SeamVisible.getValue()
+           << newFinder << ':' << ScrubCount.getValue();
+    faceKey.params += params.str();
+    return faceKey;
 }
 
 // use the revised face finder algo
-void DrawViewPart::findFacesNew(const std::vector<BaseGeomPtr> &goEdges)
+std::vector<TopoDS_Wire> DrawViewPart::findFacesNew(const std::vector<BaseGeomPtr> &goEdges)
 {
+    std::vector<TopoDS_Wire> faceWires;
     std::vector<TopoDS_Edge> closedEdges;
     std::vector<TopoDS_Edge> cleanEdges = DrawProjectSplit::scrubEdges(goEdges, closedEdges);
 
     if (cleanEdges.empty() && closedEdges.empty()) {
         //how does this happen?  something wrong somewhere
         //            Base::Console().Message("DVP::findFacesNew - no clean or closed wires\n");    //debug
-        return;
+        return faceWires;
     }
 
     //use EdgeWalker to make wires from edges
@@ -526,7 +605,6 @@ void DrawViewPart::findFacesNew(const std::vector<BaseGeomPtr> &goEdges)
     catch (Base::Exception& e) {
         throw Base::RuntimeError(e.what());
     }
-    geometryObject->clearFaceGeom();
 
     std::vector<TopoDS_Wire> closedWires;
     for (auto& e : closedEdges) {
@@ -559,18 +637,14 @@ void DrawViewPart::findFacesNew(const std::vector<BaseGeomPtr> &goEdges)
                 continue;//can not make a face from wire with no area
             }
 
-            TechDraw::FacePtr f(std::make_shared<TechDraw::Face>());
-            const TopoDS_Wire& wire = (*itWire);
-            f->wires.push_back(new TechDraw::Wire(wire));
-            if (geometryObject) {
-                geometryObject->addFaceGeom(f);
-            }
+            faceWires.push_back(*itWire);
         }
     }
+    return faceWires;
 }
 
 // original face finding method
-void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
+std::vector<TopoDS_Wire> DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
 {
     //make a copy of the input edges so the loose tolerances of face finding are
     //not applied to the real edge geometry.  See TopoDS_Shape::TShape().
@@ -652,14 +726,13 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
     std::vector<TopoDS_Edge> newEdges = DrawProjectSplit::splitEdges(nonZero, sorted);
 
     if (newEdges.empty()) {
-        return;
+        return {};
     }
 
     newEdges = DrawProjectSplit::removeDuplicateEdges(newEdges);
 
-    geometryObject->clearFaceGeom();
-
     //find all the wires in the pile of faceEdges
+    //version 1: 1 wire/face - no voids in face
     std::vector<TopoDS_Wire> sortedWires;
     EdgeWalker eWalker;
     sortedWires = eWalker.execute(newEdges);
@@ -667,21 +740,8 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
         Base::Console().Warning(
             "DVP::findFacesOld - %s -Can't make faces from projected edges\n",
             getNameInDocument());
-        return;
-    }
-    else {
-        std::vector<TopoDS_Wire>::iterator itWire = sortedWires.begin();
-        for (; itWire != sortedWires.end(); itWire++) {
-            //version 1: 1 wire/face - no voids in face
-            TechDraw::FacePtr f(std::make_shared<TechDraw::Face>());
-            const TopoDS_Wire& wire = (*itWire);
-            TechDraw::Wire* w = new TechDraw::Wire(wire);
-            f->wires.push_back(w);
-            if (geometryObject) {
-                geometryObject->addFaceGeom(f);
-            }
-        }
     }
+    return sortedWires;
 }
 
 //continue processing after extractFaces thread completes
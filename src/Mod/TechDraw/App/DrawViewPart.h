@@ -39,6 +39,7 @@
 
 #include "CosmeticExtension.h"
 #include "DrawView.h"
+#include "ProjectionCache.h"
 
 
 class gp_Pnt;
@@ -222,14 +223,16 @@ protected:
     void unsetupObject() override;
 
     virtual TechDraw::GeometryObjectPtr buildGeometryObject(TopoDS_Shape& shape,
-                                                            const gp_Ax2& viewAxis);
+                                                            const gp_Ax2& viewAxis,
+                                                            const ProjectionKey& key = ProjectionKey());
     virtual TechDraw::GeometryObjectPtr makeGeometryForShape(TopoDS_Shape& shape);//const??
     void partExec(TopoDS_Shape& shape);
     virtual void addPoints(void);
 
     void extractFaces();
-    void findFacesNew(const std::vector<TechDraw::BaseGeomPtr>& goEdges);
-    void findFacesOld(const std::vector<TechDraw::BaseGeomPtr>& goEdges);
+    std::vector<TopoDS_Wire> findFacesNew(const std::vector<TechDraw::BaseGeomPtr>& goEdges);
+    std::vector<TopoDS_Wire> findFacesOld(const std::vector<TechDraw::BaseGeomPtr>& goEdges);
+    ProjectionKey makeFaceKey(const std::vector<TechDraw::BaseGeomPtr>& goEdges, bool newFinder);
 
     Base::Vector3d shapeCentroid;
 
@@ -56,7 +56,6 @@
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
 #include <Bnd_Box.hxx>
-#include <QtConcurrentRun>
 #include <ShapeAnalysis.hxx>
 #include <ShapeFix_Shape.hxx>
 #include <TopExp.hxx>
@@ -89,6 +88,7 @@
 #include "DrawViewDetail.h"
 #include "EdgeWalker.h"
 #include "GeometryObject.h"
+#include "HlrScheduler.h"
 #include "Preferences.h"
 
 #include "DrawViewSection.h"
@@ -257,6 +257,7 @@ DrawViewSection::DrawViewSection()
 DrawViewSection::~DrawViewSection()
 {
     // don't destroy this object while it has dependent threads running
+    HlrScheduler::instance().cancelAll(this);
     if (m_cutFuture.isRunning()) {
         Base::Console().Message("%s is waiting for tasks to complete\n", Label.getValue());
         m_cutFuture.waitForFinished();
@@ -394,7 +395,8 @@ App::DocumentObjectExecReturn* DrawViewSection::execute()
         return new App::DocumentObjectExecReturn("BaseView object not found");
     }
 
-    if (waitingForCut() || waitingForHlr()) {
+    bool cutQueued = HlrScheduler::instance().isQueued(this, HlrScheduler::TaskType::Cut);
+    if ((waitingForCut() && !cutQueued) || waitingForHlr()) {
         return DrawView::execute();
     }
 
@@ -449,10 +451,19 @@ void DrawViewSection::sectionExec(TopoDS_Shape& baseShape)
     //    %d\n",
     //                            getNameInDocument(), baseShape.IsNull());
 
-    if (waitingForHlr() || waitingForCut()) {
+    if (waitingForHlr()) {
         return;
     }
 
+    if (waitingForCut()) {
+        // a cut that has not been started yet is obsolete now
+        if (!HlrScheduler::instance().cancel(this, HlrScheduler::TaskType::Cut)) {
+            return;
+        }
+        QObject::disconnect(connectCutWatcher);
+        waitingForCut(false);
+    }
+
     if (baseShape.IsNull()) {
         // should be caught before this
         return;
@@ -473,9 +484,20 @@ void DrawViewSection::sectionExec(TopoDS_Shape& baseShape)
         // We create a lambda closure to hold a copy of baseShape.
         // This is important because this variable might be local to the calling
         // function and might get destructed before the parallel processing finishes.
+        // the cut is not started before the base view has finished its own tasks. The
+        // views that depend on this one have to wait for the HLR task that follows the cut.
         auto lambda = [this, baseShape]{this->makeSectionCut(baseShape);};
-        m_cutFuture = QtConcurrent::run(std::move(lambda));
-        m_cutWatcher.setFuture(m_cutFuture);
+        std::vector<const DrawView*> dependencies;
+        if (isBaseValid()) {
+            dependencies.push_back(static_cast<DrawView*>(BaseView.getValue()));
+        }
+        HlrScheduler::instance().expect(this, HlrScheduler::TaskType::Hlr);
+        HlrScheduler::instance().submit(this, HlrScheduler::TaskType::Cut, std::move(lambda),
+                                        [this](const QFuture<void>& future) {
+                                            m_cutFuture = future;
+                                            m_cutWatcher.setFuture(m_cutFuture);
+                                        },
+                                        dependencies);
         waitingForCut(true);
     }
     catch (...) {
@@ -145,6 +145,20 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
 //    Base::Console().Message("GO::projectShape()\n");
     clear();
 
+    // reuse the result of an earlier projection of the same source shape
+    ProjectionCache& cache = ProjectionCache::instance();
+    if (cache.capacity() == 0) {
+        m_projectionKey = ProjectionKey();
+    }
+    if (!m_projectionKey.empty()) {
+        HlrResult cached;
+        if (cache.findProjection(m_projectionKey, cached)) {
+            setHlrResult(cached);
+            makeTDGeometry();
+            return;
+        }
+    }
+
     Handle(HLRBRep_Algo) brep_hlr;
     try {
         brep_hlr = new HLRBRep_Algo();
@@ -245,9 +259,43 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
             "GeometryObject::projectShape - unknown error occurred while extracting edges");
     }
 
+    if (!m_projectionKey.empty()) {
+        cache.addProjection(m_projectionKey, getHlrResult());
+    }
+
     makeTDGeometry();
 }
 
+HlrResult GeometryObject::getHlrResult() const
+{
+    HlrResult result;
+    result.visHard = visHard;
+    result.visOutline = visOutline;
+    result.visSmooth = visSmooth;
+    result.visSeam = visSeam;
+    result.visIso = visIso;
+    result.hidHard = hidHard;
+    result.hidOutline = hidOutline;
+    result.hidSmooth = hidSmooth;
+    result.hidSeam = hidSeam;
+    result.hidIso = hidIso;
+    return result;
+}
+
+void GeometryObject::setHlrResult(const HlrResult& result)
+{
+    visHard = result.visHard;
+    visOutline = result.visOutline;
+    visSmooth = result.visSmooth;
+    visSeam = result.visSeam;
+    visIso = result.visIso;
+    hidHard = result.hidHard;
+    hidOutline = result.hidOutline;
+    hidSmooth = result.hidSmooth;
+    hidSeam = result.hidSeam;
+    hidIso = result.hidIso;
+}
+
 //convert the hlr output into TD Geometry
 void GeometryObject::makeTDGeometry()
 {
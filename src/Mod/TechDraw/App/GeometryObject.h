@@ -41,6 +41,7 @@
 #include <Base/Vector3D.h>
 
 #include "Geometry.h"
+#include "ProjectionCache.h"
 #include "ShapeUtils.h"
 
 
@@ -98,7 +99,9 @@ public:
     void setFocus(double f) { m_focus = f; }
     double getFocus() { return m_focus; }
     void setScrubCount(int count) { m_scrubCount = count; }
-
+    //! the key of the projection in the ProjectionCache, empty if it is not cached
+    void setProjectionKey(const ProjectionKey& key) { m_projectionKey = key; }
+    const ProjectionKey& getProjectionKey() const { return m_projectionKey; }
 
     void pruneVertexGeom(Base::Vector3d center, double radius);
 
@@ -141,6 +144,9 @@ protected:
     TopoDS_Shape hidSeam;
     TopoDS_Shape hidIso;
 
+    HlrResult getHlrResult() const;
+    void setHlrResult(const HlrResult& result);
+
     void addGeomFromCompound(TopoDS_Shape edgeCompound, edgeClass category, bool visible);
     TechDraw::DrawViewDetail* isParentDetail();
 
@@ -165,6 +171,7 @@ protected:
     double m_focus;
     bool m_usePolygonHLR;
     int m_scrubCount;
+    ProjectionKey m_projectionKey;
 };
 
 using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
@@ -0,0 +1,289 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <QThread>
+#include <QtConcurrentRun>
+#endif
+
+#include "DrawView.h"
+#include "HlrScheduler.h"
+
+
+using namespace TechDraw;
+
+HlrScheduler& HlrScheduler::instance()
+{
+    static HlrScheduler scheduler;
+    return scheduler;
+}
+
+HlrScheduler::HlrScheduler()
+    : m_maxThreads(std::max(QThread::idealThreadCount(), 1))
+{
+    m_pool.setMaxThreadCount(m_maxThreads);
+}
+
+int HlrScheduler::maxThreads()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_maxThreads;
+}
+
+//! a count <= 0 uses as many threads as there are cores
+void HlrScheduler::setMaxThreads(int count)
+{
+    if (count <= 0) {
+        count = std::max(QThread::idealThreadCount(), 1);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (count == m_maxThreads) {
+            return;
+        }
+        m_maxThreads = count;
+        m_pool.setMaxThreadCount(count);
+    }
+
+    dispatch();
+}
+
+//! queue a task for owner. A task of the same type that owner has queued before is obsolete
+//! and gets dropped. The visibility of owner is read here, so this runs in the main thread.
+void HlrScheduler::submit(const DrawView* owner,
+                          TaskType type,
+                          Work work,
+                          StartHandler onStart,
+                          const std::vector<const DrawView*>& dependencies)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queued.remove_if([owner, type](const Task& task) {
+            return task.owner == owner && task.type == type;
+        });
+
+        Task task;
+        task.id = ++m_nextId;
+        task.owner = owner;
+        task.type = type;
+        task.priority = owner->Visibility.getValue() ? 1 : 0;
+        task.work = std::move(work);
+        task.onStart = std::move(onStart);
+        task.dependencies = dependencies;
+        m_queued.push_back(std::move(task));
+        m_expected.erase({owner, type});
+    }
+
+    dispatch();
+}
+
+void HlrScheduler::expect(const DrawView* owner, TaskType type)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_expected.insert({owner, type});
+}
+
+//! withdraw an expected task that owner is not going to submit
+void HlrScheduler::release(const DrawView* owner, TaskType type)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_expected.erase({owner, type}) == 0) {
+            return;
+        }
+    }
+
+    dispatch();
+}
+
+bool HlrScheduler::cancel(const DrawView* owner, TaskType type)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = std::find_if(m_queued.begin(), m_queued.end(), [owner, type](const Task& task) {
+        return task.owner == owner && task.type == type;
+    });
+    if (it == m_queued.end()) {
+        return false;
+    }
+
+    m_queued.erase(it);
+    return true;
+}
+
+void HlrScheduler::cancelAll(const DrawView* owner)
+{
+    std::vector<QFuture<void>> running;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queued.remove_if([owner](const Task& task) {
+            return task.owner == owner;
+        });
+        for (auto it = m_expected.begin(); it != m_expected.end();) {
+            it = it->first == owner ? m_expected.erase(it) : std::next(it);
+        }
+        for (auto& it : m_running) {
+            if (it.second.owner == owner) {
+                it.second.onStart = nullptr;
+                running.push_back(it.second.future);
+            }
+        }
+    }
+
+    for (auto& future : running) {
+        future.waitForFinished();
+    }
+}
+
+bool HlrScheduler::isQueued(const DrawView* owner, TaskType type)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::any_of(m_queued.begin(), m_queued.end(), [owner, type](const Task& task) {
+        return task.owner == owner && task.type == type;
+    });
+}
+
+//! true if view has a task that is queued, running or expected. Needs the lock.
+bool HlrScheduler::isBusy(const DrawView* view) const
+{
+    auto expected = m_expected.lower_bound({view, TaskType::Hlr});
+    if (expected != m_expected.end() && expected->first == view) {
+        return true;
+    }
+
+    auto ownedByView = [view](const Task& task) {
+        return task.owner == view;
+    };
+    if (std::any_of(m_queued.begin(), m_queued.end(), ownedByView)) {
+        return true;
+    }
+    return std::any_of(m_running.begin(), m_running.end(), [&ownedByView](const auto& it) {
+        return ownedByView(it.second);
+    });
+}
+
+//! start queued tasks until all threads are busy
+void HlrScheduler::dispatch()
+{
+    std::vector<std::uint64_t> started;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        while (int(m_running.size()) < m_maxThreads) {
+            // the oldest ready task of the highest priority
+            auto next = m_queued.end();
+            for (auto it = m_queued.begin(); it != m_queued.end(); ++it) {
+                if (next != m_queued.end() && it->priority <= next->priority) {
+                    continue;
+                }
+                bool ready = std::none_of(it->dependencies.begin(),
+                                          it->dependencies.end(),
+                                          [this](const DrawView* view) {
+                                              return isBusy(view);
+                                          });
+                if (ready) {
+                    next = it;
+                }
+            }
+            if (next == m_queued.end()) {
+                break;
+            }
+
+            Task task = std::move(*next);
+            m_queued.erase(next);
+
+            std::uint64_t id = task.id;
+            Work work = task.work;
+            auto lambda = [this, id, work] {
+                // the scheduler's bookkeeping is done in the main thread
+                auto notify = [this, id] {
+                    QMetaObject::invokeMethod(
+                        &m_context,
+                        [this, id] {
+                            onTaskFinished(id);
+                        },
+                        Qt::QueuedConnection);
+                };
+                try {
+                    work();
+                }
+                catch (...) {
+                    notify();
+                    throw;
+                }
+                notify();
+            };
+            task.future = QtConcurrent::run(&m_pool, std::move(lambda));
+            m_running.emplace(id, std::move(task));
+            started.push_back(id);
+        }
+    }
+
+    bool inMainThread = QThread::currentThread() == m_context.thread();
+    for (auto id : started) {
+        if (inMainThread) {
+            deliver(id);
+        }
+        else {
+            QMetaObject::invokeMethod(
+                &m_context,
+                [this, id] {
+                    deliver(id);
+                },
+                Qt::QueuedConnection);
+        }
+    }
+}
+
+//! pass the future of a started task to its owner
+void HlrScheduler::deliver(std::uint64_t id)
+{
+    StartHandler onStart;
+    QFuture<void> future;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_running.find(id);
+        if (it == m_running.end() || !it->second.onStart) {
+            return;
+        }
+        onStart = std::move(it->second.onStart);
+        it->second.onStart = nullptr;
+        future = it->second.future;
+    }
+
+    onStart(future);
+}
+
+void HlrScheduler::onTaskFinished(std::uint64_t id)
+{
+    // the owner must get the future even if the task finished before it was delivered
+    deliver(id);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running.erase(id);
+    }
+
+    dispatch();
+}
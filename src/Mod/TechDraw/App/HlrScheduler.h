@@ -0,0 +1,120 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef TECHDRAW_HLRSCHEDULER_H
+#define TECHDRAW_HLRSCHEDULER_H
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <QFuture>
+#include <QObject>
+#include <QThreadPool>
+
+//! runs the long running tasks of the views (hidden line removal, face finding, section
+//  and detail cuts) in a thread pool of its own. At most maxThreads() tasks run at the same
+//  time, tasks of visible views are started first and a task is held back while one of the
+//  views it depends on still has a task queued, running or expected.
+//  All functions except maxThreads() have to be called from the main thread.
+
+namespace TechDraw
+{
+
+class DrawView;
+
+class TechDrawExport HlrScheduler
+{
+public:
+    enum class TaskType
+    {
+        Hlr,
+        Faces,
+        Cut,
+        Align,
+        Detail
+    };
+
+    using Work = std::function<void()>;
+    //! receives the future of a task once it is started, always called in the main thread
+    using StartHandler = std::function<void(const QFuture<void>&)>;
+
+    static HlrScheduler& instance();
+
+    void submit(const DrawView* owner,
+                TaskType type,
+                Work work,
+                StartHandler onStart,
+                const std::vector<const DrawView*>& dependencies = {});
+    //! announce that owner will submit a task of type once its current task is finished.
+    //! The views depending on owner are held back until the task is submitted or released.
+    void expect(const DrawView* owner, TaskType type);
+    void release(const DrawView* owner, TaskType type);
+    //! removes a task that has not been started yet. Returns false if there is none.
+    bool cancel(const DrawView* owner, TaskType type);
+    //! removes the queued tasks of owner and waits for its running tasks to finish
+    void cancelAll(const DrawView* owner);
+    bool isQueued(const DrawView* owner, TaskType type);
+
+    int maxThreads();
+    void setMaxThreads(int count);
+
+private:
+    HlrScheduler();
+
+    struct Task
+    {
+        std::uint64_t id {0};
+        const DrawView* owner {nullptr};
+        TaskType type {TaskType::Hlr};
+        int priority {0};
+        Work work;
+        StartHandler onStart;
+        std::vector<const DrawView*> dependencies;
+        QFuture<void> future;
+    };
+
+    bool isBusy(const DrawView* view) const;
+    void dispatch();
+    void deliver(std::uint64_t id);
+    void onTaskFinished(std::uint64_t id);
+
+    std::mutex m_mutex;
+    QObject m_context;// lives in the main thread
+    QThreadPool m_pool;
+    int m_maxThreads;
+    std::uint64_t m_nextId {0};
+    std::list<Task> m_queued;
+    std::map<std::uint64_t, Task> m_running;
+    std::set<std::pair<const DrawView*, TaskType>> m_expected;
+};
+
+}// namespace TechDraw
+
+#endif// TECHDRAW_HLRSCHEDULER_H
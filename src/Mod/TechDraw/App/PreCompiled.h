@@ -58,6 +58,7 @@
 #include <QLocale>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QThread>
 #include <QtConcurrentRun>
 
 // OpenCasCade
@@ -405,6 +405,18 @@ int Preferences::scrubCount()
     return getPreferenceGroup("General")->GetInt("ScrubCount", 0);
 }
 
+//! Returns the number of projections that are kept for reuse. 0 disables the cache.
+int Preferences::projectionCacheSize()
+{
+    return getPreferenceGroup("General")->GetInt("ProjectionCacheSize", 64);
+}
+
+//! Returns the number of views that are processed at the same time. 0 uses all cores.
+int Preferences::hlrThreadCount()
+{
+    return getPreferenceGroup("General")->GetInt("MaxHlrThreads", 0);
+}
+
 //! Returns the factor for the overlap of svg tiles when hatching faces
 double Preferences::svgHatchFactor()
 {
@@ -102,6 +102,8 @@ public:
 
     static bool autoCorrectDimRefs();
     static int scrubCount();
+    static int projectionCacheSize();
+    static int hlrThreadCount();
 
     static double svgHatchFactor();
     static bool SectionUsePreviousCut();
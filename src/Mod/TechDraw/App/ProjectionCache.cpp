@@ -0,0 +1,539 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <locale>
+#include <sstream>
+
+#include <BRep_Builder.hxx>
+#include <Standard_Failure.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#endif
+
+#include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+#include <Mod/Part/App/TopoShape.h>
+
+#include "ProjectionCache.h"
+
+
+using namespace TechDraw;
+
+ProjectionCache& ProjectionCache::instance()
+{
+    static ProjectionCache cache;
+    return cache;
+}
+
+bool ProjectionKey::operator==(const ProjectionKey& other) const
+{
+    if (params != other.params || document != other.document
+        || shapes.size() != other.shapes.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        if (!shapes[i].IsEqual(other.shapes[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! equal keys have equal TShapes, so the location is left to operator==
+std::size_t ProjectionKeyHash::operator()(const ProjectionKey& key) const
+{
+    std::size_t seed = std::hash<std::string>()(key.params);
+    seed ^= std::hash<std::string>()(key.document) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    for (const auto& shape : key.shapes) {
+        std::size_t value = std::hash<const void*>()(shape.TShape().get());
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+//! the compounds around the source shapes are rebuilt on every recompute, so the key is
+//! made of the shapes inside them. The shapes of an unchanged document object are shared
+//! with its Shape property and keep their TShape.
+ProjectionKey ProjectionCache::makeKey(const TopoDS_Shape& source,
+                                       const gp_Ax2& viewAxis,
+                                       double scale,
+                                       double rotation,
+                                       int isoCount,
+                                       bool perspective,
+                                       double focus)
+{
+    ProjectionKey key;
+    std::function<void(const TopoDS_Shape&)> addShape = [&](const TopoDS_Shape& shape) {
+        if (shape.IsNull()) {
+            return;
+        }
+        if (shape.ShapeType() != TopAbs_COMPOUND) {
+            key.shapes.push_back(shape);
+            return;
+        }
+        for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+            addShape(it.Value());
+        }
+    };
+    addShape(source);
+    if (key.shapes.empty()) {
+        return key;
+    }
+    key.content = std::make_shared<std::string>();
+
+    std::ostringstream params;
+    params.imbue(std::locale::classic());
+    params.precision(17);
+    auto writeXYZ = [&params](const gp_XYZ& xyz) {
+        params << xyz.X() << ',' << xyz.Y() << ',' << xyz.Z() << ':';
+    };
+    writeXYZ(viewAxis.Location().XYZ());
+    writeXYZ(viewAxis.Direction().XYZ());
+    writeXYZ(viewAxis.XDirection().XYZ());
+
+    params << scale << ':' << rotation << ':' << isoCount << ':' << perspective;
+    if (perspective) {
+        params << ':' << focus;
+    }
+    key.params = params.str();
+
+    return key;
+}
+
+std::size_t ProjectionCache::capacity()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+//! the preferences are not thread safe, so this must be called from the main thread
+void ProjectionCache::setCapacity(std::size_t maxEntries)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = maxEntries;
+    shrink(m_capacity);
+}
+
+std::size_t ProjectionCache::size()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+void ProjectionCache::shrink(std::size_t maxEntries)
+{
+    while (m_entries.size() > maxEntries) {
+        m_entries.erase(m_ages.back());
+        m_ages.pop_back();
+    }
+}
+
+ProjectionCache::Entry* ProjectionCache::find(const ProjectionKey& key)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        return nullptr;
+    }
+
+    // mark as most recently used
+    m_ages.splice(m_ages.begin(), m_ages, it->second.age);
+    return &it->second;
+}
+
+ProjectionCache::Entry& ProjectionCache::insert(const ProjectionKey& key)
+{
+    Entry* entry = find(key);
+    if (entry) {
+        return *entry;
+    }
+
+    // make room for the new entry
+    shrink(m_capacity > 0 ? m_capacity - 1 : 0);
+
+    m_ages.push_front(key);
+    Entry& newEntry = m_entries[key];
+    newEntry.age = m_ages.begin();
+    return newEntry;
+}
+
+//! look up the entry in memory and then in the store. The store is read without
+//! holding the lock, so that the HLR threads don't wait for each other.
+bool ProjectionCache::findEntry(const ProjectionKey& key, Entry& result)
+{
+    std::string directory;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Entry* entry = find(key);
+        if (entry) {
+            result = *entry;
+            return true;
+        }
+        if (m_capacity == 0 || m_storedEntries == 0) {
+            return false;
+        }
+        directory = m_storeDirectory;
+    }
+
+    Entry stored;
+    if (!loadEntry(key, directory, stored)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry& entry = insert(key);
+    entry.projection = stored.projection;
+    entry.faces = stored.faces;
+    entry.hasProjection = stored.hasProjection;
+    entry.hasFaces = stored.hasFaces;
+    result = entry;
+    return true;
+}
+
+bool ProjectionCache::findProjection(const ProjectionKey& key, HlrResult& result)
+{
+    Entry entry;
+    if (!findEntry(key, entry) || !entry.hasProjection) {
+        return false;
+    }
+
+    result = entry.projection;
+    return true;
+}
+
+void ProjectionCache::addProjection(const ProjectionKey& key, const HlrResult& result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_capacity == 0) {
+        return;
+    }
+    Entry& entry = insert(key);
+    entry.projection = result;
+    entry.hasProjection = true;
+}
+
+bool ProjectionCache::findFaces(const ProjectionKey& key, std::vector<TopoDS_Wire>& wires)
+{
+    Entry entry;
+    if (!findEntry(key, entry) || !entry.hasFaces) {
+        return false;
+    }
+
+    wires = entry.faces;
+    return true;
+}
+
+void ProjectionCache::addFaces(const ProjectionKey& key, const std::vector<TopoDS_Wire>& wires)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_capacity == 0) {
+        return;
+    }
+    Entry& entry = insert(key);
+    entry.faces = wires;
+    entry.hasFaces = true;
+}
+
+void ProjectionCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_ages.clear();
+}
+
+//! the preferences are not thread safe, so this must be called from the main thread
+void ProjectionCache::setStoreDirectory(const std::string& path)
+{
+    std::size_t count = 0;
+    if (!path.empty()) {
+        Base::FileInfo dir(path);
+        if (!dir.exists()) {
+            dir.createDirectories();
+        }
+        count = shrinkStore(path, capacity());
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_storeDirectory = path;
+    m_storedEntries = count;
+}
+
+void ProjectionCache::releaseDocument(const std::string& document)
+{
+    std::vector<std::pair<ProjectionKey, Entry>> released;
+    std::string directory;
+    std::size_t maxEntries {};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if (it->first.document == document) {
+                m_ages.erase(it->second.age);
+                released.emplace_back(it->first, it->second);
+                it = m_entries.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        directory = m_storeDirectory;
+        maxEntries = m_capacity;
+    }
+
+    if (released.empty() || directory.empty() || maxEntries == 0) {
+        return;
+    }
+
+    for (const auto& it : released) {
+        try {
+            storeEntry(it.first, it.second, directory);
+        }
+        catch (const Standard_Failure& e) {
+            Base::Console().Log("ProjectionCache: cannot store a projection of %s: %s\n",
+                                document.c_str(), e.GetMessageString());
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().Log("ProjectionCache: cannot store a projection of %s: %s\n",
+                                document.c_str(), e.what());
+        }
+    }
+
+    std::size_t count = shrinkStore(directory, maxEntries);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_storedEntries = count;
+}
+
+namespace
+{
+
+const char* const storeHeader = "TechDrawProjectionCache 1";
+const char* const storeExtension = "tdp";
+
+void writeBlob(std::ostream& out, const std::string& blob)
+{
+    out << blob.size() << '\n';
+    out.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+}
+
+bool readBlob(std::istream& in, std::string& blob)
+{
+    std::size_t size {};
+    if (!(in >> size) || in.get() != '\n') {
+        return false;
+    }
+    blob.resize(size);
+    return size == 0 || in.read(&blob[0], static_cast<std::streamsize>(size));
+}
+
+//! a null shape is stored as an empty compound to keep the positions
+std::string toBinary(const std::vector<TopoDS_Shape>& shapes)
+{
+    BRep_Builder builder;
+    TopoDS_Compound compound;
+    builder.MakeCompound(compound);
+    for (const auto& shape : shapes) {
+        if (shape.IsNull()) {
+            TopoDS_Compound empty;
+            builder.MakeCompound(empty);
+            builder.Add(compound, empty);
+        }
+        else {
+            builder.Add(compound, shape);
+        }
+    }
+
+    std::ostringstream out;
+    Part::TopoShape(compound).exportBinary(out);
+    return out.str();
+}
+
+std::vector<TopoDS_Shape> fromBinary(const std::string& blob)
+{
+    std::istringstream in(blob);
+    Part::TopoShape shape;
+    shape.importBinary(in);
+
+    std::vector<TopoDS_Shape> shapes;
+    if (shape.isNull()) {
+        return shapes;
+    }
+    for (TopoDS_Iterator it(shape.getShape()); it.More(); it.Next()) {
+        const TopoDS_Shape& child = it.Value();
+        bool empty = child.ShapeType() == TopAbs_COMPOUND && !TopoDS_Iterator(child).More();
+        shapes.push_back(empty ? TopoDS_Shape() : child);
+    }
+    return shapes;
+}
+
+std::vector<TopoDS_Shape> shapesOf(const HlrResult& result)
+{
+    return {result.visHard, result.visOutline, result.visSmooth, result.visSeam, result.visIso,
+            result.hidHard, result.hidOutline, result.hidSmooth, result.hidSeam, result.hidIso};
+}
+
+bool setShapes(HlrResult& result, const std::vector<TopoDS_Shape>& shapes)
+{
+    std::vector<TopoDS_Shape*> members = {
+        &result.visHard, &result.visOutline, &result.visSmooth, &result.visSeam, &result.visIso,
+        &result.hidHard, &result.hidOutline, &result.hidSmooth, &result.hidSeam, &result.hidIso};
+    if (shapes.size() != members.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < members.size(); ++i) {
+        *members[i] = shapes[i];
+    }
+    return true;
+}
+
+}  // namespace
+
+//! the BRep of the source shapes. It is independent of the TShapes and thus
+//! the same for a shape that is restored from a document.
+std::string ProjectionCache::contentOf(const ProjectionKey& key)
+{
+    if (key.content && !key.content->empty()) {
+        return *key.content;
+    }
+
+    std::ostringstream out;
+    out.imbue(std::locale::classic());
+    for (const auto& shape : key.shapes) {
+        Part::TopoShape(shape).exportBrep(out);
+    }
+
+    std::string content = out.str();
+    if (key.content) {
+        *key.content = content;
+    }
+    return content;
+}
+
+//! the file name is a hash of the content, the content itself is compared when reading
+std::string ProjectionCache::fileOf(const std::string& content,
+                                    const std::string& params,
+                                    const std::string& directory)
+{
+    std::size_t hash = std::hash<std::string>()(params + '\n' + content);
+    std::ostringstream name;
+    name << directory << '/' << std::hex << std::setw(16) << std::setfill('0') << hash << '.'
+         << storeExtension;
+    return name.str();
+}
+
+void ProjectionCache::storeEntry(const ProjectionKey& key,
+                                 const Entry& entry,
+                                 const std::string& directory)
+{
+    std::string content = contentOf(key);
+    Base::FileInfo fi(fileOf(content, key.params, directory));
+    Base::ofstream file(fi, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file) {
+        throw Base::FileException("Cannot write projection", fi);
+    }
+
+    std::vector<TopoDS_Shape> faces(entry.faces.begin(), entry.faces.end());
+    file << storeHeader << '\n';
+    writeBlob(file, key.params);
+    writeBlob(file, content);
+    file << entry.hasProjection << ' ' << entry.hasFaces << '\n';
+    writeBlob(file, toBinary(shapesOf(entry.projection)));
+    writeBlob(file, toBinary(faces));
+}
+
+bool ProjectionCache::loadEntry(const ProjectionKey& key,
+                                const std::string& directory,
+                                Entry& entry)
+{
+    std::string content = contentOf(key);
+    Base::FileInfo fi(fileOf(content, key.params, directory));
+    if (!fi.exists()) {
+        return false;
+    }
+
+    try {
+        Base::ifstream file(fi, std::ios::in | std::ios::binary);
+        std::string header;
+        std::string params;
+        std::string storedContent;
+        if (!std::getline(file, header) || header != storeHeader || !readBlob(file, params)
+            || params != key.params || !readBlob(file, storedContent) || storedContent != content) {
+            return false;
+        }
+
+        std::string projection;
+        std::string faces;
+        if (!(file >> entry.hasProjection >> entry.hasFaces) || file.get() != '\n'
+            || !readBlob(file, projection) || !readBlob(file, faces)) {
+            return false;
+        }
+
+        if (!setShapes(entry.projection, fromBinary(projection))) {
+            return false;
+        }
+        entry.faces.clear();
+        for (const auto& wire : fromBinary(faces)) {
+            entry.faces.push_back(TopoDS::Wire(wire));
+        }
+    }
+    catch (const Standard_Failure& e) {
+        Base::Console().Log("ProjectionCache: cannot read %s: %s\n", fi.filePath().c_str(),
+                            e.GetMessageString());
+        return false;
+    }
+    catch (const Base::Exception& e) {
+        Base::Console().Log("ProjectionCache: cannot read %s: %s\n", fi.filePath().c_str(),
+                            e.what());
+        return false;
+    }
+
+    return true;
+}
+
+//! remove the least recently written files and return the number of remaining files
+std::size_t ProjectionCache::shrinkStore(const std::string& directory, std::size_t maxEntries)
+{
+    std::vector<Base::FileInfo> files;
+    for (const auto& fi : Base::FileInfo(directory).getDirectoryContent()) {
+        if (fi.isFile() && fi.hasExtension(storeExtension)) {
+            files.push_back(fi);
+        }
+    }
+    if (files.size() <= maxEntries) {
+        return files.size();
+    }
+
+    // newest first
+    std::sort(files.begin(), files.end(), [](const Base::FileInfo& a, const Base::FileInfo& b) {
+        return a.lastModified() > b.lastModified();
+    });
+    for (std::size_t i = maxEntries; i < files.size(); ++i) {
+        files[i].deleteFile();
+    }
+    return maxEntries;
+}
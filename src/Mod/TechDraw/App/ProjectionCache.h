@@ -0,0 +1,154 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef TECHDRAW_PROJECTIONCACHE_H
+#define TECHDRAW_PROJECTIONCACHE_H
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+#include <TopoDS_Wire.hxx>
+#include <gp_Ax2.hxx>
+
+//! a process wide cache for the results of hidden line removal and face finding.
+//  The entries are keyed by the identity of the source shapes, so views of unchanged
+//  shapes reuse their projection across recomputes. When a document is closed or
+//  reloaded its entries are moved to the store directory, where they are found by the
+//  content of the source shapes, so they are reused when the document is opened again.
+
+namespace TechDraw
+{
+
+//! the compounds of visible and hidden edges produced by the HLR algorithm
+struct TechDrawExport HlrResult
+{
+    TopoDS_Shape visHard;
+    TopoDS_Shape visOutline;
+    TopoDS_Shape visSmooth;
+    TopoDS_Shape visSeam;
+    TopoDS_Shape visIso;
+    TopoDS_Shape hidHard;
+    TopoDS_Shape hidOutline;
+    TopoDS_Shape hidSmooth;
+    TopoDS_Shape hidSeam;
+    TopoDS_Shape hidIso;
+};
+
+//! identifies a projection by its source shapes and the view parameters.
+//  The shapes are compared by TShape, location and orientation. A key holds on to its
+//  shapes, so the address of a cached TShape can not be reused by a different shape.
+struct TechDrawExport ProjectionKey
+{
+    std::vector<TopoDS_Shape> shapes;
+    std::string params;
+    //! the name of the document the entry belongs to
+    std::string document;
+    //! the BRep of the shapes, made on demand and shared by the copies of the key.
+    //  The copies are used one after another, the projection before the faces.
+    std::shared_ptr<std::string> content;
+
+    bool empty() const { return shapes.empty(); }
+    bool operator==(const ProjectionKey& other) const;
+};
+
+struct TechDrawExport ProjectionKeyHash
+{
+    std::size_t operator()(const ProjectionKey& key) const;
+};
+
+class TechDrawExport ProjectionCache
+{
+public:
+    static ProjectionCache& instance();
+
+    //! make a key from the source shape, the projection CS, the transformation applied
+    //! to the shape and the HLR options
+    static ProjectionKey makeKey(const TopoDS_Shape& source,
+                                 const gp_Ax2& viewAxis,
+                                 double scale,
+                                 double rotation,
+                                 int isoCount,
+                                 bool perspective,
+                                 double focus);
+
+    bool findProjection(const ProjectionKey& key, HlrResult& result);
+    void addProjection(const ProjectionKey& key, const HlrResult& result);
+    bool findFaces(const ProjectionKey& key, std::vector<TopoDS_Wire>& wires);
+    void addFaces(const ProjectionKey& key, const std::vector<TopoDS_Wire>& wires);
+
+    //! the maximum number of entries in memory and in the store, 0 disables the cache
+    std::size_t capacity();
+    void setCapacity(std::size_t maxEntries);
+    std::size_t size();
+    void clear();
+
+    //! the directory for the entries of closed documents, an empty path disables it
+    void setStoreDirectory(const std::string& path);
+    //! move the entries of the document to the store directory. This is called when the
+    //! document is closed or reloaded, so that the cache doesn't hold on to its shapes.
+    void releaseDocument(const std::string& document);
+
+private:
+    ProjectionCache() = default;
+
+    struct Entry
+    {
+        HlrResult projection;
+        std::vector<TopoDS_Wire> faces;
+        bool hasProjection {false};
+        bool hasFaces {false};
+        std::list<ProjectionKey>::iterator age;
+    };
+
+    Entry* find(const ProjectionKey& key);
+    Entry& insert(const ProjectionKey& key);
+    void shrink(std::size_t maxEntries);
+
+    bool findEntry(const ProjectionKey& key, Entry& result);
+
+    //! the entries in the store directory are found by the content of the source shapes
+    static std::string contentOf(const ProjectionKey& key);
+    static std::string fileOf(const std::string& content,
+                              const std::string& params,
+                              const std::string& directory);
+    static void storeEntry(const ProjectionKey& key, const Entry& entry, const std::string& directory);
+    static bool loadEntry(const ProjectionKey& key, const std::string& directory, Entry& entry);
+    static std::size_t shrinkStore(const std::string& directory, std::size_t maxEntries);
+
+    std::mutex m_mutex;
+    std::size_t m_capacity {64};
+    std::string m_storeDirectory;
+    std::size_t m_storedEntries {0};
+    std::list<ProjectionKey> m_ages;  // most recently used first
+    std::unordered_map<ProjectionKey, Entry, ProjectionKeyHash> m_entries;
+};
+
+}  // namespace TechDraw
+
+#endif  // TECHDRAW_PROJECTIONCACHE_H
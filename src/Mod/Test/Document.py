@@ -1666,6 +1666,71 @@ class DocumentPropertyCases(unittest.TestCase):
         fea = Feature(obj)
         obj.Test = "test"
 
+    def testPropertyBuffer(self):
+        self.Obj.addProperty("App::PropertyFloatList", "Floats")
+        self.Obj.addProperty("App::PropertyVectorList", "Vectors")
+        self.Obj.Floats = [1.0, 2.0, 3.0]
+        self.Obj.Vectors = [FreeCAD.Vector(1, 2, 3), FreeCAD.Vector(4, 5, 6)]
+
+        floats = memoryview(self.Obj.getPropertyBuffer("Floats"))
+        self.assertEqual(floats.shape, (3,))
+        self.assertEqual(floats.format, "d")
+        self.assertTrue(floats.readonly)
+        self.assertEqual(floats.tolist(), [1.0, 2.0, 3.0])
+
+        vectors = memoryview(self.Obj.getPropertyBuffer("Vectors"))
+        self.assertEqual(vectors.shape, (2, 3))
+        self.assertEqual(vectors.tolist(), [[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]])
+        with self.assertRaises(TypeError):
+            vectors[0, 0] = 0.0
+
+        # the property cannot be changed while it is exported
+        with self.assertRaises(RuntimeError):
+            self.Obj.Floats = [0.0] * 1000
+        self.assertEqual(floats.tolist(), [1.0, 2.0, 3.0])
+        # the values of a removed property stay valid until the buffer is released
+        self.Obj.removeProperty("Vectors")
+        self.assertEqual(vectors.tolist(), [[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]])
+        vectors.release()
+        floats.release()
+        self.Obj.Floats = [0.0] * 1000
+        self.assertEqual(memoryview(self.Obj.getPropertyBuffer("Floats")).shape, (1000,))
+
+        with self.assertRaises(TypeError):
+            self.Obj.getPropertyBuffer("Label")
+
+    def testWritablePropertyBuffer(self):
+        self.Doc.UndoMode = 1
+        self.Obj.addProperty("App::PropertyFloatList", "Floats")
+        self.Obj.Floats = [1.0, 2.0, 3.0]
+
+        self.Doc.openTransaction("write buffer")
+        view = self.Obj.getPropertyBuffer("Floats", True)
+        first = memoryview(view)
+        second = memoryview(view)
+        self.assertFalse(first.readonly)
+        first[0] = 10.0
+        second[2] = 30.0
+        # the buffers write to the values directly
+        self.assertEqual(self.Obj.Floats, [10.0, 2.0, 30.0])
+        with self.assertRaises(RuntimeError):
+            self.Obj.Floats = [0.0]
+        first.release()
+        second.release()
+        self.assertEqual(self.Obj.Floats, [10.0, 2.0, 30.0])
+        self.Doc.commitTransaction()
+
+        self.Doc.undo()
+        self.assertEqual(self.Obj.Floats, [1.0, 2.0, 3.0])
+        self.Doc.redo()
+        self.assertEqual(self.Obj.Floats, [10.0, 2.0, 30.0])
+
+        # a removed property is not written to
+        buf = memoryview(self.Obj.getPropertyBuffer("Floats", True))
+        self.Obj.removeProperty("Floats")
+        buf[0] = 0.0
+        buf.release()
+
     def tearDown(self):
         # closing doc
         FreeCAD.closeDocument("PropertyTests")
@@ -2177,6 +2242,31 @@ class DocumentObserverCases(unittest.TestCase):
         FreeCAD.closeDocument(self.Doc1.Name)
         self.Obs.clear()
 
+    def testSignalBatch(self):
+        self.Doc1 = FreeCAD.newDocument("Observer1")
+        obj = self.Doc1.addObject("App::FeatureTest", "obj")
+        self.Obs.clear()
+
+        # the batch is closed even if the block raises
+        with self.assertRaises(ValueError):
+            with self.Doc1.signalBatch():
+                obj.Label = "First"
+                self.assertNotIn("ObjChanged", self.Obs.signal)
+                raise ValueError("abort")
+        self.assertIn("ObjChanged", self.Obs.signal)
+        self.Obs.clear()
+
+        with self.Doc1.signalBatch():
+            with self.Doc1.signalBatch():
+                obj.Label = "Second"
+            obj.Label = "Third"
+            self.assertNotIn("ObjChanged", self.Obs.signal)
+        self.assertEqual(self.Obs.signal.count("ObjChanged"), 1)
+        self.assertEqual(obj.Label, "Third")
+
+        FreeCAD.closeDocument(self.Doc1.Name)
+        self.Obs.clear()
+
     def testGuiObserver(self):
 
         if not FreeCAD.GuiUp:
@@ -2,10 +2,14 @@
 
 #include "gtest/gtest.h"
 #include <gmock/gmock.h>
+#include <algorithm>
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/DocumentObjectGroup.h"
 #include "App/StringHasher.h"
+#include "Base/Exception.h"
+#include "Base/FileInfo.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
 
@@ -94,4 +98,240 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, getDependencyListFollowsLinkChanges)
+{
+    // Arrange
+    auto group = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Group"));
+    auto child = doc()->addObject("App::DocumentObjectGroup", "Child");
+    group->addObject(child);
+    auto sorted = App::Document::getDependencyList({group}, App::Document::DepSort);
+
+    // Act
+    group->removeObject(child);
+    auto unlinked = App::Document::getDependencyList({group}, App::Document::DepSort);
+    group->addObject(child);
+    auto relinked = App::Document::getDependencyList({group}, App::Document::DepSort);
+
+    // Assert
+    EXPECT_EQ(sorted, (std::vector<App::DocumentObject*> {child, group}));
+    EXPECT_EQ(unlinked, (std::vector<App::DocumentObject*> {group}));
+    EXPECT_EQ(relinked, sorted);
+}
+
+TEST_F(DocumentTest, getDependencyListForgetsRemovedObjects)
+{
+    // Arrange
+    auto group = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup", "Group"));
+    auto child = doc()->addObject("App::DocumentObjectGroup", "Child");
+    group->addObject(child);
+    App::Document::getDependencyList({group});
+
+    // Act
+    doc()->removeObject(child->getNameInDocument());
+    auto deps = App::Document::getDependencyList({group});
+
+    // Assert
+    EXPECT_EQ(deps, (std::vector<App::DocumentObject*> {group}));
+}
+
+TEST_F(DocumentTest, signalBatchDeliversWhenOutermostBatchCloses)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::DocumentObjectGroup", "Group");
+    int changed = 0;
+    int changeSets = 0;
+    boost::signals2::scoped_connection connChanged = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject&, const App::Property& prop) {
+            if (&prop == &obj->Label) {
+                ++changed;
+            }
+        });
+    boost::signals2::scoped_connection connChangeSet = doc()->signalChangeSet.connect(
+        [&](const App::Document&, const App::DocumentChangeSet&) {
+            ++changeSets;
+        });
+
+    // Act
+    doc()->openSignalBatch();
+    doc()->openSignalBatch();
+    obj->Label.setValue("First");
+    doc()->closeSignalBatch();
+    bool openAfterInner = doc()->isSignalBatchOpen();
+    int changedAfterInner = changed;
+    obj->Label.setValue("Second");
+    doc()->closeSignalBatch();
+
+    // Assert
+    EXPECT_TRUE(openAfterInner);
+    EXPECT_EQ(changedAfterInner, 0);
+    EXPECT_FALSE(doc()->isSignalBatchOpen());
+    EXPECT_EQ(changed, 1);
+    EXPECT_EQ(changeSets, 1);
+}
+
+TEST_F(DocumentTest, signalBatchReplaysInOrderOfFirstChange)
+{
+    // Arrange
+    auto first = doc()->addObject("App::DocumentObjectGroup", "First");
+    auto second = doc()->addObject("App::DocumentObjectGroup", "Second");
+    std::vector<const App::DocumentObject*> replayed;
+    std::vector<bool> replaying;
+    std::vector<const App::DocumentObject*> changeSet;
+    boost::signals2::scoped_connection connChanged = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject& obj, const App::Property& prop) {
+            if (&prop == &obj.Label) {
+                replayed.push_back(&obj);
+                replaying.push_back(doc()->isReplayingSignalBatch());
+            }
+        });
+    boost::signals2::scoped_connection connChangeSet = doc()->signalChangeSet.connect(
+        [&](const App::Document&, const App::DocumentChangeSet& changes) {
+            for (const auto& change : changes.changedObjects) {
+                if (change.second == &change.first->Label) {
+                    changeSet.push_back(change.first);
+                }
+            }
+        });
+
+    // Act
+    {
+        App::DocumentSignalBatch batch(doc());
+        second->Label.setValue("B1");
+        first->Label.setValue("A1");
+        second->Label.setValue("B2");
+    }
+    first->Label.setValue("A2");
+
+    // Assert
+    EXPECT_EQ(replayed, (std::vector<const App::DocumentObject*> {second, first, first}));
+    EXPECT_EQ(replaying, (std::vector<bool> {true, true, false}));
+    EXPECT_EQ(changeSet, (std::vector<const App::DocumentObject*> {second, first}));
+    EXPECT_EQ(second->Label.getStrValue(), "B2");
+}
+
+TEST_F(DocumentTest, signalBatchClosesOnException)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::DocumentObjectGroup", "Group");
+    int changed = 0;
+    boost::signals2::scoped_connection connChanged = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject&, const App::Property& prop) {
+            if (&prop == &obj->Label) {
+                ++changed;
+            }
+        });
+
+    // Act
+    try {
+        App::DocumentSignalBatch batch(doc());
+        obj->Label.setValue("Changed");
+        throw Base::RuntimeError("abort");
+    }
+    catch (const Base::RuntimeError&) {
+    }
+
+    // Assert
+    EXPECT_FALSE(doc()->isSignalBatchOpen());
+    EXPECT_FALSE(doc()->isReplayingSignalBatch());
+    EXPECT_EQ(changed, 1);
+}
+
+TEST_F(DocumentTest, signalBatchRecoversFromThrowingObserver)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::DocumentObjectGroup", "Group");
+    bool fail = true;
+    int changed = 0;
+    boost::signals2::scoped_connection connChanged = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject&, const App::Property& prop) {
+            if (&prop != &obj->Label) {
+                return;
+            }
+            ++changed;
+            if (fail) {
+                throw Base::RuntimeError("observer failure");
+            }
+        });
+    doc()->openSignalBatch();
+    obj->Label.setValue("First");
+
+    // Act
+    EXPECT_THROW(doc()->closeSignalBatch(), Base::RuntimeError);
+    fail = false;
+    doc()->openSignalBatch();
+    obj->Label.setValue("Second");
+    doc()->closeSignalBatch();
+
+    // Assert
+    EXPECT_FALSE(doc()->isSignalBatchOpen());
+    EXPECT_FALSE(doc()->isReplayingSignalBatch());
+    EXPECT_EQ(changed, 2);
+}
+
+TEST_F(DocumentTest, signalBatchDropsObjectsOfRestoredDocument)
+{
+    // Arrange
+    doc()->addObject("App::DocumentObjectGroup", "Saved");
+    Base::FileInfo file(Base::FileInfo::getTempFileName() + ".FCStd");
+    ASSERT_TRUE(doc()->saveCopy(file.filePath().c_str()));
+    std::vector<std::string> newObjects;
+    std::vector<std::string> changedObjects;
+    boost::signals2::scoped_connection connNew =
+        doc()->signalNewObject.connect([&](const App::DocumentObject& obj) {
+            if (doc()->isReplayingSignalBatch()) {
+                newObjects.emplace_back(obj.getNameInDocument());
+            }
+        });
+    boost::signals2::scoped_connection connChanged = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject& obj, const App::Property&) {
+            if (doc()->isReplayingSignalBatch()) {
+                changedObjects.emplace_back(obj.getNameInDocument());
+            }
+        });
+
+    // Act
+    doc()->openSignalBatch();
+    auto removed = doc()->addObject("App::DocumentObjectGroup", "Removed");
+    removed->Label.setValue("Changed");
+    doc()->restore(file.filePath().c_str());
+    doc()->closeSignalBatch();
+    file.deleteFile();
+
+    // Assert
+    EXPECT_FALSE(doc()->isSignalBatchOpen());
+    EXPECT_EQ(doc()->getObject("Removed"), nullptr);
+    EXPECT_EQ(std::count(newObjects.begin(), newObjects.end(), "Removed"), 0);
+    EXPECT_EQ(std::count(changedObjects.begin(), changedObjects.end(), "Removed"), 0);
+    for (const auto& name : newObjects) {
+        EXPECT_NE(doc()->getObject(name.c_str()), nullptr);
+    }
+}
+
+TEST_F(DocumentTest, signalBatchDoesNotCloseBatchOfNewDocument)
+{
+    // Arrange
+    auto& app = App::GetApplication();
+    std::string closedName = app.getUniqueDocumentName("closed");
+    std::string openName;
+    App::Document* open {};
+
+    // Act
+    {
+        App::DocumentSignalBatch batch(app.newDocument(closedName.c_str(), "testUser"));
+        app.closeDocument(closedName.c_str());
+        // may be created at the address of the closed document
+        openName = app.getUniqueDocumentName("open");
+        open = app.newDocument(openName.c_str(), "testUser");
+        open->openSignalBatch();
+    }
+    bool stillOpen = open->isSignalBatchOpen();
+    open->closeSignalBatch();
+    app.closeDocument(openName.c_str());
+
+    // Assert
+    EXPECT_TRUE(stillOpen);
+}
+
 // NOLINTEND(readability-magic-numbers)
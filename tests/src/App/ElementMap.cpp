@@ -266,6 +266,35 @@ TEST_F(ElementMapTest, findMappedName)
     EXPECT_EQ(findResult2, element2);
 }
 
+TEST_F(ElementMapTest, findMappedNameAfterManyChanges)
+{
+    // Arrange
+    // Enough names to grow the name index several times
+    Data::ElementMap elementMap;
+    const int count = 1000;
+    for (int i = 1; i <= count; ++i) {
+        Data::MappedName mappedName("TEST" + std::to_string(i));
+        elementMap.setElementName(Data::IndexedName("Edge", i), mappedName, 0);
+    }
+
+    // Act
+    for (int i = 1; i <= count; i += 2) {
+        elementMap.erase(Data::MappedName("TEST" + std::to_string(i)));
+    }
+
+    // Assert
+    EXPECT_EQ(elementMap.size(), count / 2);
+    for (int i = 1; i <= count; ++i) {
+        auto findResult = elementMap.find(Data::MappedName("TEST" + std::to_string(i)));
+        if (i % 2 != 0) {
+            EXPECT_FALSE(findResult);
+        }
+        else {
+            EXPECT_EQ(findResult, Data::IndexedName("Edge", i));
+        }
+    }
+}
+
 TEST_F(ElementMapTest, findIndexedName)
 {
     // Arrange
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+
+#include <Base/BufferExports.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+TEST(BufferExports, checkThrowsWhileLocked)
+{
+    Base::BufferExports exports;
+    EXPECT_NO_THROW(exports.check());
+
+    auto first = exports.lock();
+    auto second = exports.lock();
+    EXPECT_TRUE(exports.isExported());
+    EXPECT_THROW(exports.check(), Base::RuntimeError);
+
+    first.reset();
+    EXPECT_THROW(exports.check(), Base::RuntimeError);
+    second.reset();
+    EXPECT_FALSE(exports.isExported());
+    EXPECT_NO_THROW(exports.check());
+}
+
+TEST(BufferExports, copyHasNoExports)
+{
+    Base::BufferExports exports;
+    auto lock = exports.lock();
+    Base::BufferExports copy(exports);
+    EXPECT_FALSE(copy.isExported());
+    copy = exports;
+    EXPECT_FALSE(copy.isExported());
+}
+
+TEST(BufferExports, keepAliveWhileLocked)
+{
+    std::vector<double> values {1.0, 2.0, 3.0};
+    const double* data = values.data();
+
+    auto exports = std::make_unique<Base::BufferExports>();
+    auto lock = exports->lock();
+    exports->keepAlive(values);
+    exports.reset();
+
+    // the memory has been taken over and is released with the lock
+    EXPECT_TRUE(values.empty());
+    EXPECT_DOUBLE_EQ(data[2], 3.0);
+    lock.reset();
+}
+
+TEST(BufferExports, keepAliveWithoutExports)
+{
+    std::vector<double> values {1.0, 2.0, 3.0};
+    Base::BufferExports exports;
+    exports.keepAlive(values);
+    EXPECT_EQ(values.size(), 3);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
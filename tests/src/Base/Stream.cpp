@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <vector>
+
+#include "Base/Stream.h"
+
+class StreamTest: public ::testing::Test
+{
+protected:
+    std::vector<double> doubles {0.5, -1.25, 3.0e10, 7.0};
+    std::vector<int16_t> shorts {1, -2, 300};
+};
+
+TEST_F(StreamTest, writeArrayEqualsScalarWrites)
+{
+    for (auto byteOrder : {Base::Stream::LittleEndian, Base::Stream::BigEndian}) {
+        // Arrange
+        std::stringstream array;
+        std::stringstream scalar;
+        Base::OutputStream arrayOut(array);
+        Base::OutputStream scalarOut(scalar);
+        arrayOut.setByteOrder(byteOrder);
+        scalarOut.setByteOrder(byteOrder);
+
+        // Act
+        arrayOut.write(doubles.data(), doubles.size());
+        arrayOut.write(shorts.data(), shorts.size());
+        for (double value : doubles) {
+            scalarOut << value;
+        }
+        for (int16_t value : shorts) {
+            scalarOut << value;
+        }
+
+        // Assert
+        EXPECT_EQ(array.str(), scalar.str());
+    }
+}
+
+TEST_F(StreamTest, readArrayRoundTrip)
+{
+    for (auto byteOrder : {Base::Stream::LittleEndian, Base::Stream::BigEndian}) {
+        // Arrange
+        std::stringstream data;
+        Base::OutputStream out(data);
+        out.setByteOrder(byteOrder);
+        out.write(doubles.data(), doubles.size());
+        out.write(shorts.data(), shorts.size());
+
+        // Act
+        Base::InputStream in(data);
+        in.setByteOrder(byteOrder);
+        std::vector<double> readDoubles(doubles.size());
+        std::vector<int16_t> readShorts(shorts.size());
+        in.read(readDoubles.data(), readDoubles.size());
+        in.read(readShorts.data(), readShorts.size());
+
+        // Assert
+        EXPECT_EQ(readDoubles, doubles);
+        EXPECT_EQ(readShorts, shorts);
+    }
+}
@@ -0,0 +1,85 @@
+#include "gtest/gtest.h"
+#include <cfloat>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <Mod/Inspection/App/InspectionFeature.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class InspectNominalShapeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        sphere = BRepPrimAPI_MakeSphere(50.0).Shape();
+    }
+
+    void TearDown() override
+    {}
+
+    TopoDS_Shape sphere;
+    const float searchRadius = 1.0F;
+};
+
+TEST_F(InspectNominalShapeTest, TestTessellatedIsThreadSafe)
+{
+    Inspection::InspectNominalShape exact(sphere, searchRadius);
+    Inspection::InspectNominalShape tessellated(sphere, searchRadius, true);
+    EXPECT_FALSE(exact.isThreadSafe());
+    EXPECT_TRUE(tessellated.isThreadSafe());
+}
+
+TEST_F(InspectNominalShapeTest, TestPointNearSurface)
+{
+    Inspection::InspectNominalShape exact(sphere, searchRadius);
+    Inspection::InspectNominalShape tessellated(sphere, searchRadius, true);
+
+    Base::Vector3f inner(0.0F, 0.0F, 49.5F);
+    EXPECT_NEAR(exact.getDistance(inner), -0.5F, 1e-3F);
+    EXPECT_NEAR(tessellated.getDistance(inner), -0.5F, 1e-3F);
+
+    Base::Vector3f outer(0.0F, 0.0F, 50.5F);
+    EXPECT_NEAR(exact.getDistance(outer), 0.5F, 1e-3F);
+    EXPECT_NEAR(tessellated.getDistance(outer), 0.5F, 1e-3F);
+}
+
+TEST_F(InspectNominalShapeTest, TestPointDeepInsideSolid)
+{
+    Inspection::InspectNominalShape exact(sphere, searchRadius);
+    Inspection::InspectNominalShape tessellated(sphere, searchRadius, true);
+
+    // the centre is far beyond the search radius but must keep the negative sign
+    Base::Vector3f center(0.0F, 0.0F, 0.0F);
+    EXPECT_NEAR(exact.getDistance(center), -50.0F, 1e-3F);
+    EXPECT_EQ(tessellated.getDistance(center), -FLT_MAX);
+}
+
+TEST_F(InspectNominalShapeTest, TestManyPointsInsideSolid)
+{
+    Inspection::InspectNominalShape exact(sphere, searchRadius);
+    Inspection::InspectNominalShape tessellated(sphere, searchRadius, true);
+
+    // the classifier of the solid is reused for all points
+    for (int i = 0; i < 10; i++) {
+        Base::Vector3f inner(0.0F, 0.0F, float(i));
+        Base::Vector3f outer(0.0F, 0.0F, 55.0F + float(i));
+        EXPECT_LT(exact.getDistance(inner), 0.0F);
+        EXPECT_LT(tessellated.getDistance(inner), 0.0F);
+        EXPECT_GT(exact.getDistance(outer), 0.0F);
+        EXPECT_GT(tessellated.getDistance(outer), 0.0F);
+    }
+}
+
+TEST_F(InspectNominalShapeTest, TestPointFarOutside)
+{
+    Inspection::InspectNominalShape tessellated(sphere, searchRadius, true);
+
+    // inside the bounding box but outside of the sphere
+    Base::Vector3f corner(45.0F, 45.0F, 45.0F);
+    EXPECT_EQ(tessellated.getDistance(corner), FLT_MAX);
+
+    // outside the bounding box
+    Base::Vector3f outside(0.0F, 0.0F, 100.0F);
+    EXPECT_EQ(tessellated.getDistance(outside), FLT_MAX);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
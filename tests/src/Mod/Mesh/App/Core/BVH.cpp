@@ -0,0 +1,203 @@
+#include "gtest/gtest.h"
+#include <cfloat>
+#include <Base/Tools2D.h>
+#include <Base/ViewProj.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/TopoAlgorithm.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class BVHTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a grid in front of the left half of another grid
+        addGrid(-0.8F, 0.0F, 2, -0.5F);
+        addGrid(-0.8F, 0.8F, 4, 0.5F);
+    }
+
+    void TearDown() override
+    {}
+
+    void addGrid(float xmin, float xmax, int nx, float z)
+    {
+        const float ymin = -0.8F;
+        const float step = 0.4F;
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < nx; i++) {
+            for (int j = 0; j < 4; j++) {
+                float x0 = xmin + float(i) * (xmax - xmin) / float(nx);
+                float x1 = xmin + float(i + 1) * (xmax - xmin) / float(nx);
+                float y0 = ymin + float(j) * step;
+                float y1 = ymin + float(j + 1) * step;
+                Base::Vector3f p1(x0, y0, z);
+                Base::Vector3f p2(x1, y0, z);
+                Base::Vector3f p3(x1, y1, z);
+                Base::Vector3f p4(x0, y1, z);
+                facets.emplace_back(p1, p2, p3);
+                facets.emplace_back(p1, p3, p4);
+            }
+        }
+        kernel.AddFacets(facets);
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(BVHTest, TestBVHEmpty)
+{
+    MeshCore::MeshKernel empty;
+    MeshCore::MeshFacetBVH bvh(empty);
+    EXPECT_EQ(bvh.CountNodes(), 0);
+
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    EXPECT_FALSE(
+        bvh.NearestFacetOnRay(Base::Vector3f(), Base::Vector3f(0, 0, 1), 3.14F, res, index));
+}
+
+TEST_F(BVHTest, TestBVHValid)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    EXPECT_GT(bvh.CountNodes(), 1);
+    EXPECT_TRUE(bvh.IsValid(kernel));
+
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(1, 0, 0));
+    kernel.Transform(mat);
+    EXPECT_FALSE(bvh.IsValid(kernel));
+}
+
+TEST_F(BVHTest, TestBVHValidAfterTopologyChange)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    EXPECT_TRUE(bvh.IsValid(kernel));
+
+    // swapping an edge changes neither the points nor the bounding box
+    MeshCore::FacetIndex neighbour = kernel.GetFacets()[0]._aulNeighbours[2];
+    ASSERT_NE(neighbour, MeshCore::FACET_INDEX_MAX);
+    MeshCore::MeshTopoAlgorithm topalg(kernel);
+    topalg.SwapEdge(0, neighbour);
+    EXPECT_FALSE(bvh.IsValid(kernel));
+
+    MeshCore::MeshFacetBVH rebuilt(kernel);
+    EXPECT_TRUE(rebuilt.IsValid(kernel));
+
+    // assigning an identical mesh must invalidate it, too
+    MeshCore::MeshKernel copy(kernel);
+    kernel = copy;
+    EXPECT_FALSE(rebuilt.IsValid(kernel));
+}
+
+TEST_F(BVHTest, TestBVHValidAfterNonGeometricChange)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+
+    // neither the neighbourhood nor a self-assignment changes the geometry
+    kernel.RebuildNeighbours();
+    MeshCore::MeshKernel& self = kernel;
+    kernel = self;
+    EXPECT_TRUE(bvh.IsValid(kernel));
+}
+
+TEST_F(BVHTest, TestBVHNearestFacetOnRay)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    MeshCore::MeshAlgorithm alg(kernel);
+
+    Base::Vector3f dir(0, 0, 1);
+    for (const auto& pnt : {Base::Vector3f(-0.5F, 0.3F, -2.0F), Base::Vector3f(0.1F, 0.1F, -2.0F)}) {
+        Base::Vector3f res1;
+        Base::Vector3f res2;
+        MeshCore::FacetIndex index1 {};
+        MeshCore::FacetIndex index2 {};
+        EXPECT_TRUE(bvh.NearestFacetOnRay(pnt, dir, 3.14F, res1, index1));
+        EXPECT_TRUE(alg.NearestFacetOnRay(pnt, dir, 3.14F, res2, index2));
+        EXPECT_EQ(index1, index2);
+        EXPECT_FLOAT_EQ(res1.z, res2.z);
+    }
+
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    EXPECT_FALSE(bvh.NearestFacetOnRay(Base::Vector3f(2, 2, -2), dir, 3.14F, res, index));
+}
+
+TEST_F(BVHTest, TestBVHNearestFacetToPoint)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+
+    Base::Vector3f pnt(0.3F, 0.4F, 1.0F);
+    MeshCore::FacetIndex index {};
+    float dist {};
+    EXPECT_TRUE(bvh.NearestFacetToPoint(pnt, 5.0F, index, dist));
+
+    float minDist = FLT_MAX;
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        minDist = std::min(minDist, kernel.GetFacet(i).DistanceToPoint(pnt));
+    }
+    EXPECT_FLOAT_EQ(dist, minDist);
+    EXPECT_FLOAT_EQ(kernel.GetFacet(index).DistanceToPoint(pnt), minDist);
+
+    EXPECT_FALSE(bvh.NearestFacetToPoint(pnt, 0.1F, index, dist));
+}
+
+TEST_F(BVHTest, TestBVHFacetsInRange)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+
+    Base::Vector3f pnt(0.3F, 0.4F, 1.0F);
+    std::vector<MeshCore::FacetIndex> facets1;
+    std::vector<MeshCore::FacetIndex> facets2;
+    bvh.FacetsInRange(pnt, 1.5F, facets1);
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        if (kernel.GetFacet(i).DistanceToPoint(pnt) <= 1.5F) {
+            facets2.push_back(i);
+        }
+    }
+    EXPECT_FALSE(facets1.empty());
+    EXPECT_EQ(facets1, facets2);
+}
+
+TEST_F(BVHTest, TestBVHFacetsInPolygon)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    MeshCore::MeshAlgorithm alg(kernel);
+    Base::ViewProjMatrix proj(Base::Matrix4D {});
+
+    Base::Polygon2d polygon;
+    polygon.Add(Base::Vector2d(0.3, 0.3));
+    polygon.Add(Base::Vector2d(0.6, 0.3));
+    polygon.Add(Base::Vector2d(0.6, 0.6));
+    polygon.Add(Base::Vector2d(0.3, 0.6));
+
+    for (bool inner : {true, false}) {
+        std::vector<MeshCore::FacetIndex> facets1;
+        std::vector<MeshCore::FacetIndex> facets2;
+        bvh.FacetsInPolygon(&proj, polygon, inner, facets1);
+        alg.CheckFacets(&proj, polygon, inner, facets2);
+        EXPECT_FALSE(facets1.empty());
+        EXPECT_EQ(facets1, facets2);
+    }
+}
+
+TEST_F(BVHTest, TestBVHVisibleFacets)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    Base::ViewProjMatrix proj(Base::Matrix4D {});
+
+    std::vector<MeshCore::FacetIndex> facets;
+    bvh.VisibleFacets(&proj, facets);
+
+    // all facets of the front grid and the right half of the back grid
+    EXPECT_EQ(facets.size(), 32);
+    for (auto index : facets) {
+        MeshCore::MeshGeomFacet facet = kernel.GetFacet(index);
+        Base::Vector3f center = facet.GetGravityPoint();
+        EXPECT_TRUE(center.z < 0.0F || center.x > 0.0F);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
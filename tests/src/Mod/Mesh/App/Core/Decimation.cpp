@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cmath>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class DecimationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a wavy grid of 2 * 60 * 60 facets
+        const int num = 60;
+        MeshCore::MeshPointArray points;
+        for (int j = 0; j <= num; j++) {
+            for (int i = 0; i <= num; i++) {
+                float x = float(i);
+                float y = float(j);
+                points.emplace_back(x, y, std::sin(x * 0.1F) * std::cos(y * 0.1F));
+            }
+        }
+
+        MeshCore::MeshFacetArray facets;
+        for (int j = 0; j < num; j++) {
+            for (int i = 0; i < num; i++) {
+                MeshCore::PointIndex p0 = j * (num + 1) + i;
+                MeshCore::PointIndex p1 = p0 + 1;
+                MeshCore::PointIndex p2 = p0 + num + 2;
+                MeshCore::PointIndex p3 = p0 + num + 1;
+                facets.emplace_back(p0, p1, p2);
+                facets.emplace_back(p0, p2, p3);
+            }
+        }
+
+        kernel.Adopt(points, facets, true);
+    }
+
+    void TearDown() override
+    {}
+
+    bool isValid() const
+    {
+        const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+        for (const auto& it : facets) {
+            for (auto index : it._aulPoints) {
+                if (index >= kernel.CountPoints()) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool allPointsUsed() const
+    {
+        std::vector<bool> used(kernel.CountPoints(), false);
+        for (const auto& it : kernel.GetFacets()) {
+            for (auto index : it._aulPoints) {
+                used[index] = true;
+            }
+        }
+        return std::all_of(used.begin(), used.end(), [](bool value) {
+            return value;
+        });
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(DecimationTest, TestSimplify)
+{
+    MeshCore::MeshSimplify dm(kernel);
+    dm.simplify(2000);
+    EXPECT_LE(kernel.CountFacets(), 2000);
+    EXPECT_GT(kernel.CountFacets(), 0);
+    EXPECT_TRUE(isValid());
+}
+
+TEST_F(DecimationTest, TestSimplifyBlocks)
+{
+    Base::BoundBox3f box = kernel.GetBoundBox();
+
+    MeshCore::MeshSimplify dm(kernel);
+    dm.setBlockSize(1000);
+    dm.simplify(2000);
+    EXPECT_LE(kernel.CountFacets(), 2000);
+    EXPECT_GT(kernel.CountFacets(), 0);
+    EXPECT_TRUE(isValid());
+    // the points removed along the block boundaries are dropped
+    EXPECT_TRUE(allPointsUsed());
+
+    // the corners of the grid are kept
+    Base::BoundBox3f box2 = kernel.GetBoundBox();
+    EXPECT_FLOAT_EQ(box.MinX, box2.MinX);
+    EXPECT_FLOAT_EQ(box.MinY, box2.MinY);
+    EXPECT_FLOAT_EQ(box.MaxX, box2.MaxX);
+    EXPECT_FLOAT_EQ(box.MaxY, box2.MaxY);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include <Mod/Mesh/App/Core/Degeneration.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/Functional.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class EvaluationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+
+    // Adds a pair of crossing triangles at the given offset
+    void addCrossing(MeshCore::MeshKernel& kernel, float x, float y) const
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        facets.emplace_back(Base::Vector3f(x, y, 0),
+                            Base::Vector3f(x + 1, y, 0),
+                            Base::Vector3f(x, y + 1, 0));
+        facets.emplace_back(Base::Vector3f(x + 0.2F, y + 0.2F, -0.5F),
+                            Base::Vector3f(x + 0.2F, y + 0.2F, 0.5F),
+                            Base::Vector3f(x + 0.3F, y + 0.9F, 0));
+        kernel.AddFacets(facets);
+    }
+};
+
+TEST_F(EvaluationTest, TestParallelCollect)
+{
+    auto func = [](std::size_t first, std::size_t last, std::vector<std::size_t>& result) {
+        for (std::size_t i = first; i < last; i++) {
+            if (i % 3 == 0) {
+                result.push_back(i);
+            }
+        }
+        return true;
+    };
+
+    std::vector<std::size_t> values = MeshCore::parallel_collect<std::size_t>(1000, 7, 4, func);
+    ASSERT_EQ(values.size(), 334);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        EXPECT_EQ(values[i], 3 * i);
+    }
+}
+
+TEST_F(EvaluationTest, TestSelfIntersection)
+{
+    MeshCore::MeshKernel kernel;
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            addCrossing(kernel, 2.0F * float(i), 2.0F * float(j));
+        }
+    }
+
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+    eval.GetIntersections(pairs);
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+    ASSERT_EQ(pairs.size(), 100);
+    for (const auto& it : pairs) {
+        EXPECT_EQ(it.first % 2, 0);
+        EXPECT_EQ(it.second, it.first + 1);
+    }
+
+    std::vector<std::pair<Base::Vector3f, Base::Vector3f>> lines;
+    eval.GetIntersections(pairs, lines);
+    EXPECT_EQ(lines.size(), 100);
+}
+
+TEST_F(EvaluationTest, TestNoSelfIntersection)
+{
+    MeshCore::MeshKernel kernel;
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    facets.emplace_back(Base::Vector3f(0, 0, 0), Base::Vector3f(1, 0, 0), Base::Vector3f(0, 1, 0));
+    facets.emplace_back(Base::Vector3f(0, 0, 1), Base::Vector3f(1, 0, 1), Base::Vector3f(0, 1, 1));
+    kernel.AddFacets(facets);
+
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_TRUE(eval.Evaluate());
+}
+
+TEST_F(EvaluationTest, TestDegeneratedFacets)
+{
+    MeshCore::MeshKernel kernel;
+    addCrossing(kernel, 0, 0);
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    facets.emplace_back(Base::Vector3f(5, 0, 0), Base::Vector3f(6, 0, 0), Base::Vector3f(7, 0, 0));
+    kernel.AddFacets(facets);
+
+    MeshCore::MeshEvalDegeneratedFacets eval(kernel, 0.0001F);
+    EXPECT_FALSE(eval.Evaluate());
+    std::vector<MeshCore::FacetIndex> indices = eval.GetIndices();
+    ASSERT_EQ(indices.size(), 1);
+    EXPECT_EQ(indices[0], 2);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -2,9 +2,22 @@
 
 #include "gtest/gtest.h"
 
+#include <sstream>
+#include <BRep_Tool.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepFilletAPI_MakeFillet.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <App/Application.h>
+#include <Base/Reader.h>
+#include <Base/Writer.h>
 #include "Mod/Part/App/FeaturePartCommon.h"
 #include "Mod/Part/App/PropertyTopoShape.h"
+#include "Mod/Part/App/Tools.h"
 #include <src/App/InitApplication.h>
 #include "PartTestHelpers.h"
 #include "Mod/Part/App/TopoShapeCompoundPy.h"
@@ -108,7 +121,106 @@ TEST_F(PropertyTopoShapeTest, testPropertyPartShapeGetPyObject)
 }
 
 // Possible future PropertyPartShape tests:
-// Copy, Paste, getMemSize, beforeSave, Save. Restore
+// Copy, Paste, getMemSize, beforeSave
+
+namespace
+{
+// Returns the deflections of the face triangulations, 0 for a face without one
+std::vector<double> faceDeflections(const TopoDS_Shape& shape)
+{
+    std::vector<double> deflections;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        auto mesh = BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+        deflections.push_back(mesh.IsNull() ? 0.0 : mesh->Deflection());
+    }
+    return deflections;
+}
+
+std::vector<Handle(Poly_Triangulation)> faceTriangulations(const TopoDS_Shape& shape)
+{
+    std::vector<Handle(Poly_Triangulation)> meshes;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        meshes.push_back(BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc));
+    }
+    return meshes;
+}
+
+TopoDS_Shape saveAndRestore(const TopoDS_Shape& shape, bool binary)
+{
+    PropertyPartShape source;
+    source.setValue(shape);
+    Base::StringWriter writer;
+    if (binary) {
+        writer.setMode("BinaryBrep");
+    }
+    source.SaveDocFile(writer);
+
+    std::istringstream stream(writer.getString());
+    Base::Reader reader(stream, binary ? "PartShape.bin" : "PartShape.brp", 1);
+    PropertyPartShape restored;
+    restored.RestoreDocFile(reader);
+    return restored.getValue();
+}
+}  // namespace
+
+TEST_F(PropertyTopoShapeTest, testSaveRestoreTessellation)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+    bool saveTessellation = hGrp->GetBool("SaveTessellation", false);
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    BRepMesh_IncrementalMesh(box, 0.1);
+    // Act
+    hGrp->SetBool("SaveTessellation", true);
+    auto brepWith = faceDeflections(saveAndRestore(box, false));
+    auto binaryWith = faceDeflections(saveAndRestore(box, true));
+    hGrp->SetBool("SaveTessellation", false);
+    auto brepWithout = faceDeflections(saveAndRestore(box, false));
+    auto binaryWithout = faceDeflections(saveAndRestore(box, true));
+    hGrp->SetBool("SaveTessellation", saveTessellation);
+    // Assert
+    ASSERT_EQ(brepWith.size(), 6);
+    ASSERT_EQ(binaryWith.size(), 6);
+    for (std::size_t i = 0; i < 6; ++i) {
+        EXPECT_DOUBLE_EQ(brepWith[i], 0.1);
+        EXPECT_DOUBLE_EQ(binaryWith[i], 0.1);
+    }
+    EXPECT_EQ(brepWithout, std::vector<double>(6, 0.0));
+    EXPECT_EQ(binaryWithout, std::vector<double>(6, 0.0));
+}
+
+TEST_F(PropertyTopoShapeTest, testRestoredTessellationIsNotRemeshed)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+    bool saveTessellation = hGrp->GetBool("SaveTessellation", false);
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+    // mesh a copy as done by the background tessellation and take over its triangulation
+    TopoDS_Shape copy = BRepBuilderAPI_Copy(cylinder, Standard_False, Standard_True).Shape();
+    BRepMesh_IncrementalMesh(copy, 0.1, Standard_False, 0.5, Standard_True);
+    EXPECT_TRUE(Tools::copyTriangulation(copy, cylinder));
+    // Act
+    hGrp->SetBool("SaveTessellation", true);
+    TopoDS_Shape brep = saveAndRestore(cylinder, false);
+    TopoDS_Shape binary = saveAndRestore(cylinder, true);
+    hGrp->SetBool("SaveTessellation", saveTessellation);
+    auto brepMeshes = faceTriangulations(brep);
+    auto binaryMeshes = faceTriangulations(binary);
+    BRepMesh_IncrementalMesh(brep, 0.1, Standard_False, 0.5, Standard_True);
+    BRepMesh_IncrementalMesh(binary, 0.1, Standard_False, 0.5, Standard_True);
+    // Assert
+    EXPECT_EQ(faceTriangulations(cylinder), faceTriangulations(copy));
+    ASSERT_EQ(brepMeshes.size(), 3);
+    for (const auto& mesh : brepMeshes) {
+        EXPECT_FALSE(mesh.IsNull());
+    }
+    EXPECT_EQ(faceTriangulations(brep), brepMeshes);
+    EXPECT_EQ(faceTriangulations(binary), binaryMeshes);
+}
 
 
 TEST_F(PropertyTopoShapeTest, testShapeHistory)
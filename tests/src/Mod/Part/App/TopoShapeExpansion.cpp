@@ -2,6 +2,7 @@
 
 #include "gtest/gtest.h"
 #include "src/App/InitApplication.h"
+#include <Base/Console.h>
 #include <Mod/Part/App/TopoShape.h>
 #include "Mod/Part/App/TopoShapeMapper.h"
 #include <Mod/Part/App/TopoShapeOpCode.h>
@@ -2850,4 +2851,41 @@ TEST_F(TopoShapeExpansionTest, makeElementOffset2D)
                               }));
 }
 
+TEST_F(TopoShapeExpansionTest, makeShapeWithElementMapLocatedShapeInParallel)
+{
+    // Arrange
+    // enough boxes for the element names to be collected in several threads
+    std::vector<TopoShape> boxes;
+    for (int i = 0; i < 50; ++i) {
+        boxes.emplace_back(BRepPrimAPI_MakeBox(gp_Pnt(3.0 * i, 0.0, 0.0), 1.0, 1.0, 1.0).Shape(),
+                           i + 1L);
+    }
+    TopoShape compound(100L);
+    compound.makeElementCompound(boxes);
+    gp_Trsf move;
+    move.SetTranslation(gp_Vec(0.0, 0.0, 5.0));
+    // the result shape is located, so its sub shapes are found by stripping the location
+    auto makeMoved = [&]() {
+        BRepBuilderAPI_Transform transform(compound.getShape(), move, Standard_False);
+        TopoShape result(101L);
+        result.makeShapeWithElementMap(transform.Shape(), MapperMaker(transform), {compound}, "TST");
+        return result;
+    };
+
+    // Act
+    auto parallel = makeMoved();
+    // the names are collected in one thread while log messages are enabled
+    int* logLevel = Base::Console().GetLogLevel("TopoShape");
+    int savedLevel = *logLevel;
+    *logLevel = FC_LOGLEVEL_LOG;
+    auto serial = makeMoved();
+    *logLevel = savedLevel;
+
+    // Assert
+    EXPECT_FALSE(parallel.getShape().Location().IsIdentity());
+    EXPECT_EQ(parallel.countSubShapes(TopAbs_FACE), 300UL);
+    EXPECT_EQ(parallel.getElementMapSize(), 50UL * (8 + 12 + 6));
+    EXPECT_EQ(parallel.getElementMap(), serial.getElementMap());
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -2,6 +2,10 @@
 
 #include "gtest/gtest.h"
 
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRepBuilderAPI_Sewing.hxx>
+#include <gp_Pln.hxx>
 #include <src/App/InitApplication.h>
 
 #include "PartTestHelpers.h"
@@ -51,3 +55,36 @@ TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineBoxes)
     // TODO: Refine doesn't work on compounds, so we're going to need a binary operation or the
     // like, and those don't exist yet.  Once they do, this test can be expanded
 }
+
+TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineCoplanarFaces)
+{
+    // Arrange
+    // Two adjacent faces in the plane z = 0. The plane of the second face has a different
+    // location that is off the plane by less than the tolerance, so the surface keys of the
+    // faces differ slightly but the faces are still coplanar.
+    BRepBuilderAPI_MakePolygon polygon1(gp_Pnt(0.0, 0.0, 0.0),
+                                        gp_Pnt(1.0, 0.0, 0.0),
+                                        gp_Pnt(1.0, 1.0, 0.0),
+                                        gp_Pnt(0.0, 1.0, 0.0),
+                                        Standard_True);
+    BRepBuilderAPI_MakePolygon polygon2(gp_Pnt(1.0, 0.0, 0.0),
+                                        gp_Pnt(2.0, 0.0, 0.0),
+                                        gp_Pnt(2.0, 1.0, 0.0),
+                                        gp_Pnt(1.0, 1.0, 0.0),
+                                        Standard_True);
+    gp_Pln plane1(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(0.0, 0.0, 1.0));
+    gp_Pln plane2(gp_Pnt(5.0, 3.0, 5e-8), gp_Dir(0.0, 0.0, 1.0));
+    TopoDS_Face face1 = BRepBuilderAPI_MakeFace(plane1, polygon1.Wire()).Face();
+    TopoDS_Face face2 = BRepBuilderAPI_MakeFace(plane2, polygon2.Wire()).Face();
+    BRepBuilderAPI_Sewing sewer;
+    sewer.Add(face1);
+    sewer.Add(face2);
+    sewer.Perform();
+    Part::TopoShape ts(sewer.SewedShape());
+    // Act
+    Part::TopoShape refined = ts.makeElementRefine();
+    // Assert
+    EXPECT_EQ(ts.countSubElements("Face"), 2);
+    EXPECT_EQ(refined.countSubElements("Face"), 1);  // The coplanar faces are merged
+    EXPECT_NEAR(PartTestHelpers::getArea(refined.getShape()), 2.0, 1e-6);
+}
@@ -1,5 +1,10 @@
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
 #include <Base/FileInfo.h>
+#include <Mod/Points/App/PointOctree.h>
 #include <Mod/Points/App/Points.h>
 #include <Mod/Points/App/PointsAlgos.h>
 
@@ -238,4 +243,165 @@ TEST_F(PointsTest, TestPCDStructured)
     EXPECT_EQ(reader.getWidth(), 4);
     EXPECT_EQ(reader.getHeight(), 2);
 }
+
+TEST_F(PointsTest, TestBinaryPLY)
+{
+    std::string name = getFileName();
+    {
+        std::ofstream out(name, std::ios::out | std::ios::binary);
+        out << "ply\n"
+            << "format binary_little_endian 1.0\n"
+            << "element vertex 8\n"
+            << "property float x\n"
+            << "property float y\n"
+            << "property float z\n"
+            << "property uchar red\n"
+            << "property uchar green\n"
+            << "property uchar blue\n"
+            << "end_header\n";
+        for (const auto& pnt : getKernel().getBasicPoints()) {
+            out.write(reinterpret_cast<const char*>(&pnt.x), sizeof(float));
+            out.write(reinterpret_cast<const char*>(&pnt.y), sizeof(float));
+            out.write(reinterpret_cast<const char*>(&pnt.z), sizeof(float));
+            unsigned char rgb[3] = {0, 255, 0};
+            out.write(reinterpret_cast<const char*>(rgb), 3);
+        }
+    }
+
+    Points::PlyReader reader;
+    reader.read(name);
+
+    EXPECT_TRUE(reader.hasColors());
+    EXPECT_FALSE(reader.hasNormals());
+    ASSERT_EQ(reader.getPoints().size(), 8);
+    ASSERT_EQ(reader.getColors().size(), 8);
+    const auto& points = reader.getPoints().getBasicPoints();
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(points[i], getKernel().getBasicPoints()[i]);
+    }
+    EXPECT_FLOAT_EQ(reader.getColors().front().g, 1.0F);
+    EXPECT_FLOAT_EQ(reader.getColors().front().r, 0.0F);
+}
+
+TEST_F(PointsTest, TestLargeASCIIPCD)
+{
+    // Enough records to parse them in several threads and to need more than one block
+    std::vector<Base::Vector3f> input;
+    for (int i = 0; i < 70000; i++) {
+        input.emplace_back(float(i), float(i % 100), float(-i));
+    }
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(input);
+
+    std::string name = getFileName();
+    Points::PcdWriter writer(kernel);
+    writer.write(name);
+
+    Points::PcdReader reader;
+    reader.read(name);
+
+    EXPECT_EQ(reader.getWidth(), 70000);
+    ASSERT_EQ(reader.getPoints().size(), input.size());
+    const auto& points = reader.getPoints().getBasicPoints();
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(points[i], input[i]);
+    }
+}
+
+TEST_F(PointsTest, TestCompressedPCD)
+{
+    // The values of a compressed file are stored field by field
+    const auto& input = getKernel().getBasicPoints();
+    std::vector<char> data;
+    for (unsigned short field = 0; field < 3; field++) {
+        for (const auto& pnt : input) {
+            const char* value = reinterpret_cast<const char*>(&pnt[field]);
+            data.insert(data.end(), value, value + sizeof(float));
+        }
+    }
+    for (std::size_t i = 0; i < input.size(); i++) {
+        data.push_back(static_cast<char>(10 * i));
+    }
+
+    // LZF data that only consists of literal runs of up to 32 bytes
+    std::vector<char> compressed;
+    for (std::size_t pos = 0; pos < data.size(); pos += 32) {
+        std::size_t len = std::min<std::size_t>(32, data.size() - pos);
+        compressed.push_back(static_cast<char>(len - 1));
+        compressed.insert(compressed.end(), data.begin() + pos, data.begin() + pos + len);
+    }
+
+    std::string name = getFileName();
+    {
+        std::ofstream out(name, std::ios::out | std::ios::binary);
+        out << "VERSION 0.7\n"
+            << "FIELDS x y z intensity\n"
+            << "SIZE 4 4 4 1\n"
+            << "TYPE F F F U\n"
+            << "COUNT 1 1 1 1\n"
+            << "WIDTH 8\n"
+            << "HEIGHT 1\n"
+            << "POINTS 8\n"
+            << "DATA binary_compressed\n";
+        uint32_t compressedSize = static_cast<uint32_t>(compressed.size());
+        uint32_t uncompressedSize = static_cast<uint32_t>(data.size());
+        out.write(reinterpret_cast<const char*>(&compressedSize), sizeof(uint32_t));
+        out.write(reinterpret_cast<const char*>(&uncompressedSize), sizeof(uint32_t));
+        out.write(compressed.data(), std::streamsize(compressed.size()));
+    }
+
+    Points::PcdReader reader;
+    reader.read(name);
+
+    EXPECT_TRUE(reader.hasIntensities());
+    ASSERT_EQ(reader.getPoints().size(), 8);
+    ASSERT_EQ(reader.getIntensities().size(), 8);
+    const auto& points = reader.getPoints().getBasicPoints();
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(points[i], input[i]);
+        EXPECT_FLOAT_EQ(reader.getIntensities()[i], float(10 * i));
+    }
+}
+
+TEST_F(PointsTest, TestOctree)
+{
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 40; i++) {
+        for (int j = 0; j < 40; j++) {
+            for (int k = 0; k < 10; k++) {
+                points.emplace_back(float(i), float(j), float(k));
+            }
+        }
+    }
+    points.emplace_back(std::nanf(""), 0.0F, 0.0F);
+
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(points);
+
+    Points::PointOctree octree(1000);
+    octree.build(kernel);
+    ASSERT_FALSE(octree.empty());
+    EXPECT_EQ(octree.countValidPoints(), 16000);
+
+    // each point is referenced once and the invalid point is the last one
+    std::vector<std::size_t> order = octree.getOrder();
+    ASSERT_EQ(order.size(), points.size());
+    EXPECT_EQ(order.back(), points.size() - 1);
+    std::sort(order.begin(), order.end());
+    for (std::size_t i = 0; i < order.size(); i++) {
+        EXPECT_EQ(order[i], i);
+    }
+
+    std::size_t count = 0;
+    for (const auto& node : octree.getNodes()) {
+        count += node.count;
+        if (!node.isLeaf()) {
+            EXPECT_LE(node.count, 1000);
+        }
+        for (std::size_t i = node.first; i < node.first + node.count; i++) {
+            EXPECT_TRUE(node.box.IsInBox(points[octree.getOrder()[i]]));
+        }
+    }
+    EXPECT_EQ(count, 16000);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,178 @@
+#include "gtest/gtest.h"
+#include <sstream>
+#include <BRep_Builder.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <gp_Trsf.hxx>
+#include <Base/FileInfo.h>
+#include <Mod/Part/App/TopoShape.h>
+#include <Mod/TechDraw/App/ProjectionCache.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using namespace TechDraw;
+
+class ProjectionCacheTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+        ProjectionCache::instance().clear();
+        ProjectionCache::instance().setCapacity(2);
+    }
+
+    void TearDown() override
+    {
+        ProjectionCache::instance().clear();
+        ProjectionCache::instance().setCapacity(64);
+    }
+
+    static ProjectionKey keyFor(const TopoDS_Shape& shape, double scale = 1.0)
+    {
+        return ProjectionCache::makeKey(shape, gp_Ax2(), scale, 0.0, 0, false, 0.0);
+    }
+
+    TopoDS_Shape box;
+};
+
+TEST_F(ProjectionCacheTest, TestKeyIdentity)
+{
+    TopoDS_Compound compound;
+    BRep_Builder builder;
+    builder.MakeCompound(compound);
+    builder.Add(compound, box);
+
+    gp_Trsf move;
+    move.SetTranslation(gp_Vec(1.0, 0.0, 0.0));
+
+    ProjectionKey key = keyFor(box);
+    EXPECT_FALSE(key.empty());
+    EXPECT_EQ(key, keyFor(box));
+    EXPECT_EQ(ProjectionKeyHash()(key), ProjectionKeyHash()(keyFor(box)));
+    // the compound around the source shapes is rebuilt on each recompute
+    EXPECT_EQ(key, keyFor(compound));
+    // an equal shape with its own TShape is a different shape
+    EXPECT_FALSE(key == keyFor(BRepBuilderAPI_Copy(box).Shape()));
+    EXPECT_FALSE(key == keyFor(box.Moved(TopLoc_Location(move))));
+    EXPECT_FALSE(key == keyFor(box, 2.0));
+    EXPECT_TRUE(keyFor(TopoDS_Shape()).empty());
+}
+
+TEST_F(ProjectionCacheTest, TestHitMissEviction)
+{
+    ProjectionCache& cache = ProjectionCache::instance();
+    ProjectionKey keyA = keyFor(box);
+    ProjectionKey keyB = keyFor(box, 2.0);
+    ProjectionKey keyC = keyFor(box, 3.0);
+    HlrResult result;
+    result.visHard = box;
+
+    // miss on an empty cache, hit after adding
+    HlrResult found;
+    EXPECT_FALSE(cache.findProjection(keyA, found));
+    cache.addProjection(keyA, result);
+    EXPECT_TRUE(cache.findProjection(keyA, found));
+    EXPECT_TRUE(found.visHard.IsSame(box));
+    EXPECT_FALSE(cache.findProjection(keyB, found));
+
+    // the least recently used entry is evicted
+    cache.addProjection(keyB, result);
+    EXPECT_TRUE(cache.findProjection(keyA, found));
+    cache.addProjection(keyC, result);
+    EXPECT_EQ(cache.size(), 2U);
+    EXPECT_TRUE(cache.findProjection(keyA, found));
+    EXPECT_FALSE(cache.findProjection(keyB, found));
+    EXPECT_TRUE(cache.findProjection(keyC, found));
+
+    // a capacity of zero disables the cache
+    cache.setCapacity(0);
+    EXPECT_EQ(cache.size(), 0U);
+    cache.addProjection(keyA, result);
+    EXPECT_FALSE(cache.findProjection(keyA, found));
+}
+
+TEST_F(ProjectionCacheTest, TestFacesHitMiss)
+{
+    ProjectionCache& cache = ProjectionCache::instance();
+    ProjectionKey key = keyFor(box);
+    std::vector<TopoDS_Wire> wires(3);
+
+    std::vector<TopoDS_Wire> found;
+    EXPECT_FALSE(cache.findFaces(key, found));
+    cache.addFaces(key, wires);
+    EXPECT_TRUE(cache.findFaces(key, found));
+    EXPECT_EQ(found.size(), 3U);
+    EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST_F(ProjectionCacheTest, TestReleaseDocument)
+{
+    ProjectionCache& cache = ProjectionCache::instance();
+    cache.setCapacity(8);
+    Base::FileInfo dir(Base::FileInfo::getTempPath() + "ProjectionCacheTest");
+    dir.deleteDirectoryRecursive();
+    cache.setStoreDirectory(dir.filePath());
+
+    auto count = [](const TopoDS_Shape& shape, TopAbs_ShapeEnum type) {
+        int num = 0;
+        for (TopExp_Explorer xp(shape, type); xp.More(); xp.Next()) {
+            num++;
+        }
+        return num;
+    };
+
+    ProjectionKey key = keyFor(box);
+    key.document = "Unnamed";
+    ProjectionKey faceKey = keyFor(box, 2.0);
+    faceKey.document = "Unnamed";
+    ProjectionKey otherKey = keyFor(box, 3.0);
+    otherKey.document = "Other";
+    HlrResult result;
+    result.visHard = box;
+    std::vector<TopoDS_Wire> wires;
+    for (TopExp_Explorer xp(box, TopAbs_WIRE); xp.More(); xp.Next()) {
+        wires.push_back(TopoDS::Wire(xp.Current()));
+    }
+    cache.addProjection(key, result);
+    cache.addFaces(faceKey, wires);
+    cache.addProjection(otherKey, result);
+
+    // the entries of the document don't stay in memory
+    cache.releaseDocument("Unnamed");
+    EXPECT_EQ(cache.size(), 1U);
+
+    // the shape of the reopened document has new TShapes with the same content
+    std::stringstream brep;
+    Part::TopoShape(box).exportBrep(brep);
+    Part::TopoShape restored;
+    restored.importBrep(brep);
+    ProjectionKey reloadedKey = keyFor(restored.getShape());
+    reloadedKey.document = "Unnamed";
+    ProjectionKey reloadedFaceKey = keyFor(restored.getShape(), 2.0);
+    reloadedFaceKey.document = "Unnamed";
+    EXPECT_FALSE(reloadedKey == key);
+
+    HlrResult found;
+    std::vector<TopoDS_Wire> foundWires;
+    EXPECT_TRUE(cache.findProjection(reloadedKey, found));
+    EXPECT_EQ(count(found.visHard, TopAbs_FACE), 6);
+    EXPECT_TRUE(found.hidHard.IsNull());
+    EXPECT_FALSE(cache.findFaces(reloadedKey, foundWires));
+    EXPECT_TRUE(cache.findFaces(reloadedFaceKey, foundWires));
+    EXPECT_EQ(foundWires.size(), wires.size());
+    EXPECT_EQ(cache.size(), 3U);
+
+    // a changed shape isn't taken for the stored one
+    TopoDS_Shape changed = BRepPrimAPI_MakeBox(10.0, 10.0, 11.0).Shape();
+    EXPECT_FALSE(cache.findProjection(keyFor(changed), found));
+    EXPECT_FALSE(cache.findProjection(keyFor(restored.getShape(), 4.0), found));
+
+    cache.setStoreDirectory(std::string());
+    dir.deleteDirectoryRecursive();
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)